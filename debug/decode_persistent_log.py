@@ -0,0 +1,104 @@
+import argparse
+import datetime
+import glob
+import os
+import re
+import struct
+import sys
+
+# Layout matches kbf/debug/persistent_log.hpp
+MAGIC = 0x4C46424B  # "KBFL"
+FILE_HEADER = struct.Struct("<IHHIIqII")   # magic, version, headerSize, capacity, usedBytes, createdMicros, records, droppedRecords
+RECORD_HEADER = struct.Struct("<qIHBB")    # timestampMicros, sequence, length, severity, reserved
+
+SEVERITIES = ["DEBUG", "INFO", "SUCCESS", "WARNING", "ERROR"]
+
+def format_time(micros, utc):
+    seconds, micros = divmod(micros, 1_000_000)
+    if utc:
+        stamp = datetime.datetime.fromtimestamp(seconds, tz=datetime.timezone.utc)
+    else:
+        stamp = datetime.datetime.fromtimestamp(seconds)
+    return f"{stamp:%Y-%m-%d %H:%M:%S}.{micros:06d}"
+
+def decode_file(path, utc=False, min_severity=0):
+    """
+    Decodes one .kbfl file into text lines.
+    Stops at the committed size in the header - anything past it is unused, or a record cut off by a crash.
+    """
+    with open(path, "rb") as f:
+        data = f.read()
+
+    if len(data) < FILE_HEADER.size:
+        return [f"# {path}: too small to be a persistent log"]
+
+    magic, version, header_size, capacity, used_bytes, created, records, dropped = FILE_HEADER.unpack_from(data, 0)
+    if magic != MAGIC:
+        return [f"# {path}: not a persistent log (bad magic)"]
+    if version != 1:
+        return [f"# {path}: unsupported version {version}"]
+
+    lines = [f"# {os.path.basename(path)}: created {format_time(created, utc)}, {records} records, {dropped} dropped"]
+
+    end = min(used_bytes, len(data))
+    offset = header_size
+    last_sequence = None
+    while offset + RECORD_HEADER.size <= end:
+        timestamp, sequence, length, severity, _ = RECORD_HEADER.unpack_from(data, offset)
+        offset += RECORD_HEADER.size
+        if offset + length > end:
+            lines.append("# [truncated record]")
+            break
+
+        text = data[offset:offset + length].decode("utf-8", errors="replace")
+        offset += length
+
+        if last_sequence is not None and sequence != last_sequence + 1:
+            lines.append(f"# [{sequence - last_sequence - 1} records missing]")
+        last_sequence = sequence
+
+        if severity < min_severity:
+            continue
+
+        level = SEVERITIES[severity] if severity < len(SEVERITIES) else f"LEVEL{severity}"
+        lines.append(f"[{format_time(timestamp, utc)}] [{level}] {text}")
+
+    return lines
+
+def rotated_files(directory):
+    """
+    kbf_log.kbfl is the newest file, kbf_log.1.kbfl the one before it, etc. Returns them oldest first.
+    """
+    def index_of(path):
+        match = re.match(r"kbf_log(?:\.(\d+))?\.kbfl$", os.path.basename(path))
+        return int(match.group(1) or 0) if match else None
+
+    paths = [p for p in glob.glob(os.path.join(directory, "kbf_log*.kbfl")) if index_of(p) is not None]
+    return sorted(paths, key=index_of, reverse=True)
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert KBF persistent log files (.kbfl) to text.")
+    parser.add_argument("paths", nargs="+", help="Log files, or a Logs directory to decode every rotated file in it (oldest first)")
+    parser.add_argument("--out", help="Write to this file instead of stdout")
+    parser.add_argument("--utc", action="store_true", help="Print timestamps in UTC instead of local time")
+    parser.add_argument("--min-level", choices=SEVERITIES, default="DEBUG", help="Skip entries below this level")
+    args = parser.parse_args()
+
+    files = []
+    for path in args.paths:
+        files.extend(rotated_files(path) if os.path.isdir(path) else [path])
+
+    min_severity = SEVERITIES.index(args.min_level)
+    lines = []
+    for path in files:
+        lines.extend(decode_file(path, args.utc, min_severity))
+
+    text = "\n".join(lines) + "\n"
+    if args.out:
+        with open(args.out, "w", encoding="utf-8") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+if __name__ == "__main__":
+    main()
@@ -10,6 +10,7 @@
 #include <kbf/util/re_engine/find_transform.hpp>
 #include <kbf/util/re_engine/get_component.hpp>
 #include <kbf/enums/armor_parts.hpp>
+#include <kbf/data/data_footprint.hpp>
 
 #include <unordered_set>
 #include <set>
@@ -90,6 +91,36 @@ namespace kbf {
 	}
 
 
+	MemoryFootprint ArmourDataManager::getMemoryFootprint() const {
+		MemoryFootprint report{ "Armour Data", 0, sizeof(*this) };
+
+		report.add(MemoryFootprint{ "Armour Series", armourSeriesIDMappings.size(), footprint::hashContainerBytes(armourSeriesIDMappings, [](const auto& entry) {
+			return footprint::stringBytes(entry.second.name);
+		}) });
+		report.add(MemoryFootprint{ "NPC Prefabs", npcPrefabToArmourSetMap.size(), footprint::hashContainerBytes(npcPrefabToArmourSetMap, [](const auto& entry) {
+			return footprint::stringBytes(entry.first) + footprint::stringBytes(entry.second.name);
+		}) });
+		report.add(MemoryFootprint{ "NPC Prefab Index", npcPrefabIndex.size(), npcPrefabIndex.getBytes() + footprint::vectorBytes(npcPrefabArmours) });
+		report.add(MemoryFootprint{ "Known Armour Series", knownArmourSeries.size(), footprint::hashContainerBytes(knownArmourSeries, [](const auto& entry) {
+			return footprint::armourSetBytes(entry.first);
+		}) });
+		report.add(MemoryFootprint{ "Known NPC Prefabs", knownNpcPrefabs.size(), footprint::hashContainerBytes(knownNpcPrefabs, [](const auto& entry) {
+			return footprint::armourSetBytes(entry.first) + footprint::stringBytes(entry.second);
+		}) });
+		report.add(MemoryFootprint{ "NPC Primary Transforms", npcPrefabToPrimaryTransformNameMap.size(), footprint::hashContainerBytes(npcPrefabToPrimaryTransformNameMap, [](const auto& entry) {
+			return footprint::stringBytes(entry.first) + footprint::stringBytes(entry.second);
+		}) });
+
+		size_t costumeCount = 0;
+		const size_t costumeBytes = footprint::hashContainerBytes(partnerIdToCostumePrefabMap, [&](const auto& entry) {
+			costumeCount += entry.second.size();
+			return footprint::hashContainerBytes(entry.second, [](const auto& costume) { return footprint::stringBytes(costume.second); });
+		});
+		report.add(MemoryFootprint{ "Partner Costumes", costumeCount, costumeBytes });
+
+		return report;
+	}
+
 	ArmourSet ArmourDataManager::getArmourSetFromArmourID(const ArmorSetID& setId) const {
 		const auto& it = armourSeriesIDMappings.find(setId);
 		if (it != armourSeriesIDMappings.end()) {
@@ -99,11 +130,21 @@ namespace kbf {
 		return ArmourSet::DEFAULT;
 	}
 
-	ArmourSet ArmourDataManager::getArmourSetFromNpcPrefab(const std::string& npcPrefabPath, bool female) const {
-		const auto& it = npcPrefabToArmourSetMap.find(npcPrefabPath);
-		if (it != npcPrefabToArmourSetMap.end()) {
-			if (female && it->second.femaleCanUse) return ArmourSet{ it->second.name, true };
-			if (!female && it->second.maleCanUse)  return ArmourSet{ it->second.name, false };
+	ArmourSet ArmourDataManager::getArmourSetFromNpcPrefab(std::string_view npcPrefabPath, bool female) const {
+		const NpcPrefabData* data = nullptr;
+		if (npcPrefabIndex.size() != 0) {
+			const size_t slot = npcPrefabIndex.find(npcPrefabPath);
+			if (slot != MinimalPerfectHash::npos) data = npcPrefabArmours[slot];
+		}
+		else if (!npcPrefabToArmourSetMap.empty()) {
+			// The index failed to build - slower, but still correct.
+			const auto it = npcPrefabToArmourSetMap.find(std::string(npcPrefabPath));
+			if (it != npcPrefabToArmourSetMap.end()) data = &it->second;
+		}
+
+		if (data != nullptr) {
+			if (female && data->femaleCanUse) return ArmourSet{ data->name, true };
+			if (!female && data->maleCanUse)  return ArmourSet{ data->name, false };
 		}
 
 		return ArmourSet::DEFAULT;
@@ -116,7 +157,7 @@ namespace kbf {
 		
 		auto it = npcPrefabToPrimaryTransformNameMap.find(prefabPath);
 		// We know what the transform should be called, just find it
-		if (it != npcPrefabToPrimaryTransformNameMap.end()) return findTransform(baseTransform, it->second);
+		if (it != npcPrefabToPrimaryTransformNameMap.end()) return findTransform(baseTransform, it->second, prefabPath);
 
 		// We need to figure out what the primary transform is. Since this is cached, we can afford it being a touch on the expensive side.
 		// Search through the character's MeshSetting instances, these live UNDER each submesh in the prefab.
@@ -229,6 +270,28 @@ namespace kbf {
 				knownNpcPrefabs.emplace(sm, prefabPth);
 			}
 		}
+
+		buildNpcPrefabIndex();
+	}
+
+	void ArmourDataManager::buildNpcPrefabIndex() {
+		std::vector<std::string_view> prefabPaths;
+		std::vector<const NpcPrefabData*> prefabData;
+		prefabPaths.reserve(npcPrefabToArmourSetMap.size());
+		prefabData.reserve(npcPrefabToArmourSetMap.size());
+		for (const auto& [prefabPth, data] : npcPrefabToArmourSetMap) {
+			prefabPaths.push_back(prefabPth);
+			prefabData.push_back(&data);
+		}
+
+		npcPrefabArmours.assign(prefabPaths.size(), nullptr);
+		if (!npcPrefabIndex.build(prefabPaths)) {
+			npcPrefabArmours.clear();
+			DEBUG_STACK.fpush<LOG_TAG>(DebugStack::Color::COL_WARNING, "Failed to build NPC prefab index over {} prefabs, falling back to map lookups.", prefabPaths.size());
+			return;
+		}
+
+		for (size_t i = 0; i < prefabPaths.size(); i++) npcPrefabArmours[npcPrefabIndex.find(prefabPaths[i])] = prefabData[i];
 	}
 
 	ArmourPieceFlags ArmourDataManager::getResidentArmourPieces(size_t armorSeries) const {
@@ -5,7 +5,10 @@
 #include <kbf/util/re_engine/reinvoke.hpp>
 #include <kbf/util/re_engine/guid_to_string.hpp>
 #include <kbf/util/re_engine/re_singleton.hpp>
+#include <kbf/debug/memory_footprint.hpp>
+#include <kbf/util/hash/minimal_perfect_hash.hpp>
 
+#include <string_view>
 #include <unordered_set>
 
 #define ARMOUR_DATA_FETCH_CAP 1000
@@ -50,7 +53,7 @@ namespace kbf {
 	using ArmorSetToNpcPrefabMap = std::unordered_map<ArmourSet, std::string>;
 	using ArmorSetResidentPiecesMap = std::unordered_map<ArmourSet, ArmourPieceFlags>;
 
-	class ArmourDataManager {
+	class ArmourDataManager : public iMemoryReporter {
 	public:
 		static ArmourDataManager& get();
 
@@ -60,7 +63,7 @@ namespace kbf {
 		std::vector<ArmourSet> getFilteredArmourSets(const std::string& filter);
 		static ArmorSetID getArmourSetIDFromArmourSeries(uint32_t series, bool female);
 		ArmourSet getArmourSetFromArmourID(const ArmorSetID& setId) const;
-		ArmourSet getArmourSetFromNpcPrefab(const std::string& npcPrefabPath, bool female) const;
+		ArmourSet getArmourSetFromNpcPrefab(std::string_view npcPrefabPath, bool female) const;
 		REApi::ManagedObject* getNpcPrefabPrimaryTransform(const std::string& prefabPath, REApi::ManagedObject* baseTransform);
 		std::string getPartnerCostumePrefab(size_t partnerId, size_t costumeId) const;
 
@@ -72,18 +75,25 @@ namespace kbf {
 		static std::optional<ArmorSetID> getArmourSetIDFromPrefabName(const std::string& prefabName);
 		static std::string getPrefabNameFromArmourSetID(const ArmorSetID& setId, ArmourPiece piece, bool characterFemale);
 
+		MemoryFootprint getMemoryFootprint() const override;
+
 	private:
 		ArmourDataManager() = default;
 		bool initialized = false;
 
 		ArmorSeriesIDMap armourSeriesIDMappings;
 		NpcPrefabToArmorSetMap npcPrefabToArmourSetMap;
+		// Perfect hash over npcPrefabToArmourSetMap's keys, built once it's loaded. Slot i's data is npcPrefabArmours[i].
+		//  Left empty if it can't be built, in which case lookups go to the map itself.
+		MinimalPerfectHash npcPrefabIndex;
+		std::vector<const NpcPrefabData*> npcPrefabArmours;
 		ArmorSetToSetIDMap knownArmourSeries;
 		ArmorSetToNpcPrefabMap knownNpcPrefabs;
 		std::unordered_map<std::string, std::string> npcPrefabToPrimaryTransformNameMap;
 		std::unordered_map<size_t, std::unordered_map<size_t, std::string>> partnerIdToCostumePrefabMap;
 
 		void getArmourMappings();
+		void buildNpcPrefabIndex();
 
 		ArmourPieceFlags getResidentArmourPieces(size_t armorSeries) const;
 
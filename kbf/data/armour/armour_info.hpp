@@ -38,6 +38,10 @@ namespace kbf {
 			}
 		}
 
+		const std::optional<ArmourSet>& getPiece(ArmourPiece piece) const {
+			return const_cast<ArmourInfo*>(this)->getPiece(piece);
+		}
+
 		bool isFullyPopulated() const {
 			// Slinger is truly optional, so don't check it.
 			return helm.has_value() && body.has_value() && arms.has_value() && coil.has_value() && legs.has_value();
@@ -165,4 +165,12 @@ namespace kbf {
 		writer.Uint64(hash);
 	}
 
+	size_t BoneCacheManager::getCacheHeapBytes(const BoneCache& cache) const {
+		size_t bytes = 0;
+		for (const HashedBoneList* list : { &cache.set, &cache.helm, &cache.body, &cache.arms, &cache.coil, &cache.legs }) {
+			bytes += footprint::vectorBytes(list->getBones(), footprint::stringBytes);
+		}
+		return bytes;
+	}
+
 }
\ No newline at end of file
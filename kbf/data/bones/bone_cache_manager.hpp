@@ -17,6 +17,7 @@ namespace kbf {
 	private:
 		bool getCacheFromDocument(const rapidjson::Document& doc, ArmourSetWithCharacterSex armour, BoneCache& out) const override;
 		bool writeCacheJson(const std::filesystem::path& path, const BoneCache& out) const override;
+		size_t getCacheHeapBytes(const BoneCache& cache) const override;
 
 		void writeBoneCacheData(
 			std::string id,
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <kbf/debug/memory_footprint.hpp>
+#include <kbf/data/armour/armour_set.hpp>
+#include <kbf/data/armour/armour_info.hpp>
+#include <kbf/data/mesh/parts/mesh_part.hpp>
+#include <kbf/data/mesh/materials/mesh_material.hpp>
+#include <kbf/data/player/player_data.hpp>
+#include <kbf/data/formats/format_metadata.hpp>
+
+#include <optional>
+
+namespace kbf::footprint {
+
+    // Heap bytes owned by the data types shared between several reporters.
+
+    inline size_t armourSetBytes(const ArmourSet& set) {
+        return stringBytes(set.name);
+    }
+
+    inline size_t armourSetBytes(const ArmourSetWithCharacterSex& set) {
+        return stringBytes(set.set.name);
+    }
+
+    inline size_t armourSetBytes(const std::optional<ArmourSet>& set) {
+        return set.has_value() ? armourSetBytes(*set) : 0;
+    }
+
+    inline size_t armourInfoBytes(const ArmourInfo& info) {
+        return armourSetBytes(info.helm)
+            + armourSetBytes(info.body)
+            + armourSetBytes(info.arms)
+            + armourSetBytes(info.coil)
+            + armourSetBytes(info.legs)
+            + armourSetBytes(info.slinger);
+    }
+
+    inline size_t metadataBytes(const FormatMetadata& metadata) {
+        return stringBytes(metadata.VERSION) + stringBytes(metadata.MOD_ARCHIVE);
+    }
+
+    inline size_t playerDataBytes(const PlayerData& player) {
+        return stringBytes(player.name) + stringBytes(player.hunterId) + metadataBytes(player.metadata);
+    }
+
+    inline size_t meshPartBytes(const MeshPart& part) {
+        return stringBytes(part.name);
+    }
+
+    inline size_t meshMaterialBytes(const MeshMaterial& material) {
+        return stringBytes(material.name) + hashContainerBytes(material.params, [](const auto& entry) {
+            return stringBytes(entry.first) + stringBytes(entry.second.name);
+        });
+    }
+
+}
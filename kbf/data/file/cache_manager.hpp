@@ -3,6 +3,7 @@
 #include <kbf/data/armour/armour_piece.hpp>
 #include <kbf/data/armour/armour_set.hpp>
 #include <kbf/debug/debug_stack.hpp>
+#include <kbf/data/data_footprint.hpp>
 #include <kbf/util/string/cvt_utf16_utf8.hpp>
 #include <kbf/data/file/kbf_file_upgrader.hpp>
 
@@ -28,7 +29,7 @@ namespace kbf {
 	};
 
 	template<typename CacheType, typename CacheIDType>
-	class CacheManager {
+	class CacheManager : public iMemoryReporter {
 	public:
 		CacheManager(CacheManagerType type, const std::filesystem::path& cachesPath) 
 			: type{ type }, cachesPath{ cachesPath } 
@@ -81,6 +82,20 @@ namespace kbf {
 			return armourSets;
 		}
 
+		MemoryFootprint getMemoryFootprint() const override {
+			const char* name = "Caches";
+			switch (type) {
+			case CacheManagerType::BONES:     name = "Bone Caches";     break;
+			case CacheManagerType::PARTS:     name = "Part Caches";     break;
+			case CacheManagerType::MATERIALS: name = "Material Caches"; break;
+			}
+
+			size_t bytes = footprint::hashContainerBytes(caches, [this](const auto& entry) {
+				return footprint::armourSetBytes(entry.first) + getCacheHeapBytes(entry.second);
+			});
+			return MemoryFootprint{ name, caches.size(), bytes };
+		}
+
 	protected:
 		const CacheManagerType type;
 		const std::filesystem::path cachesPath;
@@ -220,6 +235,7 @@ namespace kbf {
 		}
 
 		virtual bool writeCacheJson(const std::filesystem::path& path, const CacheType& out) const = 0;
+		virtual size_t getCacheHeapBytes(const CacheType& cache) const = 0;
 
 		std::string getCacheFilename(const ArmourSetWithCharacterSex& armour) const {
 			std::string characterSex = (armour.characterFemale ? "F" : "M");
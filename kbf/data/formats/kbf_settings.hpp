@@ -10,6 +10,7 @@ namespace kbf {
 		float applicationRange               = 30.0f;
 		int   maxConcurrentApplications      = 10;
 		int   maxBoneFetchesPerFrame         = 1;
+		int   pointerRecheckInterval         = 60;
 		bool  enableDuringQuestsOnly         = false;
 		bool  enableHideWeapons              = true;
 		bool  enableHideKinsect              = true;
@@ -19,6 +20,12 @@ namespace kbf {
 		bool  hideWeaponsOutsideOfCombatOnly = true;
 		bool  hideSlingerOutsideOfCombatOnly = true;
 		bool  enableProfiling                = false;
+		bool  enableAdaptiveBudget           = false;
+		float adaptiveBudgetUs               = 1000.0f;
+		int   adaptiveMinConcurrentApplications = 1;
+		int   adaptiveMinBoneFetchesPerFrame = 1;
+		float adaptiveMinApplicationRange    = 10.0f;
+		bool  enablePersistentLog            = false;
 	};
 
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 #define SETTINGS_APPLICATION_RANGE_ID                   "applicationRange"
 #define SETTINGS_MAX_CONCURRENT_APPLICATIONS_ID         "maxConcurrentApplications"
 #define SETTINGS_MAX_BONE_FETCHES_PER_FRAME_ID          "maxBoneFetchesPerFrame"
+#define SETTINGS_POINTER_RECHECK_INTERVAL_ID            "pointerRecheckInterval"
 #define SETTINGS_ENABLE_DURING_QUESTS_ONLY_ID           "enableDuringQuestsOnly"
 #define SETTINGS_ENABLE_HIDE_WEAPONS_ID                 "enableHideWeapons"
 #define SETTINGS_ENABLE_HIDE_KINSECT_ID                 "enableHideKinsect"
@@ -15,4 +16,10 @@
 #define SETTINGS_FORCE_SHOW_WEAPON_WHEN_ON_SEIKRET_ID   "forceShowWeaponWhenOnSeikret"
 #define SETTINGS_HIDE_WEAPONS_OUTSIDE_OF_COMBAT_ONLY_ID "hideWeaponsOutsideOfCombatOnly"
 #define SETTINGS_HIDE_SLINGER_OUTSIDE_OF_COMBAT_ONLY_ID "hideSlingerOutsideOfCombatOnly"
-#define SETTINGS_ENABLE_PROFILING_ID                    "enableProfiling"
\ No newline at end of file
+#define SETTINGS_ENABLE_PROFILING_ID                    "enableProfiling"
+#define SETTINGS_ENABLE_ADAPTIVE_BUDGET_ID              "enableAdaptiveBudget"
+#define SETTINGS_ADAPTIVE_BUDGET_US_ID                  "adaptiveBudgetUs"
+#define SETTINGS_ADAPTIVE_MIN_CONCURRENT_APPLICATIONS_ID "adaptiveMinConcurrentApplications"
+#define SETTINGS_ADAPTIVE_MIN_BONE_FETCHES_PER_FRAME_ID "adaptiveMinBoneFetchesPerFrame"
+#define SETTINGS_ADAPTIVE_MIN_APPLICATION_RANGE_ID      "adaptiveMinApplicationRange"
+#define SETTINGS_ENABLE_PERSISTENT_LOG_ID               "enablePersistentLog"
\ No newline at end of file
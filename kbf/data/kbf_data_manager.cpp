@@ -23,6 +23,7 @@
 #include <kbf/data/armour/armour_data_manager.hpp>
 #include <kbf/data/npc/npc_data_manager.hpp>
 #include <kbf/data/bones/bone_symmetry_utils.hpp>
+#include <kbf/data/data_footprint.hpp>
 
 #include <filesystem>
 #include <fstream>
@@ -30,6 +31,7 @@
 #include <unordered_set>
 #include <set>
 #include <unordered_map>
+#include <string_view>
 #include <locale>
 #include <codecvt>
 
@@ -187,45 +189,75 @@ namespace kbf {
         return nullptr;
     }
 
+    namespace {
+
+        // Outfit name -> the defaults field holding its preset, per core NPC. Built on first use.
+        template <typename Defaults>
+        using OutfitPresetTable = std::unordered_map<std::string_view, std::string Defaults::*>;
+
+        const OutfitPresetTable<AlmaDefaults>& almaOutfitPresets() {
+            static const OutfitPresetTable<AlmaDefaults> table{
+                { ALMAS_HANDLER_OUTFIT_NAME,             &AlmaDefaults::handlersOutfit           },
+                { ALMAS_SCRIVENERS_COAT_NAME,            &AlmaDefaults::scrivenersCoat           },
+                { ALMAS_SPRING_BLOSSOM_KIMONO_NAME,      &AlmaDefaults::springBlossomKimono      },
+                { ALMAS_SUMMER_PONCHO_NAME,              &AlmaDefaults::summerPoncho             },
+                { ALMAS_NEW_WORLD_COMMISSION_NAME,       &AlmaDefaults::newWorldCommission       },
+                { ALMAS_CHUN_LI_OUTFIT_NAME,             &AlmaDefaults::chunLiOutfit             },
+                { ALMAS_CAMMY_OUTFIT_NAME,               &AlmaDefaults::cammyOutfit              },
+                { ALMAS_AUTUMN_WITCH_OUTFIT_NAME,        &AlmaDefaults::autumnWitch              },
+                { ALMAS_FEATHERSKIRT_SEIKRET_DRESS_NAME, &AlmaDefaults::featherskirtSeikretDress },
+            };
+            return table;
+        }
+
+        const OutfitPresetTable<GemmaDefaults>& gemmaOutfitPresets() {
+            static const OutfitPresetTable<GemmaDefaults> table{
+                { GEMMAS_SMITHYS_OUTFIT_NAME,        &GemmaDefaults::smithysOutfit       },
+                { GEMMAS_SUMMER_COVERALLS_NAME,      &GemmaDefaults::summerCoveralls     },
+                { GEMMAS_REDVEIL_SEIKRET_DRESS_NAME, &GemmaDefaults::redveilSeikretDress },
+            };
+            return table;
+        }
+
+        const OutfitPresetTable<ErikDefaults>& erikOutfitPresets() {
+            static const OutfitPresetTable<ErikDefaults> table{
+                { ERIKS_HANDLERS_OUTFIT_NAME,          &ErikDefaults::handlersOutfit         },
+                { ERIKS_SUMMER_HAT_NAME,               &ErikDefaults::summerHat              },
+                { ERIKS_AUTUMN_THERIAN_NAME,           &ErikDefaults::autumnTherian          },
+                { ERIKS_CRESTCOLLAR_SEIKRET_SUIT_NAME, &ErikDefaults::crestcollarSeikretSuit },
+            };
+            return table;
+        }
+
+        // The preset UUID for `armourSet`, or nullptr if it isn't one of this NPC's outfits.
+        template <typename Defaults>
+        const std::string* findOutfitPresetUUID(const OutfitPresetTable<Defaults>& table, const Defaults& defaults, const ArmourSet& armourSet) {
+            const auto it = table.find(armourSet.name);
+            return it != table.end() ? &(defaults.*(it->second)) : nullptr;
+        }
+
+    }
+
     const Preset* KBFDataManager::getActivePreset(NpcType npcId, bool female, const ArmourSet& armourSet, ArmourPiece piece) const {
         switch (npcId) {
         // ---- Core NPCs Mapping ----
         case NpcType::NPC_TYPE_ALMA: {
             if (!(ArmourDataManager::get().getResidentArmourPieces(armourSet) & ArmourPieceFlagBits::APF_BODY)) return nullptr;
-            
-            std::string presetUUID = "";
-            if      (armourSet.name == ALMAS_HANDLER_OUTFIT_NAME            ) presetUUID = presetDefaults.alma.handlersOutfit;
-            else if	(armourSet.name == ALMAS_SCRIVENERS_COAT_NAME           ) presetUUID = presetDefaults.alma.scrivenersCoat;
-            else if	(armourSet.name == ALMAS_SPRING_BLOSSOM_KIMONO_NAME     ) presetUUID = presetDefaults.alma.springBlossomKimono;
-            else if	(armourSet.name == ALMAS_SUMMER_PONCHO_NAME             ) presetUUID = presetDefaults.alma.summerPoncho;
-            else if	(armourSet.name == ALMAS_NEW_WORLD_COMMISSION_NAME      ) presetUUID = presetDefaults.alma.newWorldCommission;
-            else if	(armourSet.name == ALMAS_CHUN_LI_OUTFIT_NAME            ) presetUUID = presetDefaults.alma.chunLiOutfit;
-            else if (armourSet.name == ALMAS_CAMMY_OUTFIT_NAME              ) presetUUID = presetDefaults.alma.cammyOutfit;
-            else if	(armourSet.name == ALMAS_AUTUMN_WITCH_OUTFIT_NAME       ) presetUUID = presetDefaults.alma.autumnWitch;
-			else if (armourSet.name == ALMAS_FEATHERSKIRT_SEIKRET_DRESS_NAME) presetUUID = presetDefaults.alma.featherskirtSeikretDress;
 
-            return getPresetByUUID(presetUUID);
+            const std::string* presetUUID = findOutfitPresetUUID(almaOutfitPresets(), presetDefaults.alma, armourSet);
+            return presetUUID ? getPresetByUUID(*presetUUID) : nullptr;
         }
         case NpcType::NPC_TYPE_GEMMA: {
             if (!(ArmourDataManager::get().getResidentArmourPieces(armourSet) & ArmourPieceFlagBits::APF_BODY)) return nullptr;
 
-            std::string presetUUID = "";
-            if      (armourSet.name == GEMMAS_SMITHYS_OUTFIT_NAME       ) presetUUID = presetDefaults.gemma.smithysOutfit;
-            else if	(armourSet.name == GEMMAS_SUMMER_COVERALLS_NAME     ) presetUUID = presetDefaults.gemma.summerCoveralls;
-			else if (armourSet.name == GEMMAS_REDVEIL_SEIKRET_DRESS_NAME) presetUUID = presetDefaults.gemma.redveilSeikretDress;
-
-            return getPresetByUUID(presetUUID);
+            const std::string* presetUUID = findOutfitPresetUUID(gemmaOutfitPresets(), presetDefaults.gemma, armourSet);
+            return presetUUID ? getPresetByUUID(*presetUUID) : nullptr;
         }
         case NpcType::NPC_TYPE_ERIK: {
             if (!(ArmourDataManager::get().getResidentArmourPieces(armourSet) & ArmourPieceFlagBits::APF_BODY)) return nullptr;
 
-            std::string presetUUID = "";
-            if      (armourSet.name == ERIKS_HANDLERS_OUTFIT_NAME         ) presetUUID = presetDefaults.erik.handlersOutfit;
-            else if (armourSet.name == ERIKS_SUMMER_HAT_NAME              ) presetUUID = presetDefaults.erik.summerHat;
-            else if	(armourSet.name == ERIKS_AUTUMN_THERIAN_NAME          ) presetUUID = presetDefaults.erik.autumnTherian;
-			else if (armourSet.name == ERIKS_CRESTCOLLAR_SEIKRET_SUIT_NAME) presetUUID = presetDefaults.erik.crestcollarSeikretSuit;
-
-            return getPresetByUUID(presetUUID);
+            const std::string* presetUUID = findOutfitPresetUUID(erikOutfitPresets(), presetDefaults.erik, armourSet);
+            return presetUUID ? getPresetByUUID(*presetUUID) : nullptr;
         }
         // ---- Support Hunters Mapping ----
         // TODO: For now all support hunters have only one outfit mapping. If this ever changes (likely will, at least for olivia), you'll have to add proper logic here.
@@ -1032,6 +1064,84 @@ namespace kbf {
         return counts;
     }
 
+    namespace {
+
+        size_t presetPieceSettingsBytes(const PresetPieceSettings& settings) {
+            return footprint::treeContainerBytes(settings.modifiers, [](const auto& entry) {
+                    return footprint::stringBytes(entry.first);
+                })
+                + footprint::treeContainerBytes(settings.partOverrides, [](const OverrideMeshPart& part) {
+                    return footprint::meshPartBytes(part.part);
+                })
+                + footprint::treeContainerBytes(settings.materialOverrides, [](const OverrideMaterial& material) {
+                    return footprint::meshMaterialBytes(material.material)
+                        + footprint::hashContainerBytes(material.paramOverrides, [](const auto& entry) { return footprint::stringBytes(entry.first); });
+                });
+        }
+
+        template <typename T>
+        size_t quickMaterialOverridesBytes(const std::unordered_map<std::string, QuickMaterialOverride<T>>& overrides) {
+            return footprint::hashContainerBytes(overrides, [](const auto& entry) {
+                return footprint::stringBytes(entry.first)
+                    + footprint::stringBytes(entry.second.materialName)
+                    + footprint::stringBytes(entry.second.paramName);
+            });
+        }
+
+        size_t presetBytes(const Preset& preset) {
+            size_t bytes = footprint::stringBytes(preset.uuid)
+                + footprint::stringBytes(preset.name)
+                + footprint::stringBytes(preset.bundle)
+                + footprint::armourSetBytes(preset.armour)
+                + quickMaterialOverridesBytes(preset.quickMaterialOverridesFloat)
+                + quickMaterialOverridesBytes(preset.quickMaterialOverridesVec4)
+                + footprint::metadataBytes(preset.metadata);
+
+            for (const PresetPieceSettings* settings : { &preset.set, &preset.helm, &preset.body, &preset.arms, &preset.coil, &preset.legs }) {
+                bytes += presetPieceSettingsBytes(*settings);
+            }
+            return bytes;
+        }
+
+        size_t presetGroupBytes(const PresetGroup& group) {
+            size_t bytes = footprint::stringBytes(group.uuid) + footprint::stringBytes(group.name) + footprint::metadataBytes(group.metadata);
+
+            for (const auto* assigned : {
+                &group.setPresets,  &group.helmPresets, &group.bodyPresets,  &group.armsPresets,
+                &group.coilPresets, &group.legsPresets, &group.partsPresets, &group.matsPresets
+            }) {
+                bytes += footprint::hashContainerBytes(*assigned, [](const auto& entry) {
+                    return footprint::armourSetBytes(entry.first) + footprint::stringBytes(entry.second);
+                });
+            }
+            return bytes;
+        }
+
+    }
+
+    MemoryFootprint KBFDataManager::getMemoryFootprint() const {
+        MemoryFootprint report{ "Data Manager", 0, sizeof(*this) };
+
+        report.add(MemoryFootprint{ "Presets", presets.size(), footprint::hashContainerBytes(presets, [](const auto& entry) {
+            return footprint::stringBytes(entry.first) + presetBytes(entry.second);
+        }) });
+        report.add(MemoryFootprint{ "Preset Groups", presetGroups.size(), footprint::hashContainerBytes(presetGroups, [](const auto& entry) {
+            return footprint::stringBytes(entry.first) + presetGroupBytes(entry.second);
+        }) });
+        report.add(MemoryFootprint{ "Player Overrides", playerOverrides.size(), footprint::hashContainerBytes(playerOverrides, [](const auto& entry) {
+            return footprint::playerDataBytes(entry.first)
+                + footprint::playerDataBytes(entry.second.player)
+                + footprint::stringBytes(entry.second.presetGroup)
+                + footprint::metadataBytes(entry.second.metadata);
+        }) });
+
+        report.add(m_boneCacheManager.getMemoryFootprint());
+        report.add(m_partCacheManager.getMemoryFootprint());
+        report.add(m_matCacheManager.getMemoryFootprint());
+
+        return report;
+    }
+
     void KBFDataManager::verifyDirectoriesExist() const {
         createDirectoryIfNotExists(dataBasePath);
         createDirectoryIfNotExists(defaultConfigsPath);
@@ -1168,6 +1278,7 @@ namespace kbf {
         parseFloat(config, SETTINGS_APPLICATION_RANGE_ID, SETTINGS_APPLICATION_RANGE_ID, &out->applicationRange);
         parseInt(config, SETTINGS_MAX_CONCURRENT_APPLICATIONS_ID, SETTINGS_MAX_CONCURRENT_APPLICATIONS_ID, &out->maxConcurrentApplications);
         parseInt(config, SETTINGS_MAX_BONE_FETCHES_PER_FRAME_ID, SETTINGS_MAX_BONE_FETCHES_PER_FRAME_ID, &out->maxBoneFetchesPerFrame);
+        parseInt(config, SETTINGS_POINTER_RECHECK_INTERVAL_ID, SETTINGS_POINTER_RECHECK_INTERVAL_ID, &out->pointerRecheckInterval);
         parseBool(config, SETTINGS_ENABLE_DURING_QUESTS_ONLY_ID, SETTINGS_ENABLE_DURING_QUESTS_ONLY_ID, &out->enableDuringQuestsOnly);
         parseBool(config, SETTINGS_ENABLE_HIDE_WEAPONS_ID, SETTINGS_ENABLE_HIDE_WEAPONS_ID, &out->enableHideWeapons);
 		parseBool(config, SETTINGS_ENABLE_HIDE_KINSECT_ID, SETTINGS_ENABLE_HIDE_KINSECT_ID, &out->enableHideKinsect);
@@ -1177,6 +1288,12 @@ namespace kbf {
         parseBool(config, SETTINGS_HIDE_WEAPONS_OUTSIDE_OF_COMBAT_ONLY_ID, SETTINGS_HIDE_WEAPONS_OUTSIDE_OF_COMBAT_ONLY_ID, &out->hideWeaponsOutsideOfCombatOnly);
         parseBool(config, SETTINGS_HIDE_SLINGER_OUTSIDE_OF_COMBAT_ONLY_ID, SETTINGS_HIDE_SLINGER_OUTSIDE_OF_COMBAT_ONLY_ID, &out->hideSlingerOutsideOfCombatOnly);
         parseBool(config, SETTINGS_ENABLE_PROFILING_ID, SETTINGS_ENABLE_PROFILING_ID, &out->enableProfiling);
+        parseBool(config, SETTINGS_ENABLE_ADAPTIVE_BUDGET_ID, SETTINGS_ENABLE_ADAPTIVE_BUDGET_ID, &out->enableAdaptiveBudget);
+        parseFloat(config, SETTINGS_ADAPTIVE_BUDGET_US_ID, SETTINGS_ADAPTIVE_BUDGET_US_ID, &out->adaptiveBudgetUs);
+        parseInt(config, SETTINGS_ADAPTIVE_MIN_CONCURRENT_APPLICATIONS_ID, SETTINGS_ADAPTIVE_MIN_CONCURRENT_APPLICATIONS_ID, &out->adaptiveMinConcurrentApplications);
+        parseInt(config, SETTINGS_ADAPTIVE_MIN_BONE_FETCHES_PER_FRAME_ID, SETTINGS_ADAPTIVE_MIN_BONE_FETCHES_PER_FRAME_ID, &out->adaptiveMinBoneFetchesPerFrame);
+        parseFloat(config, SETTINGS_ADAPTIVE_MIN_APPLICATION_RANGE_ID, SETTINGS_ADAPTIVE_MIN_APPLICATION_RANGE_ID, &out->adaptiveMinApplicationRange);
+        parseBool(config, SETTINGS_ENABLE_PERSISTENT_LOG_ID, SETTINGS_ENABLE_PERSISTENT_LOG_ID, &out->enablePersistentLog);
 
         DEBUG_STACK.push(std::format("{} Loaded Settings from {}", KBF_DATA_MANAGER_LOG_TAG, settingsPath.string()), DebugStack::Color::COL_SUCCESS);
         return true;
@@ -1201,6 +1318,8 @@ namespace kbf {
         writer.Int(settings.maxConcurrentApplications);
         writer.Key(SETTINGS_MAX_BONE_FETCHES_PER_FRAME_ID);
         writer.Int(settings.maxBoneFetchesPerFrame);
+        writer.Key(SETTINGS_POINTER_RECHECK_INTERVAL_ID);
+        writer.Int(settings.pointerRecheckInterval);
         writer.Key(SETTINGS_ENABLE_DURING_QUESTS_ONLY_ID);
         writer.Bool(settings.enableDuringQuestsOnly);
 		writer.Key(SETTINGS_ENABLE_HIDE_WEAPONS_ID);
@@ -1219,6 +1338,18 @@ namespace kbf {
         writer.Bool(settings.hideSlingerOutsideOfCombatOnly);
         writer.Key(SETTINGS_ENABLE_PROFILING_ID);
         writer.Bool(settings.enableProfiling);
+        writer.Key(SETTINGS_ENABLE_ADAPTIVE_BUDGET_ID);
+        writer.Bool(settings.enableAdaptiveBudget);
+        writer.Key(SETTINGS_ADAPTIVE_BUDGET_US_ID);
+        writer.Double(settings.adaptiveBudgetUs);
+        writer.Key(SETTINGS_ADAPTIVE_MIN_CONCURRENT_APPLICATIONS_ID);
+        writer.Int(settings.adaptiveMinConcurrentApplications);
+        writer.Key(SETTINGS_ADAPTIVE_MIN_BONE_FETCHES_PER_FRAME_ID);
+        writer.Int(settings.adaptiveMinBoneFetchesPerFrame);
+        writer.Key(SETTINGS_ADAPTIVE_MIN_APPLICATION_RANGE_ID);
+        writer.Double(settings.adaptiveMinApplicationRange);
+        writer.Key(SETTINGS_ENABLE_PERSISTENT_LOG_ID);
+        writer.Bool(settings.enablePersistentLog);
         writer.EndObject();
 
         bool success = writeJsonFile(settingsPath.string(), s.GetString());
@@ -1700,6 +1831,7 @@ namespace kbf {
             std::vector<OverrideMeshPart> parts;
             parsed &= loadOverrideParts(removedParts, &parts);
             out->partOverrides = std::set<OverrideMeshPart>(parts.begin(), parts.end());
+            out->markPartOverridesEdited();
         }
 
         parsed &= parseObject(object, PRESET_OVERRIDE_MATERIALS_OVERRIDES_ID, PRESET_OVERRIDE_MATERIALS_OVERRIDES_ID);
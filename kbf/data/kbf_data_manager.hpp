@@ -13,6 +13,7 @@
 #include <kbf/data/preset/preset_defaults.hpp>
 #include <kbf/data/formats/kbf_file_data.hpp>
 #include <kbf/data/formats/kbf_settings.hpp>
+#include <kbf/debug/memory_footprint.hpp>
 
 #include <rapidjson/document.h>
 #include <rapidjson/prettywriter.h>
@@ -25,7 +26,7 @@
 
 namespace kbf {
 
-	class KBFDataManager {
+	class KBFDataManager : public iMemoryReporter {
 	public:
 		KBFDataManager(const std::string& path, const std::string& fbsPath) 
 			: dataBasePath{ std::filesystem::absolute(path) }, fbsPath{ std::filesystem::absolute(fbsPath) } {}
@@ -148,6 +149,9 @@ namespace kbf {
 		};
 		std::unordered_map<std::string, ModArchiveCounts> getModArchiveInfo() const;
 
+		// Presets, preset groups, player overrides & the bone / part / material caches.
+		MemoryFootprint getMemoryFootprint() const override;
+
 		KBFSettings& settings() { return m_settings; }
 		bool loadSettings(KBFSettings* out);
 		bool loadSettings() { return loadSettings(&m_settings); }
@@ -161,6 +165,7 @@ namespace kbf {
 		const std::filesystem::path presetGroupPath    = dataBasePath / "PresetGroups";
 		const std::filesystem::path playerOverridePath = dataBasePath / "PlayerOverrides";
 		const std::filesystem::path exportsPath        = dataBasePath / "Exports";
+		const std::filesystem::path logsPath           = dataBasePath / "Logs";
 
 		const std::filesystem::path almaConfigPath          = defaultConfigsPath / "alma.json";
 		const std::filesystem::path erikConfigPath          = defaultConfigsPath / "erik.json";
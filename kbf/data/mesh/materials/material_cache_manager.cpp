@@ -216,5 +216,12 @@ namespace kbf {
 		return buf;
 	}
 
+	size_t MaterialCacheManager::getCacheHeapBytes(const MaterialCache& cache) const {
+		size_t bytes = 0;
+		for (const HashedMaterialList* list : { &cache.helm, &cache.body, &cache.arms, &cache.coil, &cache.legs }) {
+			bytes += footprint::vectorBytes(list->getMaterials(), footprint::meshMaterialBytes);
+		}
+		return bytes;
+	}
 
 }
\ No newline at end of file
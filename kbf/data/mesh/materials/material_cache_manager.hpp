@@ -20,6 +20,7 @@ namespace kbf {
 		bool loadMaterialCacheList(const rapidjson::Value& object, std::vector<MeshMaterial>& out) const;
 
 		bool writeCacheJson(const std::filesystem::path& path, const MaterialCache& out) const override;
+		size_t getCacheHeapBytes(const MaterialCache& cache) const override;
 		void writeMaterialCacheData(
 			std::string id,
 			std::string hashId,
@@ -189,5 +189,12 @@ namespace kbf {
 		return buf;
 	}
 
+	size_t PartCacheManager::getCacheHeapBytes(const PartCache& cache) const {
+		size_t bytes = 0;
+		for (const HashedPartList* list : { &cache.set, &cache.helm, &cache.body, &cache.arms, &cache.coil, &cache.legs }) {
+			bytes += footprint::vectorBytes(list->getParts(), footprint::meshPartBytes);
+		}
+		return bytes;
+	}
 
 }
\ No newline at end of file
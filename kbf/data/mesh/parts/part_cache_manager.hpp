@@ -19,6 +19,7 @@ namespace kbf {
 		bool loadPartCacheList(const rapidjson::Value& object, std::vector<MeshPart>& out) const;
 
 		bool writeCacheJson(const std::filesystem::path& path, const PartCache& out) const override;
+		size_t getCacheHeapBytes(const PartCache& cache) const override;
 		void writePartCacheData(
 			std::string id,
 			std::string hashId,
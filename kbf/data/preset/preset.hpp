@@ -70,7 +70,9 @@ namespace kbf {
 			return match;
 		}
 
-		PresetPieceSettings getPieceSettings(ArmourPiece piece) const {
+		// By reference - applying reads these every frame, & apply commands point into them.
+		const PresetPieceSettings& getPieceSettings(ArmourPiece piece) const {
+			static const PresetPieceSettings empty{};
 			switch (piece)
 			{
 			case ArmourPiece::AP_SET:  return set;
@@ -79,7 +81,7 @@ namespace kbf {
 			case ArmourPiece::AP_ARMS: return arms;
 			case ArmourPiece::AP_COIL: return coil;
 			case ArmourPiece::AP_LEGS: return legs;
-			default:                   return {};
+			default:                   return empty;
 			}
 		}
 
@@ -4,6 +4,8 @@
 #include <kbf/data/preset/override_mesh_part.hpp>
 #include <kbf/data/preset/override_material.hpp>
 
+#include <atomic>
+#include <cstdint>
 #include <set>
 #include <map>
 #include <unordered_map>
@@ -22,6 +24,18 @@ namespace kbf {
 		std::set<OverrideMeshPart> partOverrides;
 		std::set<OverrideMaterial> materialOverrides;
 
+		// Changes whenever partOverrides is edited (markPartOverridesEdited), so masks compiled from it (PartManager)
+		//  know they're stale without hashing it. Drawn from one counter, so no two edits ever share a generation - a
+		//  copy keeps its source's, as it has the same overrides. Not part of ==.
+		uint64_t partOverridesGeneration = nextPartOverridesGeneration();
+
+		void markPartOverridesEdited() { partOverridesGeneration = nextPartOverridesGeneration(); }
+
+		static uint64_t nextPartOverridesGeneration() {
+			static std::atomic<uint64_t> next{ 1 };
+			return next.fetch_add(1, std::memory_order_relaxed);
+		}
+
 		bool operator==(const PresetPieceSettings& other) const {
 			return (
 				modifiers == other.modifiers &&
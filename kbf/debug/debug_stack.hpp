@@ -1,12 +1,19 @@
 #pragma once
 
 #include <kbf/debug/log_data.hpp>
+#include <kbf/debug/log_args.hpp>
+#include <kbf/debug/memory_footprint.hpp>
 
+#include <atomic>
+#include <bit>
+#include <cstring>
 #include <deque>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <chrono>
 #include <mutex>
+#include <thread>
 #include <format>
 #include <sstream>
 #include <iomanip>
@@ -14,6 +21,21 @@
 
 #undef ERROR
 
+// Entries below this level are compiled out of DEBUG_STACK_LOG entirely, arguments included.
+//  0 = Debug, 1 = Info, 2 = Success, 3 = Warning, 4 = Error (see DebugStack::severity).
+#ifndef KBF_LOG_MIN_LEVEL
+#define KBF_LOG_MIN_LEVEL 0
+#endif
+
+// Log through DEBUG_STACK, skipping argument evaluation when the level is disabled at compile time or runtime.
+//  Prefer this over fpush on hot paths where the arguments themselves are costly (e.g. REInvokeStr).
+#define DEBUG_STACK_LOG(colour, ...)                                                        \
+    do {                                                                                    \
+        if constexpr (::kbf::DebugStack::isCompiledIn(colour)) {                            \
+            if (::kbf::DEBUG_STACK.isEnabled(colour)) ::kbf::DEBUG_STACK.fpush(colour, __VA_ARGS__); \
+        }                                                                                   \
+    } while (0)
+
 namespace kbf {
 
     // ------------------------------------------------------------
@@ -35,9 +57,18 @@ namespace kbf {
     // ------------------------------------------------------------
     // DebugStack
     // ------------------------------------------------------------
-    class DebugStack {
+    // Pushes go into a fixed ring of plain-byte slots - producers claim a slot with one atomic add and never block
+    //  each other. fpush stores the format string & packed arguments rather than the message; formatting happens
+    //  when the log is read (debug tab, crash dump), which moves new entries into a formatted cache of `limit` entries.
+    //  Background sinks (PersistentLog) follow the ring with their own cursor via readFrom.
+    //  Slots not read before the ring wraps are overwritten, as the oldest entries were dropped before. Messages too long
+    //  for a slot (object property dumps, etc.) are rare enough to go through a small locked side list instead.
+    class DebugStack : public iMemoryReporter {
     public:
-        DebugStack(size_t limit) : limit{ limit } {}
+        DebugStack(size_t limit)
+            : limit{ limit },
+              capacity{ std::bit_ceil(std::max<size_t>(limit, 2)) },
+              slots{ std::make_unique<Slot[]>(capacity) } {}
 
         enum class Color {
             COL_ERROR,
@@ -61,7 +92,7 @@ namespace kbf {
             return { 1.0f, 1.0f, 1.0f };
         }
 
-        static std::string getColorTypeAsString(DebugStack::Color col) {
+        static constexpr std::string_view getColorTypeName(DebugStack::Color col) {
             switch (col) {
             case DebugStack::Color::COL_ERROR:   return "ERROR";
             case DebugStack::Color::COL_WARNING: return "WARNING";
@@ -72,6 +103,10 @@ namespace kbf {
             return "UNKNOWN";
         }
 
+        static std::string getColorTypeAsString(DebugStack::Color col) {
+            return std::string(getColorTypeName(col));
+        }
+
         static DebugStack::Color getColorType(glm::vec3 col) {
             if (col == getColor(DebugStack::Color::COL_ERROR))   return DebugStack::Color::COL_ERROR;
             if (col == getColor(DebugStack::Color::COL_WARNING)) return DebugStack::Color::COL_WARNING;
@@ -82,55 +117,96 @@ namespace kbf {
         }
 
         // ------------------------------------------------------------
-        // Old push API
+        // Levels
         // ------------------------------------------------------------
-        void push(LogData logData) {
-            std::lock_guard<std::mutex> lock(mux);
-            stack.push_back(std::move(logData));
-
-            if (stack.size() > limit && !stack.empty()) {
-                stack.pop_front();
+        static constexpr int severity(DebugStack::Color col) {
+            switch (col) {
+            case DebugStack::Color::COL_DEBUG:   return 0;
+            case DebugStack::Color::COL_INFO:    return 1;
+            case DebugStack::Color::COL_SUCCESS: return 2;
+            case DebugStack::Color::COL_WARNING: return 3;
+            case DebugStack::Color::COL_ERROR:   return 4;
             }
+            return 1;
         }
 
-        void push(std::string message, DebugStack::Color colour = DebugStack::Color::COL_DEBUG) {
-            push(LogData{ message, getColor(colour), DebugStack::now() });
+        static constexpr bool isCompiledIn(DebugStack::Color col) { return severity(col) >= KBF_LOG_MIN_LEVEL; }
+
+        bool isEnabled(DebugStack::Color col) const {
+            return isCompiledIn(col) && severity(col) >= minSeverity.load(std::memory_order_relaxed);
         }
 
-        void pop() {
-            std::lock_guard<std::mutex> lock(mux);
-            if (!stack.empty()) stack.pop_front();
+        // Entries below this level are dropped when pushed, before any formatting or copying.
+        void setMinLevel(DebugStack::Color col) { minSeverity.store(severity(col), std::memory_order_relaxed); }
+        int  getMinSeverity() const { return minSeverity.load(std::memory_order_relaxed); }
+
+        // ------------------------------------------------------------
+        // Old push API
+        // ------------------------------------------------------------
+        void push(LogData logData) {
+            const DebugStack::Color colour = getColorType(logData.colour);
+            if (!isEnabled(colour)) return;
+            pushText(colour, {}, logData.data, logData.timestamp);
         }
 
-        const LogData& peek() const {
-            std::lock_guard<std::mutex> lock(mux);
-            return stack.back();
+        void push(std::string_view message, DebugStack::Color colour = DebugStack::Color::COL_DEBUG) {
+            if (!isEnabled(colour)) return;
+            pushText(colour, {}, message, DebugStack::now());
         }
 
         void clear() {
-            std::lock_guard<std::mutex> lock(mux);
-            stack.clear();
+            std::lock_guard<std::mutex> lock(readMux);
+            readIdx = writeIdx.load(std::memory_order_acquire);
+            cache.clear();
+
+            std::lock_guard<std::mutex> overflowLock(overflowMux);
+            overflowMessages.clear();
         }
 
         bool empty() const {
-            std::lock_guard<std::mutex> lock(mux);
-            return stack.empty();
+            std::lock_guard<std::mutex> lock(readMux);
+            return cache.empty() && readIdx == writeIdx.load(std::memory_order_acquire);
         }
 
-        auto begin() { return stack.begin(); }
-        auto end() { return stack.end(); }
+        // Entries overwritten in the ring before they were read.
+        size_t getDroppedCount() const { return droppedEntries.load(std::memory_order_relaxed); }
 
-        auto begin() const { return stack.begin(); }
-        auto end()   const { return stack.end(); }
+        // Formats any new entries, then visits every cached entry (oldest first) with the reader lock held.
+        template <typename Fn>
+        void forEach(Fn&& fn) {
+            std::lock_guard<std::mutex> lock(readMux);
+            drain();
+            for (const LogData& log : cache) fn(log);
+        }
+
+        // Visits entries committed since `cursor` (oldest first) and advances it, without touching the formatted cache
+        //  - for sinks that follow the log on their own thread. Returns how many entries the ring overwrote before the
+        //  cursor reached them. Start a new cursor at 0 to pick up everything still in the ring.
+        template <typename Fn>
+        size_t readFrom(uint64_t& cursor, Fn&& fn) const {
+            return readCommitted(cursor, [&](uint64_t idx, const EntryHeader& header, const char* payload) {
+                fn(decode(idx, header, payload));
+            });
+        }
+
+        MemoryFootprint getMemoryFootprint() const override {
+            std::lock_guard<std::mutex> lock(readMux);
+            std::lock_guard<std::mutex> overflowLock(overflowMux);
+            const size_t bytes = sizeof(*this)
+                + capacity * sizeof(Slot)
+                + footprint::dequeBytes(cache, [](const LogData& log) { return footprint::stringBytes(log.data); })
+                + footprint::dequeBytes(overflowMessages, [](const auto& entry) { return footprint::stringBytes(entry.second); });
+            return MemoryFootprint{ "Debug Log", cache.size(), bytes };
+        }
 
         static inline std::chrono::system_clock::time_point now() noexcept {
             return std::chrono::system_clock::now();
         }
 
-        std::string string() const {
+        std::string string() {
             std::string result;
 
-            for (const auto& log : stack) {
+            forEach([&](const LogData& log) {
                 auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(
                     log.timestamp.time_since_epoch()
                 ).count();
@@ -159,13 +235,62 @@ namespace kbf {
                     getColorTypeAsString(getColorType(log.colour)),
                     log.data
                 );
-            }
+            });
 
             return result;
         }
 
+        // Crash handler only - string() locks the reader & formats, which can deadlock on a lock the faulting thread
+        //  holds or fault again on a bad argument. This hands `sink` one null-terminated line per entry from a stack
+        //  buffer instead, never allocating or formatting. The reader lock is only taken if it frees up within a short
+        //  spin: then the already formatted entries are written first. Anything else is written raw from the ring, with
+        //  deferred entries as their unformatted format string. Times are UTC, as converting to local time can lock.
+        template <typename Sink>
+        void dumpForCrash(Sink&& sink) {
+            constexpr int LOCK_ATTEMPTS = 64;
+
+            bool locked = false;
+            for (int attempt = 0; attempt < LOCK_ATTEMPTS && !locked; attempt++) {
+                locked = readMux.try_lock();
+                if (!locked) std::this_thread::yield();
+            }
+
+            CrashLine line;
+            uint64_t cursor = 0;
+            if (locked) {
+                for (const LogData& log : cache) {
+                    line.begin(log.timestamp.time_since_epoch().count(), getColorType(log.colour));
+                    line.append(log.data);
+                    sink(line.c_str());
+                }
+                cursor = readIdx;
+            }
+            else {
+                sink("[Debug log reader busy - the entries below are unformatted]");
+            }
+
+            readCommitted(cursor, [&](uint64_t, const EntryHeader& header, const char* payload) {
+                line.begin(header.ticks, header.colour);
+                if (header.tagLength > 0) {
+                    line.append(std::string_view(header.tag, header.tagLength));
+                    line.append(" ");
+                }
+
+                if (header.format != nullptr) {
+                    line.append(std::string_view(header.fmt, header.fmtLength));
+                    line.append(" [arguments not formatted]");
+                }
+                else if (header.overflow) line.append("[long message not dumped]");
+                else                      line.append(std::string_view(payload, std::min<size_t>(header.payloadSize, PAYLOAD_SIZE)));
+
+                sink(line.c_str());
+            }, true);
+
+            if (locked) readMux.unlock();
+        }
+
         // ------------------------------------------------------------
-        // fpush API  new formatted/tagged logging
+        // fpush API - deferred formatted/tagged logging
         // ------------------------------------------------------------
 
         // Helper: format string
@@ -189,11 +314,7 @@ namespace kbf {
 
         template <typename... Args>
         void fpush(Color color, std::format_string<Args...> fmt, Args&&... args) {
-            push(LogData{
-                std::format(fmt, std::forward<Args>(args)...),
-                getColor(color),
-                now()
-                });
+            pushDeferred(color, {}, fmt.get(), args...);
         }
 
         // -------------------
@@ -206,20 +327,243 @@ namespace kbf {
 
         template <FixedString Tag, typename... Args>
         void fpush(Color color, std::format_string<Args...> fmt, Args&&... args) {
-            std::string message = std::format(
-                "{} {}",
-                std::string_view(Tag),
-                std::format(fmt, std::forward<Args>(args)...)
-            );
-            push(LogData{ std::move(message), getColor(color), now() });
+            // Template parameter objects have static storage, so the tag can be referenced from the entry.
+            pushDeferred(color, std::string_view(Tag), fmt.get(), args...);
         }
 
     private:
-        mutable std::mutex mux;
-        size_t limit;
-        std::deque<LogData> stack{};
+        struct EntryHeader {
+            int64_t               ticks = 0;
+            log_args::FormatFn    format = nullptr; // nullptr when the payload holds the finished message
+            const char*           fmt = nullptr;
+            const char*           tag = nullptr;
+            uint32_t              fmtLength = 0;
+            uint16_t              tagLength = 0;
+            uint16_t              payloadSize = 0;
+            DebugStack::Color     colour = DebugStack::Color::COL_DEBUG;
+            bool                  overflow = false; // Message is in the overflow list, keyed by entry index
+        };
+
+        static constexpr size_t SLOT_SIZE    = 384;
+        static constexpr size_t MAX_OVERFLOW = 256;
+        static constexpr size_t PAYLOAD_SIZE = SLOT_SIZE - sizeof(std::atomic<uint64_t>) - sizeof(EntryHeader);
+
+        // seq is 2 * index + 1 while the entry for `index` is being written, and 2 * index + 2 once it's complete.
+        struct Slot {
+            std::atomic<uint64_t> seq{ 0 };
+            EntryHeader header{};
+            char payload[PAYLOAD_SIZE];
+        };
+
+        // Fixed size line for dumpForCrash - long messages are truncated rather than allocated for.
+        class CrashLine {
+        public:
+            void begin(int64_t ticks, DebugStack::Color colour) {
+                length = 0;
+
+                using namespace std::chrono;
+                const int64_t dayMs = duration_cast<milliseconds>(system_clock::duration(ticks)).count() % (24 * 60 * 60 * 1000);
+                append("[");
+                appendNumber(dayMs / (60 * 60 * 1000), 2);
+                append(":");
+                appendNumber(dayMs / (60 * 1000) % 60, 2);
+                append(":");
+                appendNumber(dayMs / 1000 % 60, 2);
+                append(".");
+                appendNumber(dayMs % 1000, 3);
+                append(" UTC] [");
+                append(getColorTypeName(colour));
+                append("] ");
+            }
+
+            void append(std::string_view str) {
+                const size_t count = std::min(str.size(), sizeof(text) - 1 - length);
+                std::memcpy(text + length, str.data(), count);
+                length += count;
+                text[length] = '\0';
+            }
+
+            void appendNumber(int64_t value, int width) {
+                char digits[20];
+                int  count = 0;
+                uint64_t remaining = value < 0 ? 0 : static_cast<uint64_t>(value);
+                do {
+                    digits[count++] = static_cast<char>('0' + remaining % 10);
+                    remaining /= 10;
+                } while (remaining != 0 && count < static_cast<int>(sizeof(digits)));
+                while (count < width && count < static_cast<int>(sizeof(digits))) digits[count++] = '0';
+
+                std::reverse(digits, digits + count);
+                append(std::string_view(digits, count));
+            }
+
+            const char* c_str() const { return text; }
+
+        private:
+            char   text[SLOT_SIZE + 128] = {};
+            size_t length = 0;
+        };
+
+        template <typename... Args>
+        void pushDeferred(DebugStack::Color colour, std::string_view tag, std::string_view fmt, const Args&... args) {
+            if (!isEnabled(colour)) return;
+
+            if constexpr ((log_args::isPackable<Args> && ...)) {
+                if (log_args::packedSize(args...) <= PAYLOAD_SIZE) {
+                    write(colour, tag, now(), [&](uint64_t, EntryHeader& header, char* payload) {
+                        log_args::PayloadWriter writer{ payload, PAYLOAD_SIZE };
+                        (writer.write(args), ...);
+
+                        header.format      = &log_args::formatPacked<log_args::StoredType<Args>...>;
+                        header.fmt         = fmt.data();
+                        header.fmtLength   = static_cast<uint32_t>(fmt.size());
+                        header.payloadSize = static_cast<uint16_t>(writer.size());
+                    });
+                    return;
+                }
+            }
+
+            // Arguments that can't be deferred (or don't fit a slot) are formatted now.
+            pushText(colour, tag, std::vformat(fmt, std::make_format_args(args...)), now());
+        }
+
+        void pushText(DebugStack::Color colour, std::string_view tag, std::string_view message, std::chrono::system_clock::time_point timestamp) {
+            write(colour, tag, timestamp, [&](uint64_t idx, EntryHeader& header, char* payload) {
+                if (message.size() <= PAYLOAD_SIZE) {
+                    std::memcpy(payload, message.data(), message.size());
+                    header.payloadSize = static_cast<uint16_t>(message.size());
+                    return;
+                }
+
+                std::lock_guard<std::mutex> lock(overflowMux);
+                overflowMessages.emplace_back(idx, std::string(message));
+                if (overflowMessages.size() > MAX_OVERFLOW) overflowMessages.pop_front();
+                header.overflow = true;
+            });
+        }
+
+        template <typename FillFn>
+        void write(DebugStack::Color colour, std::string_view tag, std::chrono::system_clock::time_point timestamp, FillFn&& fill) {
+            const uint64_t idx     = writeIdx.fetch_add(1, std::memory_order_relaxed);
+            const uint64_t writing = 2 * idx + 1;
+            Slot& slot = slots[idx & (capacity - 1)];
+
+            // Only contended if the ring laps a writer that's still mid-write.
+            uint64_t seq = slot.seq.load(std::memory_order_acquire);
+            while (true) {
+                if (seq > writing) {
+                    droppedEntries.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+                if ((seq & 1) == 0 && slot.seq.compare_exchange_weak(seq, writing, std::memory_order_acquire)) break;
+                if (seq & 1) {
+                    std::this_thread::yield();
+                    seq = slot.seq.load(std::memory_order_acquire);
+                }
+            }
+
+            slot.header = EntryHeader{};
+            slot.header.ticks     = timestamp.time_since_epoch().count();
+            slot.header.colour    = colour;
+            slot.header.tag       = tag.data();
+            slot.header.tagLength = static_cast<uint16_t>(tag.size());
+            fill(idx, slot.header, slot.payload);
+
+            slot.seq.store(writing + 1, std::memory_order_release);
+        }
+
+        // Reader lock held.
+        void drain() {
+            const size_t skipped = readCommitted(readIdx, [&](uint64_t idx, const EntryHeader& header, const char* payload) {
+                cache.push_back(decode(idx, header, payload));
+            });
+            droppedEntries.fetch_add(skipped, std::memory_order_relaxed);
+
+            while (cache.size() > limit) cache.pop_front();
+        }
+
+        // Stops at the first entry still being written, so it's picked up by the next read from the same cursor - unless
+        //  skipWriting, for readers that won't be back (a writer that faulted mid-entry never finishes it).
+        template <typename Fn>
+        size_t readCommitted(uint64_t& cursor, Fn&& fn, bool skipWriting = false) const {
+            size_t skipped = 0;
+
+            const uint64_t end = writeIdx.load(std::memory_order_acquire);
+            if (end - cursor > capacity) {
+                skipped += end - capacity - cursor;
+                cursor = end - capacity;
+            }
+
+            char payload[PAYLOAD_SIZE];
+            for (; cursor < end; cursor++) {
+                const Slot& slot = slots[cursor & (capacity - 1)];
+                const uint64_t committed = 2 * cursor + 2;
+
+                const uint64_t before = slot.seq.load(std::memory_order_acquire);
+                if (before < committed) {
+                    if (!skipWriting) break;
+                    skipped++;
+                    continue;
+                }
+
+                // Seqlock read - copy first, then check no writer lapped us while copying.
+                const EntryHeader header = slot.header;
+                std::memcpy(payload, slot.payload, PAYLOAD_SIZE);
+                std::atomic_thread_fence(std::memory_order_acquire);
+
+                if (before != committed || slot.seq.load(std::memory_order_relaxed) != committed) {
+                    skipped++;
+                    continue;
+                }
+
+                fn(cursor, header, payload);
+            }
+
+            return skipped;
+        }
+
+        LogData decode(uint64_t idx, const EntryHeader& header, const char* payload) const {
+            std::string message;
+            if (header.tagLength > 0) {
+                message.append(header.tag, header.tagLength);
+                message += ' ';
+            }
+
+            if (header.format != nullptr) message += header.format(std::string_view(header.fmt, header.fmtLength), payload);
+            else if (header.overflow)     message += findOverflowMessage(idx);
+            else                          message.append(payload, std::min<size_t>(header.payloadSize, PAYLOAD_SIZE));
+
+            return LogData{
+                std::move(message),
+                getColor(header.colour),
+                std::chrono::system_clock::time_point(std::chrono::system_clock::duration(header.ticks))
+            };
+        }
+
+        // Copied rather than taken, as more than one reader may decode the same entry. The list is only pruned by its cap.
+        std::string findOverflowMessage(uint64_t idx) const {
+            std::lock_guard<std::mutex> lock(overflowMux);
+            auto it = std::find_if(overflowMessages.begin(), overflowMessages.end(), [&](const auto& entry) { return entry.first == idx; });
+            if (it == overflowMessages.end()) return "[message dropped]";
+            return it->second;
+        }
+
+        const size_t limit;
+        const size_t capacity;
+        std::unique_ptr<Slot[]> slots;
+
+        std::atomic<uint64_t> writeIdx{ 0 };
+        std::atomic<size_t>   droppedEntries{ 0 };
+        std::atomic<int>      minSeverity{ 0 };
+
+        mutable std::mutex  readMux;
+        uint64_t            readIdx = 0;
+        std::deque<LogData> cache{};
+
+        mutable std::mutex overflowMux;
+        std::deque<std::pair<uint64_t, std::string>> overflowMessages{};
     };
 
-    inline DebugStack DEBUG_STACK{ 10000 };
+    inline DebugStack DEBUG_STACK{ 8192 };
 
-}
\ No newline at end of file
+}
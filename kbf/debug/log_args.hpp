@@ -0,0 +1,117 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+namespace kbf::log_args {
+
+    // Deferred log formatting - arguments are copied into a log entry's payload as raw bytes when pushed,
+    //  and only formatted when the entry is read (see DebugStack).
+
+    // Strings are stored as [u16 length][bytes] and read back as string views into the copied payload.
+    struct StringArg {};
+
+    template <typename T>
+    constexpr bool isStringLike =
+        std::is_same_v<T, std::string> ||
+        std::is_same_v<T, std::string_view> ||
+        std::is_same_v<T, const char*> ||
+        std::is_same_v<T, char*>;
+
+    // Anything else (types with custom formatters, etc.) is formatted when pushed.
+    template <typename T>
+    constexpr bool isPackable =
+        isStringLike<std::decay_t<T>> ||
+        std::is_arithmetic_v<std::decay_t<T>> ||
+        std::is_same_v<std::decay_t<T>, const void*> ||
+        std::is_same_v<std::decay_t<T>, void*>;
+
+    template <typename T>
+    using StoredType = std::conditional_t<isStringLike<std::decay_t<T>>, StringArg, std::decay_t<T>>;
+
+    template <typename T>
+    std::string_view asStringView(const T& value) {
+        if constexpr (std::is_pointer_v<T>) return value != nullptr ? std::string_view(value) : std::string_view("(null)");
+        else return std::string_view(value);
+    }
+
+    template <typename T>
+    size_t packedSize(const T& value) {
+        if constexpr (isStringLike<std::decay_t<T>>) return sizeof(uint16_t) + asStringView(value).size();
+        else return sizeof(std::decay_t<T>);
+    }
+
+    template <typename... Args>
+    size_t packedSize(const Args&... args) {
+        return (size_t{ 0 } + ... + packedSize(args));
+    }
+
+    // Callers check packedSize first - writes past the capacity are dropped.
+    class PayloadWriter {
+    public:
+        PayloadWriter(char* data, size_t capacity) : data{ data }, capacity{ capacity } {}
+
+        template <typename T>
+        void write(const T& value) {
+            if constexpr (isStringLike<std::decay_t<T>>) {
+                const std::string_view str = asStringView(value);
+                const uint16_t length = static_cast<uint16_t>(std::min<size_t>(str.size(), UINT16_MAX));
+                writeBytes(&length, sizeof(length));
+                writeBytes(str.data(), length);
+            }
+            else {
+                const std::decay_t<T> stored = value;
+                writeBytes(&stored, sizeof(stored));
+            }
+        }
+
+        size_t size() const { return pos; }
+
+    private:
+        void writeBytes(const void* bytes, size_t count) {
+            if (pos + count > capacity) return;
+            std::memcpy(data + pos, bytes, count);
+            pos += count;
+        }
+
+        char* data;
+        size_t capacity;
+        size_t pos = 0;
+    };
+
+    template <typename Stored>
+    auto read(const char*& cursor) {
+        if constexpr (std::is_same_v<Stored, StringArg>) {
+            uint16_t length = 0;
+            std::memcpy(&length, cursor, sizeof(length));
+            cursor += sizeof(length);
+            std::string_view str{ cursor, length };
+            cursor += length;
+            return str;
+        }
+        else {
+            Stored value{};
+            std::memcpy(&value, cursor, sizeof(Stored));
+            cursor += sizeof(Stored);
+            return value;
+        }
+    }
+
+    using FormatFn = std::string(*)(std::string_view fmt, const char* payload);
+
+    // One instantiation per distinct argument list - stored in the entry so the reader knows how to unpack it.
+    template <typename... Stored>
+    std::string formatPacked(std::string_view fmt, const char* payload) {
+        const char* cursor = payload;
+        // Braced initialisation evaluates left to right, matching the write order.
+        std::tuple<decltype(read<Stored>(cursor))...> values{ read<Stored>(cursor)... };
+        return std::apply([&](const auto&... unpacked) { return std::vformat(fmt, std::make_format_args(unpacked...)); }, values);
+    }
+
+}
@@ -0,0 +1,57 @@
+#include <kbf/debug/memory_footprint.hpp>
+
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+
+#include <chrono>
+#include <format>
+#include <fstream>
+
+namespace kbf {
+
+    namespace {
+
+        void writeFootprint(const MemoryFootprint& footprint, rapidjson::PrettyWriter<rapidjson::StringBuffer>& writer) {
+            writer.StartObject();
+            writer.Key("name");
+            writer.String(footprint.name.c_str());
+            writer.Key("elements");
+            writer.Uint64(footprint.elements);
+            writer.Key("bytes");
+            writer.Uint64(footprint.bytes);
+
+            if (!footprint.children.empty()) {
+                writer.Key("children");
+                writer.StartArray();
+                for (const MemoryFootprint& child : footprint.children) writeFootprint(child, writer);
+                writer.EndArray();
+            }
+            writer.EndObject();
+        }
+
+    }
+
+    bool writeMemoryFootprintJson(const std::filesystem::path& path, const MemoryFootprint& footprint) {
+        rapidjson::StringBuffer s;
+        rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(s);
+
+        const auto now = std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now());
+        const std::string timestamp = std::format("{:%Y-%m-%d %H:%M:%S}", now);
+
+        writer.StartObject();
+        writer.Key("timestamp");
+        writer.String(timestamp.c_str());
+        writer.Key("footprint");
+        writeFootprint(footprint, writer);
+        writer.EndObject();
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) return false;
+
+        file.write(s.GetString(), s.GetSize());
+        file.close();
+
+        return true;
+    }
+
+}
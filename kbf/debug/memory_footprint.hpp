@@ -0,0 +1,103 @@
+#pragma once
+
+#include <deque>
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace kbf {
+
+    // Approximate memory held by a subsystem. Parent bytes & elements include their children's.
+    struct MemoryFootprint {
+        std::string name;
+        size_t elements = 0;
+        size_t bytes    = 0;
+        std::vector<MemoryFootprint> children{};
+
+        MemoryFootprint& add(MemoryFootprint child) {
+            elements += child.elements;
+            bytes    += child.bytes;
+            children.push_back(std::move(child));
+            return children.back();
+        }
+    };
+
+    // Writes the report (and its children) as pretty-printed JSON, for diffing footprints across sessions.
+    bool writeMemoryFootprintJson(const std::filesystem::path& path, const MemoryFootprint& footprint);
+
+    // Implemented by the owners of the major long-lived containers, so the debug tab can report on them in one place.
+    class iMemoryReporter {
+    public:
+        virtual MemoryFootprint getMemoryFootprint() const = 0;
+    };
+
+    // ------------------------------------------------------------
+    // Estimation helpers
+    // ------------------------------------------------------------
+    // These return the heap bytes owned by a value, excluding sizeof(value) itself. Node overheads follow the
+    //  MSVC STL layouts & ignore allocator rounding, so treat the results as estimates - good enough to spot growth.
+    namespace footprint {
+
+        constexpr size_t LIST_NODE_OVERHEAD = 2 * sizeof(void*); // next, prev
+        constexpr size_t TREE_NODE_OVERHEAD = 4 * sizeof(void*); // left, parent, right, colour & isnil (padded)
+
+        inline size_t stringBytes(const std::string& str) {
+            static const size_t smallStringCapacity = std::string{}.capacity();
+            return str.capacity() > smallStringCapacity ? str.capacity() + 1 : 0;
+        }
+
+        template <typename T>
+        size_t vectorBytes(const std::vector<T>& vec) {
+            return vec.capacity() * sizeof(T);
+        }
+
+        inline size_t vectorBytes(const std::vector<bool>& vec) {
+            return vec.capacity() / 8;
+        }
+
+        template <typename T, typename ElementBytesFn>
+        size_t vectorBytes(const std::vector<T>& vec, ElementBytesFn&& elementBytes) {
+            size_t bytes = vectorBytes(vec);
+            for (const T& element : vec) bytes += elementBytes(element);
+            return bytes;
+        }
+
+        // Unordered maps & sets - a linked node per entry, plus a [first, last] iterator pair per bucket.
+        template <typename Container>
+        size_t hashContainerBytes(const Container& container) {
+            return container.bucket_count() * 2 * sizeof(void*)
+                + container.size() * (sizeof(typename Container::value_type) + LIST_NODE_OVERHEAD);
+        }
+
+        template <typename Container, typename EntryBytesFn>
+        size_t hashContainerBytes(const Container& container, EntryBytesFn&& entryBytes) {
+            size_t bytes = hashContainerBytes(container);
+            for (const auto& entry : container) bytes += entryBytes(entry);
+            return bytes;
+        }
+
+        // Ordered maps & sets - one tree node per entry.
+        template <typename Container>
+        size_t treeContainerBytes(const Container& container) {
+            return container.size() * (sizeof(typename Container::value_type) + TREE_NODE_OVERHEAD);
+        }
+
+        template <typename Container, typename EntryBytesFn>
+        size_t treeContainerBytes(const Container& container, EntryBytesFn&& entryBytes) {
+            size_t bytes = treeContainerBytes(container);
+            for (const auto& entry : container) bytes += entryBytes(entry);
+            return bytes;
+        }
+
+        // Deques of anything larger than 8 bytes get a block per element on MSVC, plus a slot in the block map.
+        template <typename T, typename ElementBytesFn>
+        size_t dequeBytes(const std::deque<T>& deq, ElementBytesFn&& elementBytes) {
+            size_t bytes = deq.size() * (sizeof(T) + sizeof(void*));
+            for (const T& element : deq) bytes += elementBytes(element);
+            return bytes;
+        }
+
+    }
+
+}
@@ -0,0 +1,246 @@
+#include <kbf/debug/persistent_log.hpp>
+
+#include <kbf/debug/debug_stack.hpp>
+
+#include <cstring>
+#include <format>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#define PERSISTENT_LOG_TAG "[PersistentLog]"
+
+namespace kbf {
+
+    using namespace persistent_log;
+
+    struct PersistentLog::MappedFile {
+        char*  view = nullptr;
+        size_t size = 0;
+#ifdef _WIN32
+        HANDLE file    = INVALID_HANDLE_VALUE;
+        HANDLE mapping = nullptr;
+#else
+        int fd = -1;
+#endif
+
+        FileHeader& header() { return *reinterpret_cast<FileHeader*>(view); }
+
+        // Creates (or truncates) the file at `path` and maps it at its full, zero-filled size.
+        bool open(const std::filesystem::path& path, size_t fileSize) {
+            size = fileSize;
+#ifdef _WIN32
+            file = CreateFileW(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE) return false;
+
+            const uint64_t size64 = static_cast<uint64_t>(size);
+            mapping = CreateFileMappingW(file, nullptr, PAGE_READWRITE, static_cast<DWORD>(size64 >> 32), static_cast<DWORD>(size64 & 0xFFFFFFFF), nullptr);
+            if (mapping == nullptr) { close(); return false; }
+
+            view = static_cast<char*>(MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, size));
+#else
+            fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+            if (fd < 0) return false;
+            if (ftruncate(fd, static_cast<off_t>(size)) != 0) { close(); return false; }
+
+            void* mapped = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            view = mapped == MAP_FAILED ? nullptr : static_cast<char*>(mapped);
+#endif
+            if (view == nullptr) { close(); return false; }
+            return true;
+        }
+
+        // Writes dirty pages through to disk. Not needed to survive a crash of the process, only of the machine.
+        void flush() {
+            if (view == nullptr) return;
+#ifdef _WIN32
+            FlushViewOfFile(view, 0);
+#else
+            msync(view, size, MS_SYNC);
+#endif
+        }
+
+        void close() {
+#ifdef _WIN32
+            if (view != nullptr)               UnmapViewOfFile(view);
+            if (mapping != nullptr)            CloseHandle(mapping);
+            if (file != INVALID_HANDLE_VALUE)  CloseHandle(file);
+            mapping = nullptr;
+            file    = INVALID_HANDLE_VALUE;
+#else
+            if (view != nullptr) munmap(view, size);
+            if (fd >= 0)         ::close(fd);
+            fd = -1;
+#endif
+            view = nullptr;
+        }
+    };
+
+    namespace {
+
+        inline int64_t toUnixMicros(std::chrono::system_clock::time_point timestamp) {
+            return std::chrono::duration_cast<std::chrono::microseconds>(timestamp.time_since_epoch()).count();
+        }
+
+    }
+
+    PersistentLog::PersistentLog(size_t fileSize, size_t fileCount)
+        : fileSize{ fileSize < 64 * 1024 ? 64 * 1024 : fileSize },
+          fileCount{ fileCount < 1 ? 1 : fileCount } {}
+
+    PersistentLog::~PersistentLog() {
+        stop();
+    }
+
+    void PersistentLog::start(const std::filesystem::path& directory) {
+        if (isRunning()) return;
+
+        this->directory = directory;
+        stopRequested = false;
+        running.store(true, std::memory_order_relaxed);
+        worker = std::thread([this]() { run(); });
+    }
+
+    void PersistentLog::stop() {
+        if (!isRunning()) return;
+
+        {
+            std::lock_guard<std::mutex> lock(wakeMux);
+            stopRequested = true;
+        }
+        wake.notify_all();
+
+        if (worker.joinable()) worker.join();
+        running.store(false, std::memory_order_relaxed);
+    }
+
+    void PersistentLog::flush() {
+        std::unique_lock<std::timed_mutex> lock(fileMux, std::chrono::milliseconds(100));
+        if (!lock.owns_lock() || file == nullptr) return;
+
+        persistPending();
+        file->flush();
+    }
+
+    std::filesystem::path PersistentLog::getCurrentPath() const {
+        return pathForIndex(0);
+    }
+
+    void PersistentLog::run() {
+        {
+            std::lock_guard<std::timed_mutex> lock(fileMux);
+            if (!openNewFile()) {
+                DEBUG_STACK.fpush<PERSISTENT_LOG_TAG>(DebugStack::Color::COL_ERROR, "Failed to open persistent log at {}", pathForIndex(0).string());
+            }
+        }
+
+        std::unique_lock<std::mutex> wakeLock(wakeMux);
+        while (!stopRequested) {
+            wake.wait_for(wakeLock, POLL_INTERVAL, [this]() { return stopRequested; });
+
+            wakeLock.unlock();
+            {
+                std::lock_guard<std::timed_mutex> lock(fileMux);
+                if (file != nullptr) persistPending();
+            }
+            wakeLock.lock();
+        }
+        wakeLock.unlock();
+
+        std::lock_guard<std::timed_mutex> lock(fileMux);
+        if (file != nullptr) persistPending();
+        closeFile();
+    }
+
+    // fileMux held.
+    void PersistentLog::persistPending() {
+        const size_t skipped = DEBUG_STACK.readFrom(cursor, [&](const LogData& log) { append(log); });
+        if (skipped == 0) return;
+
+        droppedRecords.fetch_add(skipped, std::memory_order_relaxed);
+        if (file != nullptr) file->header().droppedRecords += static_cast<uint32_t>(skipped);
+    }
+
+    // fileMux held.
+    void PersistentLog::append(const LogData& log) {
+        if (file == nullptr) return;
+
+        const size_t maxLength = fileSize - sizeof(FileHeader) - sizeof(RecordHeader);
+        size_t length = log.data.size();
+        if (length > UINT16_MAX) length = UINT16_MAX;
+        if (length > maxLength)  length = maxLength;
+
+        if (file->header().usedBytes + sizeof(RecordHeader) + length > file->size) {
+            closeFile();
+            rotations.fetch_add(1, std::memory_order_relaxed);
+            if (!openNewFile()) return;
+        }
+
+        RecordHeader record{};
+        record.timestampMicros = toUnixMicros(log.timestamp);
+        record.sequence        = sequence++;
+        record.length          = static_cast<uint16_t>(length);
+        record.severity        = static_cast<uint8_t>(DebugStack::severity(DebugStack::getColorType(log.colour)));
+
+        FileHeader& header = file->header();
+        char* out = file->view + header.usedBytes;
+        std::memcpy(out, &record, sizeof(RecordHeader));
+        std::memcpy(out + sizeof(RecordHeader), log.data.data(), length);
+
+        // Publish the record only once its bytes are in place, so a crash mid-append leaves the previous tail intact.
+        std::atomic_thread_fence(std::memory_order_release);
+        header.usedBytes += static_cast<uint32_t>(sizeof(RecordHeader) + length);
+        header.records++;
+
+        recordsWritten.fetch_add(1, std::memory_order_relaxed);
+        bytesWritten.fetch_add(sizeof(RecordHeader) + length, std::memory_order_relaxed);
+    }
+
+    // fileMux held.
+    bool PersistentLog::openNewFile() {
+        std::error_code ec;
+        std::filesystem::create_directories(directory, ec);
+        rotateFiles();
+
+        auto mapped = std::make_unique<MappedFile>();
+        if (!mapped->open(pathForIndex(0), fileSize)) return false;
+
+        FileHeader header{};
+        header.capacity      = static_cast<uint32_t>(fileSize);
+        header.usedBytes     = sizeof(FileHeader);
+        header.createdMicros = toUnixMicros(std::chrono::system_clock::now());
+        std::memcpy(mapped->view, &header, sizeof(FileHeader));
+
+        file = std::move(mapped);
+        return true;
+    }
+
+    // fileMux held.
+    void PersistentLog::closeFile() {
+        if (file == nullptr) return;
+        file->flush();
+        file->close();
+        file.reset();
+    }
+
+    void PersistentLog::rotateFiles() const {
+        std::error_code ec;
+        std::filesystem::remove(pathForIndex(fileCount - 1), ec);
+
+        for (size_t i = fileCount - 1; i > 0; i--) {
+            const std::filesystem::path from = pathForIndex(i - 1);
+            if (std::filesystem::exists(from, ec)) std::filesystem::rename(from, pathForIndex(i), ec);
+        }
+    }
+
+    std::filesystem::path PersistentLog::pathForIndex(size_t index) const {
+        if (index == 0) return directory / "kbf_log.kbfl";
+        return directory / std::format("kbf_log.{}.kbfl", index);
+    }
+
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <kbf/debug/log_data.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace kbf {
+
+    // ------------------------------------------------------------
+    // On-disk layout (little endian). Decode offline with debug/decode_persistent_log.py.
+    // ------------------------------------------------------------
+    //  FileHeader, then records back to back: RecordHeader followed by `length` bytes of UTF-8 text.
+    //  The file is preallocated to its cap, and `usedBytes` is only advanced once a record is fully written,
+    //  so a reader never sees a torn record - anything past it is either zeroes or a record that didn't finish.
+    namespace persistent_log {
+
+        constexpr uint32_t MAGIC   = 0x4C46424B; // "KBFL"
+        constexpr uint16_t VERSION = 1;
+
+        struct FileHeader {
+            uint32_t magic          = MAGIC;
+            uint16_t version        = VERSION;
+            uint16_t headerSize     = sizeof(FileHeader);
+            uint32_t capacity       = 0; // File size, header included
+            uint32_t usedBytes      = 0; // Header included
+            int64_t  createdMicros  = 0; // Unix time
+            uint32_t records        = 0;
+            uint32_t droppedRecords = 0; // Entries the ring overwrote before they could be persisted
+        };
+        static_assert(sizeof(FileHeader) == 32);
+
+        struct RecordHeader {
+            int64_t  timestampMicros = 0; // Unix time
+            uint32_t sequence        = 0; // Per-session, so gaps across rotated files are visible
+            uint16_t length          = 0;
+            uint8_t  severity        = 0; // DebugStack::severity
+            uint8_t  reserved        = 0;
+        };
+        static_assert(sizeof(RecordHeader) == 16);
+
+    }
+
+    // Follows DEBUG_STACK from a background thread and appends each entry to a memory-mapped log file, so the tail of
+    //  the log survives the process going down - the mapped pages belong to the OS, not the process. Entries are
+    //  formatted on the sink thread; the game thread's cost is the ring push it already makes.
+    //  Files are capped at `fileSize` and rotated: kbf_log.kbfl is the current file, kbf_log.1.kbfl the one before, etc.
+    class PersistentLog {
+    public:
+        PersistentLog(size_t fileSize, size_t fileCount);
+        ~PersistentLog();
+
+        PersistentLog(const PersistentLog&) = delete;
+        PersistentLog& operator=(const PersistentLog&) = delete;
+
+        // Starts the sink thread, which rotates the previous session's file out & opens a new one in `directory`.
+        void start(const std::filesystem::path& directory);
+        void stop();
+        bool isRunning() const { return running.load(std::memory_order_relaxed); }
+
+        // Starts or stops to match `enable` - cheap enough to call every frame.
+        void setEnabled(bool enable, const std::filesystem::path& directory) {
+            if (enable != isRunning()) enable ? start(directory) : stop();
+        }
+
+        // Persists everything pushed so far & flushes the mapped view to disk, on the calling thread.
+        //  For crash handlers - gives up rather than waiting on the sink thread for more than a moment.
+        void flush();
+
+        std::filesystem::path getCurrentPath() const;
+        uint64_t getRecordsWritten() const { return recordsWritten.load(std::memory_order_relaxed); }
+        uint64_t getBytesWritten()   const { return bytesWritten.load(std::memory_order_relaxed); }
+        uint64_t getRotations()      const { return rotations.load(std::memory_order_relaxed); }
+        uint64_t getDropped()        const { return droppedRecords.load(std::memory_order_relaxed); }
+
+        static constexpr std::chrono::milliseconds POLL_INTERVAL{ 50 };
+
+    private:
+        struct MappedFile;
+
+        void run();
+        void persistPending();
+        void append(const LogData& log);
+        bool openNewFile();
+        void closeFile();
+        void rotateFiles() const;
+
+        std::filesystem::path pathForIndex(size_t index) const;
+
+        const size_t fileSize;
+        const size_t fileCount;
+
+        std::filesystem::path directory;
+        std::thread           worker;
+        std::atomic<bool>     running{ false };
+
+        std::mutex              wakeMux;
+        std::condition_variable wake;
+        bool                    stopRequested = false;
+
+        // Held while touching the file or cursor, by the sink thread or a flush.
+        std::timed_mutex            fileMux;
+        std::unique_ptr<MappedFile> file;
+        uint64_t                    cursor   = 0;
+        uint32_t                    sequence = 0;
+
+        std::atomic<uint64_t> recordsWritten{ 0 };
+        std::atomic<uint64_t> bytesWritten{ 0 };
+        std::atomic<uint64_t> rotations{ 0 };
+        std::atomic<uint64_t> droppedRecords{ 0 };
+    };
+
+    inline PersistentLog PERSISTENT_LOG{ 4 * 1024 * 1024, 4 };
+
+}
@@ -31,7 +31,8 @@ namespace kbf {
 
         float width = CImGui::GetWindowSize().x;
 
-        std::vector<PlayerData> playerList = playerTracker.getPlayerList();
+        std::vector<PlayerData> playerList;
+        for (const PlayerSnapshot& player : playerTracker.readSnapshot().players) playerList.push_back(player.info.playerData);
 
         static char filterBuffer[128] = "";
         std::string filterStr{ filterBuffer };
@@ -5,18 +5,32 @@
 #include <kbf/gui/shared/alignment.hpp>
 #include <kbf/data/ids/font_symbols.hpp>
 #include <kbf/profiling/cpu_profiler.hpp>
+#include <kbf/profiling/trace_capture.hpp>
+#include <kbf/profiling/frame_budget_controller.hpp>
+#include <kbf/profiling/engine_call_stats.hpp>
+#include <kbf/profiling/alloc_tracker.hpp>
+#include <kbf/replay/tracker_recorder.hpp>
+#include <kbf/replay/tracker_replay.hpp>
 #include <kbf/debug/debug_stack.hpp>
+#include <kbf/debug/persistent_log.hpp>
 #include <kbf/util/string/copy_to_clipboard.hpp>
 #include <kbf/util/font/default_font_sizes.hpp>
 #include <kbf/util/string/ptr_to_hex_string.hpp>
+#include <kbf/util/re_engine/transform_path_cache.hpp>
+#include <kbf/util/re_engine/direct_property.hpp>
+#include <kbf/util/memory/frame_arena.hpp>
 #include <kbf/situation/situation_watcher.hpp>
 #include <kbf/data/armour/armour_data_manager.hpp>
 #include <kbf/gui/shared/sex_marker.hpp>
 #include <kbf/data/ids/special_armour_ids.hpp>
 
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <sstream>
 
+#define DEBUG_TAB_LOG_TAG "[DebugTab]"
+
 // Remove this stupid windows macro
 #undef ERROR
 
@@ -32,6 +46,14 @@ namespace kbf {
                 drawPerformanceTab();
                 CImGui::EndTabItem();
             }
+            if (CImGui::BeginTabItem("Engine Calls")) {
+                drawEngineCallsTab();
+                CImGui::EndTabItem();
+            }
+            if (CImGui::BeginTabItem("Memory")) {
+                drawMemoryTab();
+                CImGui::EndTabItem();
+            }
             if (CImGui::BeginTabItem("Situation")) {
                 drawSituationTab();
                 CImGui::EndTabItem();
@@ -76,6 +98,33 @@ namespace kbf {
 		CImGui::SameLine();
 		CImGui::Checkbox("Error", &showError);
 
+        // Runtime level threshold - entries below it are dropped when pushed, rather than only hidden here.
+        CImGui::SameLine();
+        constexpr std::array<DebugStack::Color, 5> recordLevels = {
+            DebugStack::Color::COL_DEBUG, DebugStack::Color::COL_INFO, DebugStack::Color::COL_SUCCESS, DebugStack::Color::COL_WARNING, DebugStack::Color::COL_ERROR
+        };
+        const DebugStack::Color recordLevel = recordLevels[std::clamp(DEBUG_STACK.getMinSeverity(), 0, static_cast<int>(recordLevels.size()) - 1)];
+        CImGui::PushItemWidth(100.0f);
+        if (CImGui::BeginCombo("Record Level", DebugStack::getColorTypeAsString(recordLevel).c_str())) {
+            for (DebugStack::Color level : recordLevels) {
+                if (!DebugStack::isCompiledIn(level)) continue;
+                if (CImGui::Selectable(DebugStack::getColorTypeAsString(level).c_str(), level == recordLevel)) DEBUG_STACK.setMinLevel(level);
+            }
+            CImGui::EndCombo();
+        }
+        CImGui::PopItemWidth();
+        CImGui::SetItemTooltip("Drop log entries below this level when they're pushed. Levels below KBF_LOG_MIN_LEVEL are compiled out.");
+
+        if (PERSISTENT_LOG.isRunning()) {
+            CImGui::SameLine();
+            CImGui::Text("(Persisting)");
+            CImGui::SetItemTooltip(std::format(
+                "Writing to {}\nRecords: {} ({} KB), Rotations: {}, Dropped: {}",
+                PERSISTENT_LOG.getCurrentPath().string(),
+                PERSISTENT_LOG.getRecordsWritten(), PERSISTENT_LOG.getBytesWritten() / 1024,
+                PERSISTENT_LOG.getRotations(), PERSISTENT_LOG.getDropped()).c_str());
+        }
+
         // Delete Button
         CImGui::SameLine();
 
@@ -102,13 +151,13 @@ namespace kbf {
             static const float timestampWidth = CImGui::CalcTextSize("00:00:00:0000 ").x;
             CImGui::PushTextWrapPos();
 
-            for (const LogData& entry : DEBUG_STACK) {
+            DEBUG_STACK.forEach([&](const LogData& entry) {
                 if ((DebugStack::getColorType(entry.colour) == DebugStack::Color::COL_DEBUG && !showDebug) ||
                     (DebugStack::getColorType(entry.colour) == DebugStack::Color::COL_INFO && !showInfo) ||
 					(DebugStack::getColorType(entry.colour) == DebugStack::Color::COL_SUCCESS && !showSuccess) ||
                     (DebugStack::getColorType(entry.colour) == DebugStack::Color::COL_WARNING && !showWarn) ||
                     (DebugStack::getColorType(entry.colour) == DebugStack::Color::COL_ERROR && !showError)) {
-                    continue; // Skip entries based on filter settings
+                    return; // Skip entries based on filter settings
 				}
 
                 CImGui::PushTextWrapPos(CImGui::GetColumnWidth() - timestampWidth);
@@ -144,7 +193,7 @@ namespace kbf {
                 std::string timeStr = std::format("{:02}:{:02}:{:02}:{:04}", hours, minutes, seconds, milliseconds);
                 CImGui::Text(timeStr.c_str());
                 CImGui::PopStyleColor();
-            }
+            });
 
             CImGui::PopTextWrapPos();
             if (consoleAutoscroll) CImGui::SetScrollHereY(1.0f);
@@ -158,7 +207,24 @@ namespace kbf {
     }
 
     void DebugTab::drawPerformanceTab() {
-#if KBF_DEBUG_BUILD
+        drawPerformanceTab_FrameBudget();
+        drawPerformanceTab_TrackerRecording();
+        drawPerformanceTab_FetchRetries();
+        drawPerformanceTab_PointerValidity();
+        drawPerformanceTab_TransformPaths();
+        drawPerformanceTab_ApplyPlanning();
+
+        if (!CpuProfiler::isEnabled() || !CpuProfiler::GlobalTimelineProfiler || !CpuProfiler::GlobalMultiScopeProfiler) {
+            CImGui::Spacing();
+
+            CImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.902f, 0.635f, 0.235f, 1.0f));
+            constexpr char const* profilingDisabledStr = "Profiling is disabled. Turn on \"Enable Profiling\" in Settings > Performance to capture timings.";
+            preAlignCellContentHorizontal(profilingDisabledStr);
+            CImGui::Text(profilingDisabledStr);
+            CImGui::PopStyleColor();
+            return;
+        }
+
         constexpr ImGuiTableFlags tableFlags = ImGuiTableFlags_BordersInnerH | ImGuiTableFlags_PadOuterX;
 
         CImGui::Spacing();
@@ -166,6 +232,29 @@ namespace kbf {
         static bool hideNoOps = true;
         CImGui::Checkbox("Hide No-ops", &hideNoOps);
 
+        CImGui::SameLine();
+        if (profilerOverhead.has_value()) {
+            CImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 1.0f, 1.0f, 0.5f));
+            std::string overheadStr = std::format("Profiler Overhead: {:.1f} ns / block ({:.1f} ns when disabled)", 
+                profilerOverhead->enabledNs,
+                profilerOverhead->disabledNs);
+            CImGui::SetCursorPosX(CImGui::GetCursorPosX() + CImGui::GetContentRegionAvail().x - CImGui::CalcTextSize(overheadStr.c_str()).x);
+            CImGui::Text(overheadStr.c_str());
+            CImGui::PopStyleColor();
+        }
+        else {
+            constexpr const char* measureOverheadLabel = "Measure Profiler Overhead";
+            const float buttonWidth = CImGui::CalcTextSize(measureOverheadLabel).x + CImGui::GetStyle().FramePadding.x * 2.0f;
+            CImGui::SetCursorPosX(CImGui::GetCursorPosX() + CImGui::GetContentRegionAvail().x - buttonWidth);
+            if (CImGui::Button(measureOverheadLabel)) profilerOverhead = CpuProfiler::measureOverhead();
+        }
+
+        CImGui::Spacing();
+        drawPerformanceTab_TraceCapture();
+        drawPerformanceTab_Histograms();
+        drawPerformanceTab_Allocations();
+        drawPerformanceTab_FrameArenas();
+
         CImGui::Spacing();
         CImGui::Separator();
         CImGui::Spacing();
@@ -185,7 +274,7 @@ namespace kbf {
             total_ms += t.totalMs;
             if (hideNoOps && t.totalMs == 0.0f) continue;
 
-            drawPerformanceTab_TimingRow(blockName, t.totalMs, &t.maxTotalMs);
+            drawPerformanceTab_TimingRow(blockName, t.totalMs, &t.maxTotalMs, &t);
         }
 
         drawPerformanceTab_TimingRow("Total", total_ms);
@@ -206,28 +295,380 @@ namespace kbf {
             total_ms += t.totalMs;
             if (hideNoOps && t.totalMs == 0.0f) continue;
 
-            drawPerformanceTab_TimingRow(blockName, t.totalMs, &t.maxTotalMs);
+            drawPerformanceTab_TimingRow(blockName, t.totalMs, &t.maxTotalMs, &t);
         }
 
         CImGui::PopStyleVar();
         CImGui::EndTable();
 
         CImGui::EndChild();
+    }
 
-#else 
+    void DebugTab::drawPerformanceTab_TraceCapture() {
+        static int captureFrames = 300;
+
+        const TraceCapture::State state = TRACE_CAPTURE.getState();
+
+        CImGui::BeginDisabled(state == TraceCapture::State::CAPTURING);
+        CImGui::PushItemWidth(200.0f);
+        CImGui::SliderInt("Frames", &captureFrames, 1, 3600);
+        CImGui::PopItemWidth();
+        CImGui::SameLine();
+        if (CImGui::Button("Start Trace Capture")) {
+            TRACE_CAPTURE.start(static_cast<uint32_t>(captureFrames));
+        }
+        CImGui::EndDisabled();
+
+        if (state == TraceCapture::State::CAPTURING) {
+            CImGui::SameLine();
+            if (CImGui::Button("Cancel")) TRACE_CAPTURE.cancel();
+
+            const float progress = static_cast<float>(TRACE_CAPTURE.getFramesCaptured()) / static_cast<float>(std::max<uint32_t>(TRACE_CAPTURE.getFramesRequested(), 1u));
+            std::string progressStr = std::format("{} / {} frames ({} events)", TRACE_CAPTURE.getFramesCaptured(), TRACE_CAPTURE.getFramesRequested(), TRACE_CAPTURE.getEventCount());
+            CImGui::ProgressBar(progress, ImVec2(-FLT_MIN, 0), progressStr.c_str());
+        }
+        else if (state == TraceCapture::State::COMPLETE) {
+            CImGui::SameLine();
+            if (CImGui::Button("Save Trace")) {
+                auto now = std::chrono::system_clock::now();
+                std::string filename = std::format("kbf_trace_{:%Y%m%d_%H%M%S}.json", std::chrono::floor<std::chrono::seconds>(now));
+                std::filesystem::path tracePath = dataManager.exportsPath / filename;
+
+                std::error_code ec;
+                std::filesystem::create_directories(dataManager.exportsPath, ec);
+
+                if (TRACE_CAPTURE.writeChromeTrace(tracePath)) {
+                    DEBUG_STACK.push(std::format("{} Saved trace capture to {}", DEBUG_TAB_LOG_TAG, tracePath.string()), DebugStack::Color::COL_SUCCESS);
+                }
+                else {
+                    DEBUG_STACK.push(std::format("{} Failed to save trace capture to {}", DEBUG_TAB_LOG_TAG, tracePath.string()), DebugStack::Color::COL_ERROR);
+                }
+            }
+
+            if (TRACE_CAPTURE.getDroppedCount() > 0) {
+                CImGui::SameLine();
+                CImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.902f, 0.635f, 0.235f, 1.0f));
+                CImGui::Text(std::format("{} events dropped - buffer full", TRACE_CAPTURE.getDroppedCount()).c_str());
+                CImGui::PopStyleColor();
+            }
+        }
+    }
+
+    void DebugTab::drawPerformanceTab_FrameBudget() {
+        const KBFSettings& settings = dataManager.settings();
+        const FrameBudgetLimits limits = FRAME_BUDGET.getLimits(settings);
 
         CImGui::Spacing();
+        CImGui::SeparatorText("Frame Budget");
+        CImGui::Spacing();
+
+        const double smoothedUs = FRAME_BUDGET.getSmoothedCostUs();
+        std::string costStr = settings.enableAdaptiveBudget
+            ? std::format("{:.0f} / {:.0f} us (last: {:.0f} us)", smoothedUs, settings.adaptiveBudgetUs, FRAME_BUDGET.getLastCostUs())
+            : std::format("{:.0f} us (last: {:.0f} us) - Adaptive budget disabled", smoothedUs, FRAME_BUDGET.getLastCostUs());
+        const float fraction = settings.enableAdaptiveBudget ? static_cast<float>(smoothedUs / std::max<double>(settings.adaptiveBudgetUs, 1.0)) : 0.0f;
 
-        CImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.902f, 0.635f, 0.235f, 1.0f));
-        constexpr char const* profilingDisabledStr = "Profiling is disabled for release builds of KBF.";
-        preAlignCellContentHorizontal(profilingDisabledStr);
-        CImGui::Text(profilingDisabledStr);
+        const ImVec4 barCol = fraction >= 1.0f ? ImVec4(0.9f, 0.2f, 0.2f, 1.0f) : ImVec4(0.2f, 0.8f, 0.2f, 1.0f);
+        CImGui::PushStyleColor(ImGuiCol_PlotHistogram, barCol);
+        CImGui::ProgressBar(std::min(fraction, 1.0f), ImVec2(-FLT_MIN, 0), costStr.c_str());
         CImGui::PopStyleColor();
 
-#endif
+        CImGui::Text(std::format(
+            "Scale: {:.2f}    |    Concurrent Applications: {}    |    Bone Fetches / Frame: {}    |    Range: {:.1f}m",
+            FRAME_BUDGET.getScale(),
+            limits.maxConcurrentApplications,
+            limits.maxBoneFetchesPerFrame,
+            limits.applicationRange
+        ).c_str());
+        CImGui::Spacing();
+    }
+
+    void DebugTab::drawPerformanceTab_TrackerRecording() {
+        CImGui::SeparatorText("Tracker Recording");
+        CImGui::Spacing();
+
+        const bool recording = TRACKER_RECORDER.isRecording();
+        if (recording) {
+            if (CImGui::Button("Stop Recording")) {
+                TRACKER_RECORDER.stop();
+                DEBUG_STACK.push(std::format("{} Saved tracker recording to {} ({} frames, {} events)",
+                    DEBUG_TAB_LOG_TAG, lastTrackerRecordingPath.string(), TRACKER_RECORDER.getFrameCount(), TRACKER_RECORDER.getEventCount()), DebugStack::Color::COL_SUCCESS);
+            }
+        }
+        else if (CImGui::Button("Start Recording")) {
+            auto now = std::chrono::system_clock::now();
+            std::string filename = std::format("kbf_tracker_{:%Y%m%d_%H%M%S}.kbfr", std::chrono::floor<std::chrono::seconds>(now));
+            std::filesystem::path recordingPath = dataManager.exportsPath / filename;
+
+            std::error_code ec;
+            std::filesystem::create_directories(dataManager.exportsPath, ec);
+
+            if (TRACKER_RECORDER.start(recordingPath)) {
+                lastTrackerRecordingPath = recordingPath;
+            }
+            else {
+                DEBUG_STACK.push(std::format("{} Failed to start tracker recording at {}", DEBUG_TAB_LOG_TAG, recordingPath.string()), DebugStack::Color::COL_ERROR);
+            }
+        }
+        CImGui::SetItemTooltip("Record player & NPC tracker inputs (joins, leaves, refetches, visibility, camera distance) to replay off the game.");
+
+        CImGui::SameLine();
+        CImGui::BeginDisabled(recording || lastTrackerRecordingPath.empty());
+        if (CImGui::Button("Replay Last Recording")) {
+            TrackerRecording trackerRecording{};
+            const bool complete = readTrackerRecording(lastTrackerRecordingPath, trackerRecording);
+            if (!complete) {
+                DEBUG_STACK.push(std::format("{} Tracker recording {} is truncated or invalid, replaying the {} frames read",
+                    DEBUG_TAB_LOG_TAG, lastTrackerRecordingPath.string(), trackerRecording.frames.size()), DebugStack::Color::COL_WARNING);
+            }
+
+            TrackerReplay replay{ TrackerReplayOptions{ dataManager.settings().delayOnEquip } };
+            trackerReplaySummary = replay.run(trackerRecording).summary();
+        }
+        CImGui::EndDisabled();
+
+        if (recording) {
+            CImGui::SameLine();
+            CImGui::Text(std::format("{} frames, {} events, {} written",
+                TRACKER_RECORDER.getFrameCount(), TRACKER_RECORDER.getEventCount(), formatBytes(TRACKER_RECORDER.getBytesWritten())).c_str());
+        }
+
+        if (trackerReplaySummary.has_value()) {
+            CImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 1.0f, 1.0f, 0.5f));
+            CImGui::Text(trackerReplaySummary->c_str());
+            CImGui::PopStyleColor();
+        }
+        CImGui::Spacing();
+    }
+
+    void DebugTab::drawPerformanceTab_FetchRetries() {
+        CImGui::SeparatorText("Fetch Retries");
+        CImGui::Spacing();
+
+        const TrackerHealthSnapshot& playerHealth = playerTracker.readSnapshot().health;
+        const TrackerHealthSnapshot& npcHealth    = npcTracker.readSnapshot().health;
+
+        for (const auto& [kind, health] : { std::pair{ "Players", &playerHealth }, std::pair{ "NPCs", &npcHealth } }) {
+            const FetchRetryScheduler::Stats& stats = health->fetchStats;
+            CImGui::Text(std::format("{}: {} failing    |    {} attempts    |    {} deferred    |    {} given up",
+                kind, health->failingFetches.size(), stats.attempts, stats.deferred, stats.givenUp).c_str());
+
+            std::string byReason = "Failures by reason:";
+            for (size_t i = 0; i < stats.failures.size(); i++) {
+                if (stats.failures[i] == 0) continue;
+                byReason += std::format("\n   {}: {}", fetchFailureName(static_cast<FetchFailure>(i)), stats.failures[i]);
+            }
+            CImGui::SetItemTooltip(byReason.c_str());
+        }
+
+        if (playerHealth.failingFetches.size() + npcHealth.failingFetches.size() == 0) {
+            CImGui::Spacing();
+            return;
+        }
+
+        constexpr ImGuiTableFlags tableFlags = ImGuiTableFlags_BordersInnerH | ImGuiTableFlags_PadOuterX | ImGuiTableFlags_RowBg;
+        if (CImGui::BeginTable("##FetchRetriesTable", 5, tableFlags)) {
+            CImGui::TableSetupColumn("Character",    ImGuiTableColumnFlags_WidthStretch, 0.0f);
+            CImGui::TableSetupColumn("Last Failure", ImGuiTableColumnFlags_WidthStretch, 0.0f);
+            CImGui::TableSetupColumn("Failures",     ImGuiTableColumnFlags_WidthFixed, 0.0f);
+            CImGui::TableSetupColumn("Next Attempt", ImGuiTableColumnFlags_WidthFixed, 0.0f);
+            CImGui::TableSetupColumn("",             ImGuiTableColumnFlags_WidthFixed, 0.0f);
+            CImGui::TableHeadersRow();
+
+            drawPerformanceTab_FetchRetriesRows("Player", playerHealth);
+            drawPerformanceTab_FetchRetriesRows("NPC", npcHealth);
+
+            CImGui::EndTable();
+        }
+        CImGui::Spacing();
+    }
+
+    void DebugTab::drawPerformanceTab_FetchRetriesRows(const char* kind, const TrackerHealthSnapshot& health) {
+        const FetchRetryScheduler::Clock::time_point now = FetchRetryScheduler::Clock::now();
+
+        for (const auto& [i, slot] : health.failingFetches) {
+            CImGui::TableNextRow();
+            CImGui::TableNextColumn();
+            CImGui::Text(std::format("{} [{}]", kind, i).c_str());
+            CImGui::TableNextColumn();
+            CImGui::Text(fetchFailureName(slot.lastFailure));
+            CImGui::TableNextColumn();
+            CImGui::Text(std::to_string(slot.failures).c_str());
+            CImGui::TableNextColumn();
+            const double waitSec = std::chrono::duration<double>(slot.nextAttempt - now).count();
+            CImGui::Text(slot.givenUp ? "-" : std::format("{:.1f}s", std::max(waitSec, 0.0)).c_str());
+            CImGui::TableNextColumn();
+            if (slot.givenUp) {
+                CImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.9f, 0.2f, 0.2f, 1.0f));
+                CImGui::Text("Given Up");
+                CImGui::PopStyleColor();
+            }
+            else {
+                CImGui::Text("Backing Off");
+            }
+        }
+    }
+
+    void DebugTab::drawPerformanceTab_PointerValidity() {
+        CImGui::SeparatorText("Pointer Validation");
+        CImGui::Spacing();
+
+        const TrackerHealthSnapshot& playerHealth = playerTracker.readSnapshot().health;
+        const TrackerHealthSnapshot& npcHealth    = npcTracker.readSnapshot().health;
+
+        for (const auto& [kind, health] : { std::pair{ "Players", &playerHealth }, std::pair{ "NPCs", &npcHealth } }) {
+            const PointerValidityCache::Stats& stats = health->pointerStats;
+            const size_t pointers = health->pointersPerCheck;
+            CImGui::Text(std::format("{}: {} checked, {} skipped last frame    |    ~{} pointer checks saved last frame",
+                kind, stats.checksLastFrame, stats.skippedLastFrame, stats.skippedLastFrame * pointers).c_str());
+            CImGui::SetItemTooltip(std::format(
+                "Set checks run: {}\nSet checks skipped: {} (~{} pointer checks)\nSets found invalid: {}\nEpoch: {}\n\n"
+                "Each set check validates up to {} pointers. Sets are re-checked after scene changes, equips & refetches,\n"
+                "and otherwise every Pointer Re-check Interval frames (see Settings).",
+                stats.checks, stats.skipped, stats.skipped * pointers, stats.failed, health->pointerEpoch, pointers).c_str());
+        }
+        CImGui::Spacing();
+    }
+
+    void DebugTab::drawPerformanceTab_TransformPaths() {
+        CImGui::SeparatorText("Transform Paths");
+        CImGui::Spacing();
+
+        CImGui::Text(std::format("Walk: {:.0f} ns / call    |    Find: {:.0f} ns",
+            TRANSFORM_PATH_CACHE.getWalkNsPerCall(), TRANSFORM_PATH_CACHE.getFindNs()).c_str());
+        CImGui::SetItemTooltip(std::format(
+            "Hits: {}\nStale: {}\nLeft to find (too costly to walk): {}\n\n"
+            "Remembered transform paths are only walked while their managed call count times the\n"
+            "measured walk cost per call beats the measured cost of a find.",
+            TRANSFORM_PATH_CACHE.getHits(), TRANSFORM_PATH_CACHE.getStale(), TRANSFORM_PATH_CACHE.getSkipped()).c_str());
+        CImGui::Spacing();
+    }
+
+    void DebugTab::drawPerformanceTab_ApplyPlanning() {
+        CImGui::SeparatorText("Apply Planning");
+        CImGui::Spacing();
+
+        const PlayerTrackerSnapshot& snapshot = playerTracker.readSnapshot();
+        CImGui::Text(std::format("Players planned last frame: {}    |    Planner threads: {}{}",
+            snapshot.plannedLastFrame, snapshot.plannerThreads, snapshot.plannersStarted ? "" : " (idle)").c_str());
+        CImGui::SetItemTooltip(std::format(
+            "Frames planned in parallel: {}\nFrames planned inline: {}\n\n"
+            "Presets are resolved & turned into bone / part / material writes on the planner threads,\n"
+            "then written to the game on the update thread. Small lobbies are planned inline.",
+            snapshot.parallelPlans, snapshot.inlinePlans).c_str());
+        CImGui::Spacing();
+    }
+
+    void DebugTab::drawPerformanceTab_Allocations() {
+        bool trackAllocations = AllocTracker::isEnabled();
+        if (CImGui::Checkbox("Track Allocations", &trackAllocations)) AllocTracker::setEnabled(trackAllocations);
+        CImGui::SetItemTooltip("Count KBF's heap allocations per frame & per profiling block (shown in each block's tooltip).");
+
+        CImGui::BeginDisabled(!trackAllocations);
+        CImGui::SameLine();
+        bool assertZero = AllocTracker::isAssertZero();
+        if (CImGui::Checkbox("Assert Zero Allocations", &assertZero)) AllocTracker::setAssertZero(assertZero);
+        CImGui::SetItemTooltip("Treat any allocation during the steady-state apply pass as a violation, and keep the stack of the first one.");
+
+        CImGui::SameLine();
+        bool breakOnViolation = AllocTracker::isBreakOnViolation();
+        if (CImGui::Checkbox("Break On Violation", &breakOnViolation)) AllocTracker::setBreakOnViolation(breakOnViolation);
+        CImGui::SetItemTooltip("Break into an attached debugger on every violation.");
+
+        CImGui::SameLine();
+        if (CImGui::Button("Reset Allocations")) AllocTracker::reset();
+
+        CImGui::SameLine();
+        if (CImGui::Button("Log First Violation")) {
+            DEBUG_STACK.push(std::format("{} {}", DEBUG_TAB_LOG_TAG, AllocTracker::formatFirstViolation()), DebugStack::Color::COL_WARNING);
+        }
+        CImGui::EndDisabled();
+
+        if (trackAllocations) {
+            CImGui::Text(std::format(
+                "Last Frame: {} allocs ({} B)    |    Max Frame: {} allocs ({} B)",
+                AllocTracker::getLastFrameAllocations(),
+                AllocTracker::getLastFrameBytes(),
+                AllocTracker::getMaxFrameAllocations(),
+                AllocTracker::getMaxFrameBytes()
+            ).c_str());
+
+            if (assertZero) {
+                const bool hasViolations = AllocTracker::getViolations() > 0;
+                if (hasViolations) CImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.9f, 0.2f, 0.2f, 1.0f));
+                CImGui::Text(std::format("Violations: {} across {} frames", AllocTracker::getViolations(), AllocTracker::getViolatingFrames()).c_str());
+                if (hasViolations) CImGui::PopStyleColor();
+            }
+        }
+    }
+
+    void DebugTab::drawPerformanceTab_FrameArenas() {
+        bool poisoning = FrameArena::isPoisoning();
+        if (CImGui::Checkbox("Poison Frame Arenas", &poisoning)) FrameArena::setPoisoning(poisoning);
+        CImGui::SetItemTooltip(
+            "Fill frame arena memory when it's rewound, so anything still pointing at a previous frame's temporaries reads garbage.\n"
+            "Escapes (arena memory still in use when its frame ends) are counted either way.");
+
+        size_t arenaIdx = 0;
+        FrameArena::forEach([&](const FrameArena& arena) {
+            const FrameArena::Stats stats = arena.getStats();
+            const bool escaped = stats.escapes > 0;
+
+            if (escaped) CImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.9f, 0.2f, 0.2f, 1.0f));
+            CImGui::Text(std::format("Arena {}: {} allocs ({} B) last frame    |    High Water: {} B / {} B{}",
+                arenaIdx++, stats.lastFrameAllocations, stats.lastFrameBytes, stats.highWaterBytes, stats.capacityBytes,
+                escaped ? std::format("    |    Escapes: {}", stats.escapes) : "").c_str());
+            if (escaped) CImGui::PopStyleColor();
+            CImGui::SetItemTooltip(std::format("Chunks allocated from the heap: {}", stats.chunkAllocations).c_str());
+        });
     }
 
-    void DebugTab::drawPerformanceTab_TimingRow(std::string blockName, double t, const double* max_t) {
+    void DebugTab::drawPerformanceTab_Histograms() {
+        if (!CpuProfiler::GlobalTimelineProfiler || !CpuProfiler::GlobalMultiScopeProfiler) return;
+
+        int windowSeconds = static_cast<int>(CpuProfiler::GlobalMultiScopeProfiler->getHistogramWindow());
+        CImGui::PushItemWidth(200.0f);
+        if (CImGui::SliderInt("Percentile Window (s)", &windowSeconds, 1, 300)) {
+            CpuProfiler::GlobalTimelineProfiler->setHistogramWindow(windowSeconds);
+            CpuProfiler::GlobalMultiScopeProfiler->setHistogramWindow(windowSeconds);
+        }
+        CImGui::PopItemWidth();
+
+        CImGui::SameLine();
+        if (CImGui::Button("Reset Histograms")) {
+            CpuProfiler::GlobalTimelineProfiler->resetHistograms();
+            CpuProfiler::GlobalMultiScopeProfiler->resetHistograms();
+        }
+
+        CImGui::SameLine();
+        bool resetOnSituationChange = CpuProfiler::resetHistogramsOnSituationChange.load();
+        if (CImGui::Checkbox("Reset On Situation Change", &resetOnSituationChange)) {
+            CpuProfiler::resetHistogramsOnSituationChange.store(resetOnSituationChange);
+        }
+
+        CImGui::SameLine();
+        if (CImGui::Button("Dump Histograms")) {
+            auto now = std::chrono::system_clock::now();
+            std::string timestamp = std::format("{:%Y%m%d_%H%M%S}", std::chrono::floor<std::chrono::seconds>(now));
+
+            std::error_code ec;
+            std::filesystem::create_directories(dataManager.exportsPath, ec);
+
+            const std::filesystem::path timelinePath    = dataManager.exportsPath / std::format("kbf_histograms_timeline_{}.json", timestamp);
+            const std::filesystem::path multiScopePath  = dataManager.exportsPath / std::format("kbf_histograms_multiscope_{}.json", timestamp);
+
+            if (CpuProfiler::GlobalTimelineProfiler->writeHistogramsJson(timelinePath) &&
+                CpuProfiler::GlobalMultiScopeProfiler->writeHistogramsJson(multiScopePath)
+            ) {
+                DEBUG_STACK.push(std::format("{} Saved profiler histograms to {}", DEBUG_TAB_LOG_TAG, dataManager.exportsPath.string()), DebugStack::Color::COL_SUCCESS);
+            }
+            else {
+                DEBUG_STACK.push(std::format("{} Failed to save profiler histograms to {}", DEBUG_TAB_LOG_TAG, dataManager.exportsPath.string()), DebugStack::Color::COL_ERROR);
+            }
+        }
+    }
+
+    void DebugTab::drawPerformanceTab_TimingRow(std::string blockName, double t, const double* max_t, const ProfilingBlock* block) {
         const ImVec4 timeCol    = getTimingColour(t);
 		const ImVec4 maxTimeCol = getTimingColour(max_t ? *max_t : 0.0);
         constexpr float selectableHeight = 40.0f;
@@ -239,6 +680,18 @@ namespace kbf {
 
         ImVec2 pos = CImGui::GetCursorScreenPos();
         CImGui::Selectable(("##Selectable_" + blockName).c_str(), false, 0, ImVec2(0.0f, selectableHeight));
+        if (block) {
+            const ProfilingPercentiles& w = block->windowPercentiles;
+            const ProfilingPercentiles& s = block->sessionPercentiles;
+            CImGui::SetItemTooltip(std::format(
+                "Window ({} samples)\n  p50: {:.5f} ms\n  p90: {:.5f} ms\n  p99: {:.5f} ms\n  p99.9: {:.5f} ms"
+                "\n\nSession ({} samples)\n  p50: {:.5f} ms\n  p90: {:.5f} ms\n  p99: {:.5f} ms\n  p99.9: {:.5f} ms"
+                "{}",
+                w.samples, w.p50Ms, w.p90Ms, w.p99Ms, w.p999Ms,
+                s.samples, s.p50Ms, s.p90Ms, s.p99Ms, s.p999Ms,
+                AllocTracker::isEnabled() ? std::format("\n\nAllocations (per frame): {} ({} B)", block->allocations, block->allocatedBytes) : ""
+            ).c_str());
+        }
 
         ImVec2 blockNameSize = CImGui::CalcTextSize(blockName.c_str());
         ImVec2 blockNamePos;
@@ -280,6 +733,283 @@ namespace kbf {
 
     }
 
+    void DebugTab::drawEngineCallsTab() {
+        CImGui::Spacing();
+
+        bool enabled = ENGINE_CALL_STATS.isEnabled();
+        if (CImGui::Checkbox("Track Engine Calls", &enabled)) ENGINE_CALL_STATS.setEnabled(enabled);
+        CImGui::SetItemTooltip("Count & time every REInvoke call by (type, method). Adds a small cost to each call while enabled.");
+
+        CImGui::SameLine();
+        if (CImGui::Button("Reset")) ENGINE_CALL_STATS.reset();
+
+        CImGui::SameLine();
+        CImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 1.0f, 1.0f, 0.5f));
+        std::string trackedStr = std::format("{} / {} call sites tracked", ENGINE_CALL_STATS.getTrackedCount(), EngineCallStats::CAPACITY);
+        if (ENGINE_CALL_STATS.getDroppedCount() > 0) trackedStr += std::format(" ({} calls dropped)", ENGINE_CALL_STATS.getDroppedCount());
+        CImGui::SetCursorPosX(CImGui::GetCursorPosX() + CImGui::GetContentRegionAvail().x - CImGui::CalcTextSize(trackedStr.c_str()).x);
+        CImGui::Text(trackedStr.c_str());
+        CImGui::PopStyleColor();
+
+        CImGui::Spacing();
+        drawEngineCallsTab_DirectProperties();
+        CImGui::Spacing();
+
+        constexpr ImGuiTableFlags tableFlags =
+            ImGuiTableFlags_BordersInnerH
+            | ImGuiTableFlags_PadOuterX
+            | ImGuiTableFlags_RowBg
+            | ImGuiTableFlags_Sortable
+            | ImGuiTableFlags_ScrollY;
+        if (!CImGui::BeginTable("##EngineCallsTable", 8, tableFlags)) return;
+
+        CImGui::TableSetupColumn("Type",        ImGuiTableColumnFlags_WidthStretch, 0.0f);
+        CImGui::TableSetupColumn("Method",      ImGuiTableColumnFlags_WidthStretch, 0.0f);
+        CImGui::TableSetupColumn("Calls/Frame", ImGuiTableColumnFlags_WidthFixed, 0.0f);
+        CImGui::TableSetupColumn("Max/Frame",   ImGuiTableColumnFlags_WidthFixed, 0.0f);
+        CImGui::TableSetupColumn("Calls",       ImGuiTableColumnFlags_WidthFixed, 0.0f);
+        CImGui::TableSetupColumn("Total (ms)",  ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_PreferSortDescending, 0.0f);
+        CImGui::TableSetupColumn("Avg (us)",    ImGuiTableColumnFlags_WidthFixed, 0.0f);
+        CImGui::TableSetupColumn("Failures",    ImGuiTableColumnFlags_WidthFixed, 0.0f);
+        CImGui::TableSetupScrollFreeze(0, 1);
+        CImGui::TableHeadersRow();
+
+        static int  sortColumn    = 5;
+        static bool sortAscending = false;
+        if (ImGuiTableSortSpecs* sort_specs = CImGui::TableGetSortSpecs()) {
+            if (sort_specs->SpecsDirty && sort_specs->SpecsCount > 0) {
+                sortColumn    = sort_specs->Specs[0].ColumnIndex;
+                sortAscending = sort_specs->Specs[0].SortDirection == ImGuiSortDirection_Ascending;
+                sort_specs->SpecsDirty = false;
+            }
+        }
+
+        const auto avgUs = [](const EngineCallStat& stat) {
+            return stat.calls == 0 ? 0.0 : stat.totalMs * 1000.0 / static_cast<double>(stat.calls);
+        };
+
+        std::vector<EngineCallStat> stats = ENGINE_CALL_STATS.snapshot();
+        const auto lessThan = [&](const EngineCallStat& a, const EngineCallStat& b) {
+            switch (sortColumn) {
+            case 0:  return a.typeName < b.typeName;
+            case 1:  return a.methodName < b.methodName;
+            case 2:  return a.callsLastFrame < b.callsLastFrame;
+            case 3:  return a.maxCallsPerFrame < b.maxCallsPerFrame;
+            case 4:  return a.calls < b.calls;
+            case 6:  return avgUs(a) < avgUs(b);
+            case 7:  return a.failures < b.failures;
+            default: return a.totalMs < b.totalMs;
+            }
+        };
+        std::sort(stats.begin(), stats.end(), [&](const EngineCallStat& a, const EngineCallStat& b) {
+            return sortAscending ? lessThan(a, b) : lessThan(b, a);
+        });
+
+        for (const EngineCallStat& stat : stats) {
+            CImGui::TableNextRow();
+            CImGui::TableNextColumn();
+            CImGui::Text(stat.typeName.c_str());
+            CImGui::TableNextColumn();
+            CImGui::Text(stat.methodName.c_str());
+            CImGui::TableNextColumn();
+            CImGui::Text(std::to_string(stat.callsLastFrame).c_str());
+            CImGui::TableNextColumn();
+            CImGui::Text(std::to_string(stat.maxCallsPerFrame).c_str());
+            CImGui::TableNextColumn();
+            CImGui::Text(std::to_string(stat.calls).c_str());
+            CImGui::TableNextColumn();
+            CImGui::Text(std::format("{:.3f}", stat.totalMs).c_str());
+            CImGui::TableNextColumn();
+            CImGui::Text(std::format("{:.2f}", avgUs(stat)).c_str());
+            CImGui::TableNextColumn();
+            if (stat.failures > 0) CImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.9f, 0.2f, 0.2f, 1.0f));
+            CImGui::Text(std::to_string(stat.failures).c_str());
+            if (stat.failures > 0) CImGui::PopStyleColor();
+        }
+
+        CImGui::EndTable();
+    }
+
+    void DebugTab::drawEngineCallsTab_DirectProperties() {
+        const std::vector<DirectPropertyStat> stats = DirectPropertyRegistry::snapshot();
+
+        uint64_t avoidedLastFrame = 0;
+        for (const DirectPropertyStat& stat : stats) avoidedLastFrame += stat.directReadsLastFrame;
+        CImGui::Text(std::format("Direct Field Reads: {} getter calls avoided last frame", avoidedLastFrame).c_str());
+        CImGui::SetItemTooltip("Hot getters mapped to field offsets through the type database, checked against the getter, then read directly.\n"
+            "Properties fall back to their getter if no field is found, or if the field stops matching after a game update.");
+
+        constexpr ImGuiTableFlags tableFlags = ImGuiTableFlags_BordersInnerH | ImGuiTableFlags_PadOuterX | ImGuiTableFlags_RowBg;
+        if (!CImGui::BeginTable("##DirectPropertiesTable", 7, tableFlags)) return;
+
+        CImGui::TableSetupColumn("Getter",       ImGuiTableColumnFlags_WidthStretch, 0.0f);
+        CImGui::TableSetupColumn("Field",        ImGuiTableColumnFlags_WidthStretch, 0.0f);
+        CImGui::TableSetupColumn("State",        ImGuiTableColumnFlags_WidthFixed, 0.0f);
+        CImGui::TableSetupColumn("Direct/Frame", ImGuiTableColumnFlags_WidthFixed, 0.0f);
+        CImGui::TableSetupColumn("Direct",       ImGuiTableColumnFlags_WidthFixed, 0.0f);
+        CImGui::TableSetupColumn("Getter Calls", ImGuiTableColumnFlags_WidthFixed, 0.0f);
+        CImGui::TableSetupColumn("Mismatches",   ImGuiTableColumnFlags_WidthFixed, 0.0f);
+        CImGui::TableHeadersRow();
+
+        for (const DirectPropertyStat& stat : stats) {
+            CImGui::TableNextRow();
+            CImGui::TableNextColumn();
+            CImGui::Text(std::format("{}::{}", stat.typeName, stat.getterName).c_str());
+            CImGui::TableNextColumn();
+            CImGui::Text(stat.fieldName.empty() ? "-" : std::format("{} (+0x{:x})", stat.fieldName, stat.offset).c_str());
+            CImGui::TableNextColumn();
+            CImGui::Text(stat.state);
+            CImGui::TableNextColumn();
+            CImGui::Text(std::to_string(stat.directReadsLastFrame).c_str());
+            CImGui::TableNextColumn();
+            CImGui::Text(std::to_string(stat.directReads).c_str());
+            CImGui::TableNextColumn();
+            CImGui::Text(std::to_string(stat.getterCalls).c_str());
+            CImGui::TableNextColumn();
+            if (stat.mismatches > 0) CImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.9f, 0.2f, 0.2f, 1.0f));
+            CImGui::Text(std::to_string(stat.mismatches).c_str());
+            if (stat.mismatches > 0) CImGui::PopStyleColor();
+        }
+
+        CImGui::EndTable();
+    }
+
+    void DebugTab::drawMemoryTab() {
+        constexpr auto AUTO_REFRESH_INTERVAL = std::chrono::seconds(1);
+
+        CImGui::Spacing();
+
+        const auto now = std::chrono::steady_clock::now();
+        bool refresh = CImGui::Button("Refresh");
+
+        CImGui::SameLine();
+        CImGui::Checkbox("Auto Refresh", &memoryAutoRefresh);
+        CImGui::SetItemTooltip("Re-measure every second. Walks every loaded preset & cache, so leave this off for large libraries.");
+        refresh |= (!memoryReport.has_value() && !memoryReportRequested) || (memoryAutoRefresh && now - lastMemoryReportTime >= AUTO_REFRESH_INTERVAL);
+
+        // The trackers are measured on the update thread, so the report is only put together once both have answered.
+        if (refresh) {
+            memoryReportPlayerFootprints = playerTracker.getMemoryFootprints();
+            memoryReportNpcFootprints    = npcTracker.getMemoryFootprints();
+            playerTracker.requestMemoryFootprint();
+            npcTracker.requestMemoryFootprint();
+            memoryReportRequested = true;
+            lastMemoryReportTime  = now;
+        }
+
+        if (memoryReportRequested
+            && playerTracker.getMemoryFootprints() != memoryReportPlayerFootprints
+            && npcTracker.getMemoryFootprints()    != memoryReportNpcFootprints
+        ) {
+            memoryReport          = collectMemoryFootprint();
+            memoryReportRequested = false;
+
+            if (firstMemoryReportBytes == 0) firstMemoryReportBytes = memoryReport->bytes;
+            peakMemoryReportBytes = std::max(peakMemoryReportBytes, memoryReport->bytes);
+        }
+
+        if (!memoryReport.has_value()) {
+            CImGui::SameLine();
+            CImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 1.0f, 1.0f, 0.5f));
+            CImGui::Text("Waiting for the trackers to update...");
+            CImGui::PopStyleColor();
+            return;
+        }
+
+        CImGui::SameLine();
+        if (CImGui::Button("Export")) {
+            auto time = std::chrono::system_clock::now();
+            std::string timestamp = std::format("{:%Y%m%d_%H%M%S}", std::chrono::floor<std::chrono::seconds>(time));
+
+            std::error_code ec;
+            std::filesystem::create_directories(dataManager.exportsPath, ec);
+
+            const std::filesystem::path reportPath = dataManager.exportsPath / std::format("kbf_memory_{}.json", timestamp);
+            if (writeMemoryFootprintJson(reportPath, *memoryReport)) {
+                DEBUG_STACK.push(std::format("{} Saved memory report to {}", DEBUG_TAB_LOG_TAG, reportPath.string()), DebugStack::Color::COL_SUCCESS);
+            }
+            else {
+                DEBUG_STACK.push(std::format("{} Failed to save memory report to {}", DEBUG_TAB_LOG_TAG, reportPath.string()), DebugStack::Color::COL_ERROR);
+            }
+        }
+
+        CImGui::SameLine();
+        CImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 1.0f, 1.0f, 0.5f));
+        const int64_t growth = static_cast<int64_t>(memoryReport->bytes) - static_cast<int64_t>(firstMemoryReportBytes);
+        std::string summaryStr = std::format(
+            "Total: {}    |    Peak: {}    |    Since First Report: {}{}",
+            formatBytes(memoryReport->bytes),
+            formatBytes(peakMemoryReportBytes),
+            growth < 0 ? "-" : "+",
+            formatBytes(static_cast<size_t>(growth < 0 ? -growth : growth)));
+        CImGui::SetCursorPosX(CImGui::GetCursorPosX() + CImGui::GetContentRegionAvail().x - CImGui::CalcTextSize(summaryStr.c_str()).x);
+        CImGui::Text(summaryStr.c_str());
+        CImGui::PopStyleColor();
+
+        CImGui::Spacing();
+
+        constexpr ImGuiTableFlags tableFlags =
+            ImGuiTableFlags_BordersInnerH
+            | ImGuiTableFlags_PadOuterX
+            | ImGuiTableFlags_RowBg
+            | ImGuiTableFlags_ScrollY;
+        if (!CImGui::BeginTable("##MemoryTable", 3, tableFlags)) return;
+
+        CImGui::TableSetupColumn("Subsystem", ImGuiTableColumnFlags_WidthStretch, 0.0f);
+        CImGui::TableSetupColumn("Elements",  ImGuiTableColumnFlags_WidthFixed, 0.0f);
+        CImGui::TableSetupColumn("Size",      ImGuiTableColumnFlags_WidthFixed, 0.0f);
+        CImGui::TableSetupScrollFreeze(0, 1);
+        CImGui::TableHeadersRow();
+
+        for (const MemoryFootprint& subsystem : memoryReport->children) {
+            drawMemoryTab_Row(subsystem, 0);
+        }
+        drawMemoryTab_Row(MemoryFootprint{ "Total", memoryReport->elements, memoryReport->bytes }, 0);
+
+        CImGui::EndTable();
+
+        CImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 1.0f, 1.0f, 0.5f));
+        CImGui::TextWrapped("Sizes are estimates from container capacities & node counts, and don't include allocator overhead.");
+        CImGui::PopStyleColor();
+    }
+
+    void DebugTab::drawMemoryTab_Row(const MemoryFootprint& footprint, size_t depth) {
+        const bool topLevel = depth == 0;
+        if (!topLevel) CImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 1.0f, 1.0f, 0.7f));
+
+        CImGui::TableNextRow();
+        CImGui::TableNextColumn();
+        CImGui::Text(std::format("{}{}", std::string(depth * 4, ' '), footprint.name).c_str());
+        CImGui::TableNextColumn();
+        CImGui::Text(std::to_string(footprint.elements).c_str());
+        CImGui::TableNextColumn();
+        CImGui::Text(formatBytes(footprint.bytes).c_str());
+
+        if (!topLevel) CImGui::PopStyleColor();
+
+        for (const MemoryFootprint& child : footprint.children) {
+            drawMemoryTab_Row(child, depth + 1);
+        }
+    }
+
+    MemoryFootprint DebugTab::collectMemoryFootprint() {
+        MemoryFootprint report{ "KBF" };
+        report.add(dataManager.getMemoryFootprint());
+        report.add(ArmourDataManager::get().getMemoryFootprint());
+        // Copies of what the trackers last measured on the update thread - walking their containers here would race it.
+        report.add(playerTracker.readMemoryFootprint());
+        report.add(npcTracker.readMemoryFootprint());
+        report.add(TRANSFORM_PATH_CACHE.getMemoryFootprint());
+        report.add(DEBUG_STACK.getMemoryFootprint());
+        return report;
+    }
+
+    std::string DebugTab::formatBytes(size_t bytes) {
+        if (bytes >= 1024 * 1024) return std::format("{:.2f} MiB", static_cast<double>(bytes) / (1024.0 * 1024.0));
+        if (bytes >= 1024)        return std::format("{:.2f} KiB", static_cast<double>(bytes) / 1024.0);
+        return std::format("{} B", bytes);
+    }
+
     void DebugTab::drawSituationTab() {
 		CImGui::BeginChild("SituationList");
         
@@ -446,7 +1176,7 @@ namespace kbf {
         
         constexpr ImGuiTableFlags tableFlags = ImGuiTableFlags_BordersInnerH | ImGuiTableFlags_PadOuterX;
 
-        const std::vector<PlayerData>& playerList = playerTracker.getPlayerList();
+        const std::vector<PlayerSnapshot>& playerList = playerTracker.readSnapshot().players;
         if (playerList.size() == 0) {
             CImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 1.0f, 1.0f, 0.5f));
             constexpr char const* noPresetStr = "\nNo Players Found.";
@@ -462,10 +1192,8 @@ namespace kbf {
         CImGui::BeginTable("##PlayerListTable", 1, tableFlags);
         CImGui::PushStyleVar(ImGuiStyleVar_CellPadding, ImVec2(LIST_PADDING.x, 0.0f));
 
-        for (const PlayerData& player : playerList) {
-			const PlayerInfo& info = playerTracker.getPlayerInfo(player);
-			const std::optional<PersistentPlayerInfo>& pInfo = playerTracker.getPersistentPlayerInfo(player);
-            drawPlayerListRow(info, pInfo);
+        for (const PlayerSnapshot& player : playerList) {
+            drawPlayerListRow(player.info, player.persistent);
         }
 
         CImGui::PopStyleVar();
@@ -474,7 +1202,7 @@ namespace kbf {
         CImGui::EndChild();
 	}
 
-    void DebugTab::drawPlayerListRow(PlayerInfo info, const std::optional<PersistentPlayerInfo>& pInfo) {
+    void DebugTab::drawPlayerListRow(const PlayerInfo& info, const std::optional<PersistentPlayerSnapshot>& pInfo) {
         CImGui::TableNextRow();
         CImGui::TableNextColumn();
 
@@ -612,9 +1340,8 @@ namespace kbf {
     void DebugTab::drawNpcList() {
         constexpr ImGuiTableFlags tableFlags = ImGuiTableFlags_BordersInnerH | ImGuiTableFlags_PadOuterX;
 
-        std::vector<size_t> npcList = npcTracker.getNpcList();
-		// Sort NPCs by index
-		std::sort(npcList.begin(), npcList.end());
+        // Already in slot order
+        const std::vector<NpcSnapshot>& npcList = npcTracker.readSnapshot().npcs;
 
         CImGui::BeginChild("NpcList");
 
@@ -633,8 +1360,8 @@ namespace kbf {
         CImGui::BeginTable("##PlayerListTable", 1, tableFlags);
         CImGui::PushStyleVar(ImGuiStyleVar_CellPadding, ImVec2(LIST_PADDING.x, 0.0f));
 
-        for (const size_t& npc : npcList) {
-            drawNpcListRow(npcTracker.getNpcInfo(npc), npcTracker.getPersistentNpcInfo(npc));
+        for (const NpcSnapshot& npc : npcList) {
+            drawNpcListRow(npc.info, npc.persistent);
         }
 
         CImGui::PopStyleVar();
@@ -643,7 +1370,7 @@ namespace kbf {
         CImGui::EndChild();
     }
 
-    void DebugTab::drawNpcListRow(NpcInfo info, const std::optional<PersistentNpcInfo>& pInfo) {
+    void DebugTab::drawNpcListRow(const NpcInfo& info, const std::optional<PersistentNpcSnapshot>& pInfo) {
         CImGui::TableNextRow();
         CImGui::TableNextColumn();
 
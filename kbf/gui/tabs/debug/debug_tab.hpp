@@ -4,9 +4,16 @@
 #include <kbf/player/player_tracker.hpp>
 #include <kbf/npc/npc_tracker.hpp>
 #include <kbf/data/mesh/materials/mesh_material.hpp>
+#include <kbf/profiling/profiling_block.hpp>
+#include <kbf/profiling/cpu_profiler.hpp>
+#include <kbf/debug/memory_footprint.hpp>
 
 #include <kbf/cimgui/cimgui_funcs.hpp>
 
+#include <chrono>
+#include <filesystem>
+#include <optional>
+
 namespace kbf {
 
 	class DebugTab : public iTab {
@@ -36,14 +43,30 @@ namespace kbf {
 	private:
 		void drawDebugTab();
 		void drawPerformanceTab();
-		void drawPerformanceTab_TimingRow(std::string blockName, double t, const double* max_t = nullptr);
+		void drawPerformanceTab_TraceCapture();
+		void drawPerformanceTab_Histograms();
+		void drawPerformanceTab_FrameBudget();
+		void drawPerformanceTab_Allocations();
+		void drawPerformanceTab_FrameArenas();
+		void drawPerformanceTab_TrackerRecording();
+		void drawPerformanceTab_FetchRetries();
+		void drawPerformanceTab_FetchRetriesRows(const char* kind, const TrackerHealthSnapshot& health);
+		void drawPerformanceTab_PointerValidity();
+		void drawPerformanceTab_TransformPaths();
+		void drawPerformanceTab_ApplyPlanning();
+		void drawEngineCallsTab();
+		void drawEngineCallsTab_DirectProperties();
+		void drawMemoryTab();
+		void drawMemoryTab_Row(const MemoryFootprint& footprint, size_t depth);
+		MemoryFootprint collectMemoryFootprint();
+		void drawPerformanceTab_TimingRow(std::string blockName, double t, const double* max_t = nullptr, const ProfilingBlock* block = nullptr);
 		void drawSituationTab();
 		void drawSituationTab_Row(std::string name, bool active, bool colorBg);
 		void drawArmourList();
 		void drawPlayerList();
-		void drawPlayerListRow(PlayerInfo info, const std::optional<PersistentPlayerInfo>& pInfo);
+		void drawPlayerListRow(const PlayerInfo& info, const std::optional<PersistentPlayerSnapshot>& pInfo);
 		void drawNpcList();
-		void drawNpcListRow(NpcInfo info, const std::optional<PersistentNpcInfo>& pInfo);
+		void drawNpcListRow(const NpcInfo& info, const std::optional<PersistentNpcSnapshot>& pInfo);
 		void drawCacheTab();
 		void drawBoneCacheTab();
 		void drawBoneCacheTab_BoneList(const std::string& label, const std::vector<std::string>& bones);
@@ -53,6 +76,7 @@ namespace kbf {
 		void drawMatCacheTab_MaterialList(const std::string& label, const std::vector<MeshMaterial>& mats);
 
 		static ImVec4 getTimingColour(double ms);
+		static std::string formatBytes(size_t bytes);
 
 		KBFDataManager& dataManager;
 		PlayerTracker& playerTracker;
@@ -67,6 +91,20 @@ namespace kbf {
 		bool showWarn = true;
 		bool showError = true;
 		bool showDebug = false;
+
+		std::optional<CpuProfiler::Overhead> profilerOverhead = std::nullopt;
+
+		std::optional<MemoryFootprint> memoryReport = std::nullopt;
+		std::chrono::steady_clock::time_point lastMemoryReportTime{};
+		bool   memoryAutoRefresh = false;
+		bool   memoryReportRequested = false;
+		uint64_t memoryReportPlayerFootprints = 0; // Tracker footprints published when the last report was requested
+		uint64_t memoryReportNpcFootprints    = 0;
+		size_t firstMemoryReportBytes = 0;
+		size_t peakMemoryReportBytes  = 0;
+
+		std::filesystem::path lastTrackerRecordingPath{};
+		std::optional<std::string> trackerReplaySummary = std::nullopt;
 	};
 
 }
\ No newline at end of file
@@ -255,13 +255,18 @@ namespace kbf {
         partOverridePanel.get()->focus();
 
         partOverridePanel.get()->onSelectPart([&](MeshPart part, ArmourPiece piece) {
+            PresetPieceSettings* settings = nullptr;
             switch (piece) {
-			case ArmourPiece::AP_SET: openObject.ptrAfter.preset->set.partOverrides.insert(part); break;
-			case ArmourPiece::AP_HELM: openObject.ptrAfter.preset->helm.partOverrides.insert(part); break;
-			case ArmourPiece::AP_BODY: openObject.ptrAfter.preset->body.partOverrides.insert(part); break;
-			case ArmourPiece::AP_ARMS: openObject.ptrAfter.preset->arms.partOverrides.insert(part); break;
-			case ArmourPiece::AP_COIL: openObject.ptrAfter.preset->coil.partOverrides.insert(part); break;
-			case ArmourPiece::AP_LEGS: openObject.ptrAfter.preset->legs.partOverrides.insert(part); break;
+			case ArmourPiece::AP_SET:  settings = &openObject.ptrAfter.preset->set;  break;
+			case ArmourPiece::AP_HELM: settings = &openObject.ptrAfter.preset->helm; break;
+			case ArmourPiece::AP_BODY: settings = &openObject.ptrAfter.preset->body; break;
+			case ArmourPiece::AP_ARMS: settings = &openObject.ptrAfter.preset->arms; break;
+			case ArmourPiece::AP_COIL: settings = &openObject.ptrAfter.preset->coil; break;
+			case ArmourPiece::AP_LEGS: settings = &openObject.ptrAfter.preset->legs; break;
+            }
+            if (settings != nullptr) {
+                settings->partOverrides.insert(part);
+                settings->markPartOverridesEdited();
             }
             partOverridePanel.close();
         });
@@ -1447,27 +1452,27 @@ namespace kbf {
             CImGui::BeginChild("PartVisibilitiesTable");
             if (hasHelmParts) {
                 if (CImGui::CollapsingHeader("Helm Parts", ImGuiTreeNodeFlags_SpanFullWidth)) {
-                    drawPresetEditor_PartVisibilitiesTable("Helm Parts", (**preset).helm.partOverrides);
+                    drawPresetEditor_PartVisibilitiesTable("Helm Parts", (**preset).helm);
                 }
             }
             if (hasBodyParts) {
                 if (CImGui::CollapsingHeader("Body Parts", ImGuiTreeNodeFlags_SpanFullWidth)) {
-                    drawPresetEditor_PartVisibilitiesTable("Body Parts", (**preset).body.partOverrides);
+                    drawPresetEditor_PartVisibilitiesTable("Body Parts", (**preset).body);
 				}
             }
             if (hasArmsParts) {
                 if (CImGui::CollapsingHeader("Arms Parts", ImGuiTreeNodeFlags_SpanFullWidth)) {
-                    drawPresetEditor_PartVisibilitiesTable("Arms Parts", (**preset).arms.partOverrides);
+                    drawPresetEditor_PartVisibilitiesTable("Arms Parts", (**preset).arms);
                 }
 			}
             if (hasCoilParts) {
                 if (CImGui::CollapsingHeader("Coil Parts", ImGuiTreeNodeFlags_SpanFullWidth)) {
-                    drawPresetEditor_PartVisibilitiesTable("Coil Parts", (**preset).coil.partOverrides);
+                    drawPresetEditor_PartVisibilitiesTable("Coil Parts", (**preset).coil);
                 }
             }
             if (hasLegsParts) {
                 if (CImGui::CollapsingHeader("Legs Parts", ImGuiTreeNodeFlags_SpanFullWidth)) {
-                    drawPresetEditor_PartVisibilitiesTable("Legs Parts", (**preset).legs.partOverrides);
+                    drawPresetEditor_PartVisibilitiesTable("Legs Parts", (**preset).legs);
                 }
 			}
             CImGui::EndChild();
@@ -1475,7 +1480,8 @@ namespace kbf {
 
     }
 
-    void EditorTab::drawPresetEditor_PartVisibilitiesTable(std::string tableName, std::set<OverrideMeshPart>& parts) {
+    void EditorTab::drawPresetEditor_PartVisibilitiesTable(std::string tableName, PresetPieceSettings& settings) {
+        std::set<OverrideMeshPart>& parts = settings.partOverrides;
         std::vector<OverrideMeshPart> overrideParts(parts.begin(), parts.end());
 
         constexpr float deleteButtonScale = 1.2f;
@@ -1561,6 +1567,7 @@ namespace kbf {
                 tmp.shown = partOverride.shown;
                 parts.erase(it);
                 parts.insert(std::move(tmp));
+                settings.markPartOverridesEdited();
             }
 
 			const char* tooltipText = partOverride.shown ? "This part will always be shown." : "This part will always be hidden.";
@@ -1570,6 +1577,7 @@ namespace kbf {
         for (const OverrideMeshPart& part : partRemoversToDelete) {
             parts.erase(part);
         }
+        if (!partRemoversToDelete.empty()) settings.markPartOverridesEdited();
 
         CImGui::PopStyleVar();
         CImGui::EndTable();
@@ -106,7 +106,7 @@ namespace kbf {
 		void drawCompactBoneModifierGroup(const std::string& strID, glm::vec3& group, float limit, ImVec2 size, std::string fmtPrefix = "");
 		void drawBoneModifierGroup(const std::string& strID, glm::vec3& group, float limit, float width, float speed);
 		void drawPresetEditor_PartVisibilities(Preset** preset);
-		void drawPresetEditor_PartVisibilitiesTable(std::string tableName, std::set<OverrideMeshPart>& parts);
+		void drawPresetEditor_PartVisibilitiesTable(std::string tableName, PresetPieceSettings& settings);
 		void drawPresetEditor_MaterialParams(Preset** preset);
 		void drawPresetEditor_MaterialParamsTable(std::string tableName, ArmourPiece piece, std::set<OverrideMaterial>& mats);
 
@@ -170,8 +170,60 @@ namespace kbf {
 			"Suggested Range For High Performance: 1 ~ 5\n"
 			"Note: When set to 0, all tracked bones may be fetched on a single frame. This reduces pop-in but may cause slight frame-dips when loading into a scene.");
 
+		settingsChanged |= CImGui::SliderInt("##Slider9", &settings.pointerRecheckInterval, 0, 600, "Pointer Re-check Interval: %d frames", ImGuiSliderFlags_AlwaysClamp);
+		CImGui::SetItemTooltip(
+			"How often each character's game object pointers are re-checked for validity when nothing has changed.\n\n"
+			"Pointers are always re-checked after scene changes, equipment changes & when a character is (re)fetched.\n"
+			"This periodic re-check is only a safety net, and is spread out so that characters don't all re-check on the same frame.\n\n"
+			"Suggested Range: 30 ~ 120\n"
+			"Note: When set to 0, every character is re-checked every frame.");
+
 		CImGui::PopItemWidth();
 
+		CImGui::Spacing();
+		pushToggleColors(settings.enableAdaptiveBudget);
+		settingsChanged |= CImGui::Toggle(" Adaptive Frame Budget", &settings.enableAdaptiveBudget, ImGuiToggleFlags_Animated);
+		popToggleColors();
+		CImGui::SetItemTooltip(
+			"Automatically lower the limits above when KBF takes too long each frame, and raise them again when there is headroom.\n\n"
+			"The values above act as the upper limits, and the minimums below as the lower limits.\n"
+			"Live values can be seen in Debug > Performance.");
+
+		if (settings.enableAdaptiveBudget) {
+			CImGui::PushItemWidth(-1);
+			settingsChanged |= CImGui::DragFloat("##Slider5", &settings.adaptiveBudgetUs, 10.0f, 50.0f, 10000.0f, "Frame Budget: %.0fus", ImGuiSliderFlags_AlwaysClamp);
+			CImGui::SetItemTooltip(
+				"Target time KBF may spend per frame, in microseconds (1000us = 1ms).\n\n"
+				"Suggested Range: 500 ~ 2000");
+
+			settingsChanged |= CImGui::SliderInt("##Slider6", &settings.adaptiveMinConcurrentApplications, 1, 99, "Min Concurrent Applications: %d", ImGuiSliderFlags_AlwaysClamp);
+			CImGui::SetItemTooltip("The adaptive budget will never reduce Max Concurrent Applications below this value.");
+
+			settingsChanged |= CImGui::SliderInt("##Slider7", &settings.adaptiveMinBoneFetchesPerFrame, 1, 100, "Min Bone Fetches Per Frame: %d", ImGuiSliderFlags_AlwaysClamp);
+			CImGui::SetItemTooltip("The adaptive budget will never reduce Max Bone Fetches Per Frame below this value.");
+
+			settingsChanged |= CImGui::DragFloat("##Slider8", &settings.adaptiveMinApplicationRange, 0.1f, 1.0f, 300.0f, "Min Application Range: %.1fm", ImGuiSliderFlags_AlwaysClamp);
+			CImGui::SetItemTooltip("The adaptive budget will never reduce Application Range below this value.");
+			CImGui::PopItemWidth();
+		}
+
+		CImGui::Spacing();
+		pushToggleColors(settings.enableProfiling);
+		settingsChanged |= CImGui::Toggle(" Enable Profiling", &settings.enableProfiling, ImGuiToggleFlags_Animated);
+		popToggleColors();
+		CImGui::SetItemTooltip(
+			"Record per-step timings, viewable (and exportable) in Debug > Performance.\n\n"
+			"Turn this on when reporting performance issues. It adds a small cost to every frame, so leave it off otherwise.\n"
+			"When off, the cost is negligible (well under a microsecond per frame).");
+
+		pushToggleColors(settings.enablePersistentLog);
+		settingsChanged |= CImGui::Toggle(" Enable Persistent Log", &settings.enablePersistentLog, ImGuiToggleFlags_Animated);
+		popToggleColors();
+		CImGui::SetItemTooltip(
+			"Continuously save the debug log to KBF/Logs, so it survives the game crashing.\n\n"
+			"Turn this on if you're seeing crashes & want to include the log in a report. The log is written from a background thread,\n"
+			"so there's no per-frame cost. Use debug/decode_persistent_log.py to convert the .kbfl files to text.");
+
 		if (settingsChanged) needsWrite = true;
 
 		auto durationSec = std::chrono::duration_cast<std::chrono::duration<float>>(std::chrono::steady_clock::now() - lastWriteTime);
@@ -2,6 +2,7 @@
 
 #include <kbf/situation/situation_watcher.hpp>
 #include <kbf/debug/debug_stack.hpp>
+#include <kbf/debug/persistent_log.hpp>
 #include <kbf/cimgui/cimgui_funcs.hpp>
 
 #include <windows.h>
@@ -133,6 +134,10 @@ namespace kbf {
             reframework::API::get()->log_error(std::format("KBF Encountered a crash in function: {}. Stack Trace:", line).c_str());
             logStackTrace(ep);
 			logKbfDebugLog();
+
+			// Get the crash (and anything the sink thread hasn't picked up yet) into the persistent log before we go down.
+			DEBUG_STACK.fpush(DebugStack::Color::COL_ERROR, "KBF Encountered a crash in function: {}", line);
+			PERSISTENT_LOG.flush();
 		}
     }
 
@@ -182,8 +187,9 @@ namespace kbf {
     }
 
     void KBF::logKbfDebugLog() {
-        reframework::API::get()->log_error(std::format("KBF Debug Log Start (VERSION={}):", KBF_VERSION).c_str());
-		reframework::API::get()->log_error(DEBUG_STACK.string().c_str());
+        // Runs inside the exception handler, so nothing here may lock or format - see DebugStack::dumpForCrash.
+        reframework::API::get()->log_error("KBF Debug Log Start (VERSION=" KBF_VERSION "):");
+        DEBUG_STACK.dumpForCrash([](const char* line) { reframework::API::get()->log_error(line); });
 		reframework::API::get()->log_error("KBF Debug Log End");
     }
 }
\ No newline at end of file
@@ -14,6 +14,7 @@ namespace kbf {
 		static void onPreUpdateMotion();
 		static void onPostUpdateMotion();
 		static void onPostLateUpdateBehavior();
+		static void onUnload() { get().instance.onUnload(); }
 
 		void drawUI();
 		static void drawInstanceUI() { get().drawUI(); }
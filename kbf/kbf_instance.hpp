@@ -4,10 +4,19 @@
 #include <kbf/npc/npc_tracker.hpp>
 #include <kbf/player/player_tracker.hpp>
 #include <kbf/data/kbf_data_manager.hpp>
+#include <kbf/debug/persistent_log.hpp>
 #include <kbf/profiling/cpu_profiler.hpp>
+#include <kbf/profiling/trace_capture.hpp>
+#include <kbf/profiling/frame_budget_controller.hpp>
+#include <kbf/profiling/engine_call_stats.hpp>
+#include <kbf/profiling/alloc_tracker.hpp>
+#include <kbf/replay/tracker_recorder.hpp>
+#include <kbf/util/re_engine/hot_properties.hpp>
+#include <kbf/util/memory/frame_arena.hpp>
 #include <kbf/situation/situation_watcher.hpp>
 
 #include <atomic>
+#include <chrono>
 
 namespace kbf {
 
@@ -24,6 +33,9 @@ namespace kbf {
 			kbfDataManager.loadData();
 			//kbf::SituationWatcher::initialize();
 
+			// Map hot getters to field offsets now, rather than on their first read mid-frame.
+			DirectPropertyRegistry::resolveAll();
+
 			kbfWindow.initialize();
 
 			CpuProfiler::GlobalTimelineProfiler = CpuProfiler::Builder()
@@ -83,23 +95,28 @@ namespace kbf {
 				.addBlock("Player Apply")
 				.addBlock("Player Apply - Precompute & Sort")
 				.addBlock("Player Apply - Info Validation")
-				.addBlock("Player Apply - Apply Bones")
-				.addBlock("Player Apply - Apply Parts")
-				.addBlock("Player Apply - Apply Materials")
+				.addBlock("Player Apply - Plan")
+				.addBlock("Player Apply - Commit Bones")
+				.addBlock("Player Apply - Commit Parts")
+				.addBlock("Player Apply - Commit Materials")
 				.addBlock("Player Apply - Weapon Visibility")
 				.addBlock("Player Apply - Slinger Visibility")
-				.addBlock("Material Apply - Fetch Piece Info")
-				.addBlock("Material Apply - Check Mesh Validity")
-				.addBlock("Material Apply - Fetch Material Info")
-				.addBlock("Material Apply - Process Overrides")
-				.addBlock("Material Apply - Process Overrides - Mat Search")
-				.addBlock("Material Apply - Process Overrides - Set Visibility")
-				.addBlock("Material Apply - Process Overrides - Apply Params")
-				.addBlock("Material Apply - Process Overrides - Apply Params - Set Float")
-				.addBlock("Material Apply - Process Overrides - Apply Params - Set Float4")
-				.addBlock("Material Apply - Quick Overrides")
+				.addBlock("Material Plan - Fetch Piece Info")
+				.addBlock("Material Plan - Process Overrides")
+				.addBlock("Material Plan - Quick Overrides")
 				.build();
 
+			// Percentiles are only meaningful within one situation, so optionally start fresh whenever it changes.
+			const auto resetHistogramsFn = []() {
+				if (!CpuProfiler::resetHistogramsOnSituationChange) return;
+				if (CpuProfiler::GlobalTimelineProfiler)   CpuProfiler::GlobalTimelineProfiler->resetHistograms();
+				if (CpuProfiler::GlobalMultiScopeProfiler) CpuProfiler::GlobalMultiScopeProfiler->resetHistograms();
+			};
+
+			SituationWatcher& watcher = SituationWatcher::get();
+			for (const auto& [situation, _] : SITUATION_NAMES)        watcher.onEnterSituation(static_cast<KnownSituation>(situation), resetHistogramsFn);
+			for (const auto& [situation, _] : CUSTOM_SITUATION_NAMES) watcher.onEnterSituation(static_cast<CustomSituation>(situation), resetHistogramsFn);
+
 			initializing.store(false);
 			initialized.store(true);
 		}
@@ -189,11 +206,32 @@ namespace kbf {
 		__declspec(noinline)
 		void onPreUpdateMotion() {
 			if (!initialized.load()) return;
+
+			// Ahead of the enabled check, so the log keeps being persisted while KBF itself is switched off.
+			PERSISTENT_LOG.setEnabled(kbfDataManager.settings().enablePersistentLog, kbfDataManager.logsPath);
+
 			if (!kbfDataManager.settings().enabled) return;
 
-			CpuProfiler::GlobalTimelineProfiler.get()->resetAccumulatedAll();
-			CpuProfiler::GlobalMultiScopeProfiler.get()->resetAccumulatedAll();
+			const auto frameStart = std::chrono::steady_clock::now();
+
+			// Latch the setting here so it can only change between frames.
+			CpuProfiler::setEnabled(kbfDataManager.settings().enableProfiling);
+			if (CpuProfiler::isEnabled()) {
+				TRACE_CAPTURE.beginFrame();
+				CpuProfiler::beginFrame();
+				CpuProfiler::GlobalTimelineProfiler.get()->resetAccumulatedAll();
+				CpuProfiler::GlobalMultiScopeProfiler.get()->resetAccumulatedAll();
+			}
+			if (ENGINE_CALL_STATS.isEnabled()) {
+				ENGINE_CALL_STATS.beginFrame();
+				DirectPropertyRegistry::beginFrame();
+			}
+			if (AllocTracker::isEnabled()) AllocTracker::beginFrame();
+			FrameArena::beginFrame();
+			if (TRACKER_RECORDER.isRecording()) TRACKER_RECORDER.beginFrame(FRAME_BUDGET.getLimits(kbfDataManager.settings()).maxConcurrentApplications);
 
+			// No steady state allocation check here - fetching builds caches & copies names and prefab paths out of
+			//  the engine as a matter of course. The apply pass below is the part that must stay off the heap.
 			BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalTimelineProfiler.get(), "(Pre) OnUpdateMotion");
 
 			if (kbfDataManager.settings().enabled) {
@@ -209,6 +247,8 @@ namespace kbf {
 			}
 
 			END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalTimelineProfiler.get(), "(Pre) OnUpdateMotion");
+
+			preUpdateCost = std::chrono::steady_clock::now() - frameStart;
 		}
 
 		__declspec(noinline)
@@ -216,6 +256,10 @@ namespace kbf {
 			if (!initialized.load()) return;
 			if (!kbfDataManager.settings().enabled) return;
 
+			const auto postStart = std::chrono::steady_clock::now();
+
+			ALLOC_TRACKER_EXPECT_NONE(steadyStateScope);
+
 			BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalTimelineProfiler.get(), "(Post) OnLateUpdateBehavior");
 
 			if (kbfDataManager.settings().enablePlayers) {
@@ -231,8 +275,16 @@ namespace kbf {
 			}
 
 			END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalTimelineProfiler.get(), "(Post) OnLateUpdateBehavior");
+
+			// Post is the last of KBF's work each frame, so feed the whole frame's cost to the budget controller here.
+			const auto frameCost = preUpdateCost + (std::chrono::steady_clock::now() - postStart);
+			FRAME_BUDGET.update(kbfDataManager.settings(), std::chrono::duration<double, std::micro>(frameCost).count());
+			preUpdateCost = {};
 		}
 
+		// Threads KBF owns are joined here, ahead of the dll unloading, rather than from destructors under the loader lock.
+		void onUnload() { playerTracker.stopWorkers(); }
+
 		bool isInitialized() const { return initialized.load(); }
 		bool isInitializing() const { return initializing.load(); }
 			
@@ -240,6 +292,8 @@ namespace kbf {
 		std::atomic<bool> initializing = false;
 		std::atomic<bool> initialized = false;
 
+		std::chrono::steady_clock::duration preUpdateCost{};
+
 		KBFDataManager kbfDataManager{ KBF_ASSET_PATH("KBF"), KBF_ASSET_PATH("FBSPresets") };
 		PlayerTracker playerTracker{ kbfDataManager };
 		NpcTracker    npcTracker{ kbfDataManager };
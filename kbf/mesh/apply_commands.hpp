@@ -0,0 +1,70 @@
+#pragma once
+
+#include <kbf/data/bones/bone_modifier.hpp>
+
+#include <reframework/API.hpp>
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+using REApi = reframework::API;
+
+namespace kbf {
+
+	// Engine writes worked out by a manager's planPreset & carried out by its commit. Planning only reads KBF data and
+	//  the engine pointers cached at fetch time, so it's safe off the game thread; committing must stay on it.
+	//  Commands point into presets & cached mesh data, so a buffer is only good for the frame it was planned in.
+
+	struct BoneCommand {
+		REApi::ManagedObject* bone;
+		const BoneModifier*   modifier;
+	};
+
+	struct PartCommand {
+		REApi::ManagedObject* mesh;
+		uint64_t index;
+		bool     shown;
+	};
+
+	struct MaterialCommand {
+		enum class Type : uint8_t {
+			ENABLE, // shown
+			FLOAT,  // value.x
+			FLOAT4  // value
+		};
+
+		REApi::ManagedObject* mesh;
+		Type      type;
+		bool      shown;
+		uint32_t  matIndex;
+		uint32_t  paramIndex;
+		glm::vec4 value;
+	};
+
+	// Everything one character needs applied this frame, in the order it would have been applied directly.
+	struct ApplyCommandBuffer {
+		std::vector<BoneCommand>     bones;
+		std::vector<PartCommand>     parts;
+		std::vector<MaterialCommand> materials;
+
+		bool hideWeapon  = false;
+		bool hideSlinger = false;
+
+		// Keeps capacity, so a buffer reused every frame stops allocating once it's seen a character's full preset.
+		void clear() {
+			bones.clear();
+			parts.clear();
+			materials.clear();
+			hideWeapon  = false;
+			hideSlinger = false;
+		}
+
+		size_t getBytes() const {
+			return bones.capacity()     * sizeof(BoneCommand)
+				 + parts.capacity()     * sizeof(PartCommand)
+				 + materials.capacity() * sizeof(MaterialCommand);
+		}
+	};
+
+}
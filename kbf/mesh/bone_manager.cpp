@@ -2,6 +2,7 @@
 
 #include <kbf/util/re_engine/reinvoke.hpp>
 #include <kbf/debug/debug_stack.hpp>
+#include <kbf/data/data_footprint.hpp>
 #include <kbf/util/string/ptr_to_hex_string.hpp>
 #include <kbf/util/re_engine/check_re_ptr_validity.hpp>
 
@@ -40,6 +41,14 @@ namespace kbf {
 	}
 
 	BoneManager::BoneApplyStatusFlag BoneManager::applyPreset(const Preset* preset, ArmourPiece piece) {
+		applyScratch.clear();
+		BoneApplyStatusFlag planFlag = planPreset(preset, piece, applyScratch);
+		if (planFlag != BoneApplyStatusFlag::BONE_APPLY_SUCCESS) return planFlag;
+
+		return commit(applyScratch);
+	}
+
+	BoneManager::BoneApplyStatusFlag BoneManager::planPreset(const Preset* preset, ArmourPiece piece, std::vector<BoneCommand>& out) const {
 		if (preset == nullptr) return BoneApplyStatusFlag::BONE_APPLY_ERROR_NULL_PRESET;
 
 		const BoneModifierMap& pieceModifiers = preset->getPieceSettings(piece).modifiers;
@@ -47,12 +56,15 @@ namespace kbf {
 		
 		for (const auto& [boneName, modifier] : pieceModifiers) {
 			auto it = targetBones.find(boneName);
-			if (it != targetBones.end()) {
-				bool applySuccess = modifyBone(it->second, modifier);
-				if (!applySuccess) {
-					return BoneApplyStatusFlag::BONE_APPLY_ERROR_INVALID_BONE;
-				}
-			}
+			if (it != targetBones.end()) out.push_back(BoneCommand{ it->second, &modifier });
+		}
+
+		return BoneApplyStatusFlag::BONE_APPLY_SUCCESS;
+	}
+
+	BoneManager::BoneApplyStatusFlag BoneManager::commit(const std::vector<BoneCommand>& commands) {
+		for (const BoneCommand& command : commands) {
+			if (!modifyBone(command.bone, *command.modifier)) return BoneApplyStatusFlag::BONE_APPLY_ERROR_INVALID_BONE;
 		}
 
 		return BoneApplyStatusFlag::BONE_APPLY_SUCCESS;
@@ -170,9 +182,18 @@ namespace kbf {
 			if (joint) {
 				std::string jointName = REInvokeStr(joint, "get_Name", {});
 				bool isValid = REInvoke<bool>(joint, "get_Valid", {}, InvokeReturnType::BOOL);
-				DEBUG_STACK.push(std::format("{} [{}] {} {} ({}) [{}]", KBF_BONE_MANAGER_LOG_TAG, i, message, jointName, ptrToHexString(joint), isValid ? "VALID" : "INVALID"), DebugStack::Color::COL_DEBUG);
+				DEBUG_STACK.fpush(DebugStack::Color::COL_DEBUG, "{} [{}] {} {} ({}) [{}]", KBF_BONE_MANAGER_LOG_TAG, i, message, jointName, ptrToHexString(joint), isValid ? "VALID" : "INVALID");
 			}
 		}
 	}
 
+	size_t BoneManager::getHeapBytes() const {
+		size_t bytes = footprint::armourInfoBytes(armourInfo);
+		for (const auto& bones : partBones) {
+			bytes += footprint::hashContainerBytes(bones, [](const auto& entry) { return footprint::stringBytes(entry.first); });
+		}
+		bytes += applyScratch.capacity() * sizeof(BoneCommand);
+		return bytes;
+	}
+
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <kbf/data/kbf_data_manager.hpp>
 #include <kbf/data/armour/armour_info.hpp>
 #include <kbf/data/preset/preset.hpp>
+#include <kbf/mesh/apply_commands.hpp>
 
 #include <reframework/API.hpp>
 
@@ -31,7 +32,12 @@ namespace kbf {
 			BONE_APPLY_ERROR_INVALID_BONE = 0x00000002
 		};
 
+		// Plans & commits in one go, on the calling (game) thread.
 		BoneApplyStatusFlag applyPreset(const Preset* preset, ArmourPiece piece);
+		// Appends the bone writes for `piece` - no engine access, safe from any thread.
+		BoneApplyStatusFlag planPreset(const Preset* preset, ArmourPiece piece, std::vector<BoneCommand>& out) const;
+		// Game thread only. Stops at the first bone that can't be written.
+		static BoneApplyStatusFlag commit(const std::vector<BoneCommand>& commands);
 		bool loadBones();
 		bool loadTransformBones(
 			ArmourPiece piece,
@@ -39,9 +45,10 @@ namespace kbf {
 			std::unordered_map<std::string, REApi::ManagedObject*>& outMap);
 
 		bool isInitialized() const { return initialized; }
+		size_t getHeapBytes() const;
 
 	private:
-		bool modifyBone(REApi::ManagedObject* bone, const BoneModifier& modifier);
+		static bool modifyBone(REApi::ManagedObject* bone, const BoneModifier& modifier);
 
 		std::unordered_map<std::string, REApi::ManagedObject*> getBoneNames(REApi::ManagedObject* jointArr) const;
 		void DEBUG_printBoneList(REApi::ManagedObject* jointArr, std::string message) const;
@@ -53,6 +60,8 @@ namespace kbf {
 
 		std::array<std::unordered_map<std::string, REApi::ManagedObject*>, 6> partBones;
 		std::array<REApi::ManagedObject*, 6> partTransforms;
+
+		std::vector<BoneCommand> applyScratch; // For applyPreset
 	};
 
 }
\ No newline at end of file
@@ -2,11 +2,13 @@
 
 #include <kbf/util/re_engine/reinvoke.hpp>
 #include <kbf/debug/debug_stack.hpp>
+#include <kbf/data/data_footprint.hpp>
 #include <kbf/util/re_engine/check_re_ptr_validity.hpp>
 #include <kbf/util/re_engine/re_object_properties_to_string.hpp>
 #include <kbf/util/string/ptr_to_hex_string.hpp>
 #include <kbf/util/string/byte_to_binary_string.hpp>
 #include <kbf/util/re_engine/find_transform.hpp>
+#include <kbf/util/memory/frame_arena.hpp>
 
 #include <kbf/profiling/cpu_profiler.hpp>
 
@@ -43,20 +45,26 @@ namespace kbf {
 	}
 	
 	bool MaterialManager::applyPreset(const Preset* preset, ArmourPiece piece) {
+		applyScratch.clear();
+		if (!planPreset(preset, piece, applyScratch)) return false;
+
+		return commit(applyScratch);
+	}
+
+	bool MaterialManager::planPreset(const Preset* preset, ArmourPiece piece, std::vector<MaterialCommand>& out) const {
 		if (preset == nullptr) return false;
 		if (piece == ArmourPiece::AP_SET) return true; // SET does not have materials to modify
 
-		BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Material Apply - Fetch Piece Info");
-		const std::set<OverrideMaterial> matOverrides = preset->getPieceSettings(piece).materialOverrides;
+		BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Material Plan - Fetch Piece Info");
+		const std::set<OverrideMaterial>& matOverrides = preset->getPieceSettings(piece).materialOverrides;
 		// TODO: I Hate literally all of this OverrideMaterial code, but i cba to refactor it
 		// Do a shitty map based on name so subsequent searches are faster - this is a big performance bottleneck
-		const std::unordered_map<std::string, const OverrideMaterial*> matOverridesLUT = [&matOverrides]() {
-			std::unordered_map<std::string, const OverrideMaterial*> lut;
-			for (const auto& mat : matOverrides) {
-				lut[mat.material.name] = &mat;
-			}
-			return lut;
-		}();
+		//  Rebuilt every call, so it lives on this thread's frame arena rather than the heap.
+		std::pmr::unordered_map<std::string_view, const OverrideMaterial*> matOverridesLUT{ &FrameArena::local() };
+		matOverridesLUT.reserve(matOverrides.size());
+		for (const auto& mat : matOverrides) {
+			matOverridesLUT[mat.material.name] = &mat;
+		}
 
 		REApi::ManagedObject* mesh = nullptr;
 		switch (piece) {
@@ -66,17 +74,10 @@ namespace kbf {
 		case ArmourPiece::AP_COIL: mesh = coilMesh; break;
 		case ArmourPiece::AP_LEGS: mesh = legsMesh; break;
 		}
-		END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Material Apply - Fetch Piece Info");
+		END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Material Plan - Fetch Piece Info");
 		if (mesh == nullptr) return false;
-		
-		BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Material Apply - Check Mesh Validity");
-		// Check the mesh is valid before trying to apply anything
-		static const reframework::API::TypeDefinition* def_renderMesh = reframework::API::get()->tdb()->find_type("via.render.Mesh");
-		if (!checkREPtrValidity(mesh, def_renderMesh)) return false;
-		END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Material Apply - Check Mesh Validity");
 
-		BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Material Apply - Fetch Material Info");
-		std::unordered_map<std::string, MeshMaterial>* targetMaterials = nullptr;
+		const std::unordered_map<std::string, MeshMaterial>* targetMaterials = nullptr;
 		switch (piece) {
 		case ArmourPiece::AP_HELM: targetMaterials = &helmMaterials; break;
 		case ArmourPiece::AP_BODY: targetMaterials = &bodyMaterials; break;
@@ -84,59 +85,42 @@ namespace kbf {
 		case ArmourPiece::AP_COIL: targetMaterials = &coilMaterials; break;
 		case ArmourPiece::AP_LEGS: targetMaterials = &legsMaterials; break;
 		}
-		END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Material Apply - Fetch Material Info");
 		if (targetMaterials == nullptr) return false;
 
-		BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Material Apply - Process Overrides");
+		BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Material Plan - Process Overrides");
 		// Only mask out visible items
 		for (const auto& [_, mat] : *targetMaterials) {
-			BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Material Apply - Process Overrides - Mat Search");
 			const auto it = matOverridesLUT.find(mat.name);
-			END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Material Apply - Process Overrides - Mat Search");
 			if (it == matOverridesLUT.end()) continue;
 
 			bool vis = it->second->shown;
-			
-			BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Material Apply - Process Overrides - Set Visibility");
-			REInvokeVoid(mesh, "setMaterialsEnable(System.UInt64, System.Boolean)", { (void*)mat.index, (void*)vis });
-			END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Material Apply - Process Overrides - Set Visibility");
+			uint32_t matIndex = static_cast<uint32_t>(mat.index);
+			out.push_back(MaterialCommand{ mesh, MaterialCommand::Type::ENABLE, vis, matIndex, 0, glm::vec4{ 0.0f } });
 
 			if (!vis) continue;
 
-			BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Material Apply - Process Overrides - Apply Params");
 			// Apply params.
 			//  All my bad design choices coming to bite me in the ass here :)
 			for (const auto& [name, value] : it->second->paramOverrides) {
 				const auto paramIt = mat.params.find(name);
 				if (paramIt != mat.params.end()) {
-					uint32_t matIndex   = static_cast<uint32_t>(mat.index);
 					uint32_t paramIndex = static_cast<uint32_t>(paramIt->second.index);
 					
 					switch (value.type) {
-					case MeshMaterialParamType::MAT_TYPE_FLOAT: {
-						BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Material Apply - Process Overrides - Apply Params - Set Float");
-						// For whatever dumbass reason, System.Single is actually a double?????????????????????????????????????????????
-						double v = static_cast<double>(value.asFloat());
-						uint64_t vAsUint = *reinterpret_cast<uint64_t*>(&v);
-
-						REInvokeVoid(mesh, "setMaterialFloat(System.UInt32, System.UInt32, System.Single)", { (void*)matIndex, (void*)paramIndex, (void*)vAsUint });
-						END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Material Apply - Process Overrides - Apply Params - Set Float");
-					} break;
-					case MeshMaterialParamType::MAT_TYPE_FLOAT4: {
-						BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Material Apply - Process Overrides - Apply Params - Set Float4");
-						glm::vec4 v = value.asVec4();
-						REInvokeVoid(mesh, "setMaterialFloat4(System.UInt32, System.UInt32, via.Float4)", { (void*)matIndex, (void*)paramIndex, (void*)&v });
-						END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Material Apply - Process Overrides - Apply Params - Set Float4");
-					} break;
+					case MeshMaterialParamType::MAT_TYPE_FLOAT:
+						out.push_back(MaterialCommand{ mesh, MaterialCommand::Type::FLOAT, true, matIndex, paramIndex, glm::vec4{ value.asFloat(), 0.0f, 0.0f, 0.0f } });
+						break;
+					case MeshMaterialParamType::MAT_TYPE_FLOAT4:
+						out.push_back(MaterialCommand{ mesh, MaterialCommand::Type::FLOAT4, true, matIndex, paramIndex, value.asVec4() });
+						break;
 					}
 
 				}
 			}
-			END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Material Apply - Process Overrides - Apply Params");
 		}
-		END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Material Apply - Process Overrides");
+		END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Material Plan - Process Overrides");
 
-		QuickOverrideMatMatchLUT* targetOverrideMatches = nullptr;
+		const QuickOverrideMatMatchLUT* targetOverrideMatches = nullptr;
 		switch (piece) {
 		case ArmourPiece::AP_HELM: targetOverrideMatches = &helmQuickOverrideMatches; break;
 		case ArmourPiece::AP_BODY: targetOverrideMatches = &bodyQuickOverrideMatches; break;
@@ -146,20 +130,19 @@ namespace kbf {
 		}
 		if (targetOverrideMatches == nullptr) return false;
 
-		BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Material Apply - Quick Overrides");
-		// Apply quick overrides.
-		const QuickOverrideMatMatchLUT& matches = *targetOverrideMatches;
-		applyQuickOverrides(preset, mesh, matches);
-		END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Material Apply - Quick Overrides");
+		BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Material Plan - Quick Overrides");
+		planQuickOverrides(preset, mesh, *targetOverrideMatches, out);
+		END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Material Plan - Quick Overrides");
 
 		return true;
 	}
 
-	void MaterialManager::applyQuickOverrides(
+	void MaterialManager::planQuickOverrides(
 		const Preset* preset, 
-		REApi::ManagedObject* mesh, 
-		const QuickOverrideMatMatchLUT& matches
-	) {
+		REApi::ManagedObject* mesh,
+		const QuickOverrideMatMatchLUT& matches,
+		std::vector<MaterialCommand>& out
+	) const {
 		// Note: Template this func if any more types get added.
 
 		for (const auto& [paramKey, qOverride] : preset->quickMaterialOverridesFloat) {
@@ -175,12 +158,9 @@ namespace kbf {
 				if (paramIt == matParams.end()) continue;
 				const MeshMaterialParam& foundParam = paramIt->second;
 
-				double v = static_cast<double>(qOverride.value);
-				uint64_t vAsUint = *reinterpret_cast<uint64_t*>(&v);
-
 				uint32_t matIdx32   = static_cast<uint32_t>(foundMat->index);
 				uint32_t paramIdx32 = static_cast<uint32_t>(foundParam.index);
-				REInvokeVoid(mesh, "setMaterialFloat(System.UInt32, System.UInt32, System.Single)", { (void*)foundMat->index, (void*)foundParam.index, (void*)vAsUint });
+				out.push_back(MaterialCommand{ mesh, MaterialCommand::Type::FLOAT, true, matIdx32, paramIdx32, glm::vec4{ qOverride.value, 0.0f, 0.0f, 0.0f } });
 			}
 		}
 
@@ -198,11 +178,50 @@ namespace kbf {
 				if (paramIt == matParams.end()) continue;
 				const MeshMaterialParam& foundParam = paramIt->second;
 
-				glm::vec4 v = qOverride.value;
-				REInvokeVoid(mesh, "setMaterialFloat4(System.UInt32, System.UInt32, via.Float4)", { (void*)foundMat->index, (void*)foundParam.index, (void*)&v });
+				uint32_t matIdx32   = static_cast<uint32_t>(foundMat->index);
+				uint32_t paramIdx32 = static_cast<uint32_t>(foundParam.index);
+				out.push_back(MaterialCommand{ mesh, MaterialCommand::Type::FLOAT4, true, matIdx32, paramIdx32, qOverride.value });
+			}
+
+		}
+	}
+
+	bool MaterialManager::commit(const std::vector<MaterialCommand>& commands) {
+		static const reframework::API::TypeDefinition* def_renderMesh = reframework::API::get()->tdb()->find_type("via.render.Mesh");
+
+		// Check each mesh is valid before trying to apply anything to it. Commands come in runs per mesh.
+		REApi::ManagedObject* checkedMesh = nullptr;
+		bool meshValid = false;
+		bool allApplied = true;
+
+		for (const MaterialCommand& command : commands) {
+			if (command.mesh != checkedMesh) {
+				checkedMesh = command.mesh;
+				meshValid   = checkREPtrValidity(checkedMesh, def_renderMesh);
+				allApplied &= meshValid;
 			}
+			if (!meshValid) continue;
+
+			switch (command.type) {
+			case MaterialCommand::Type::ENABLE: {
+				uint64_t matIndex = command.matIndex;
+				REInvokeVoid(command.mesh, "setMaterialsEnable(System.UInt64, System.Boolean)", { (void*)matIndex, (void*)command.shown });
+			} break;
+			case MaterialCommand::Type::FLOAT: {
+				// For whatever dumbass reason, System.Single is actually a double?????????????????????????????????????????????
+				double v = static_cast<double>(command.value.x);
+				uint64_t vAsUint = *reinterpret_cast<uint64_t*>(&v);
 
+				REInvokeVoid(command.mesh, "setMaterialFloat(System.UInt32, System.UInt32, System.Single)", { (void*)command.matIndex, (void*)command.paramIndex, (void*)vAsUint });
+			} break;
+			case MaterialCommand::Type::FLOAT4: {
+				glm::vec4 v = command.value;
+				REInvokeVoid(command.mesh, "setMaterialFloat4(System.UInt32, System.UInt32, via.Float4)", { (void*)command.matIndex, (void*)command.paramIndex, (void*)&v });
+			} break;
+			}
 		}
+
+		return allApplied;
 	}
 
 	bool MaterialManager::loadMaterials() {
@@ -320,4 +339,22 @@ namespace kbf {
 		return matches;
 	}
 
+	size_t MaterialManager::getHeapBytes() const {
+		size_t bytes = footprint::armourInfoBytes(armourInfo);
+		for (const auto* materials : { &helmMaterials, &bodyMaterials, &armsMaterials, &coilMaterials, &legsMaterials }) {
+			bytes += footprint::hashContainerBytes(*materials, [](const auto& entry) {
+				return footprint::stringBytes(entry.first) + footprint::meshMaterialBytes(entry.second);
+			});
+		}
+		for (const QuickOverrideMatMatchLUT* matches : {
+			&helmQuickOverrideMatches, &bodyQuickOverrideMatches, &armsQuickOverrideMatches, &coilQuickOverrideMatches, &legsQuickOverrideMatches
+		}) {
+			bytes += footprint::hashContainerBytes(*matches, [](const auto& entry) {
+				return footprint::stringBytes(entry.first) + footprint::vectorBytes(entry.second);
+			});
+		}
+		bytes += applyScratch.capacity() * sizeof(MaterialCommand);
+		return bytes;
+	}
+
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <kbf/data/armour/armour_info.hpp>
 #include <kbf/data/preset/preset.hpp>
 #include <kbf/data/mesh/materials/mesh_material.hpp>
+#include <kbf/mesh/apply_commands.hpp>
 
 #include <reframework/API.hpp>
 
@@ -24,18 +25,25 @@ namespace kbf {
 			REApi::ManagedObject* legsTransform,
 			bool female);
 
+		// Plans & commits in one go, on the calling (game) thread.
 		bool applyPreset(const Preset* preset, ArmourPiece piece);
+		// Appends the material visibility & param writes for `piece` - no engine access, safe from any thread.
+		bool planPreset(const Preset* preset, ArmourPiece piece, std::vector<MaterialCommand>& out) const;
+		// Game thread only. Skips (& returns false for) commands on meshes that are no longer valid.
+		static bool commit(const std::vector<MaterialCommand>& commands);
 		bool loadMaterials();
 
 		bool isInitialized() const { return initialized; }
+		size_t getHeapBytes() const;
 
 	private:
 		using QuickOverrideMatMatchLUT = std::unordered_map<std::string, std::vector<const MeshMaterial*>>;
 		
-		void applyQuickOverrides(
+		void planQuickOverrides(
 			const Preset* preset, 
 			REApi::ManagedObject* mesh,
-			const QuickOverrideMatMatchLUT& matches);
+			const QuickOverrideMatMatchLUT& matches,
+			std::vector<MaterialCommand>& out) const;
 
 		bool getMesh(REApi::ManagedObject* transform, REApi::ManagedObject** out) const;
 		std::unordered_map<std::string, MeshMaterial> getMaterials(
@@ -73,6 +81,8 @@ namespace kbf {
 		REApi::ManagedObject* armsMesh = nullptr;
 		REApi::ManagedObject* coilMesh = nullptr;
 		REApi::ManagedObject* legsMesh = nullptr;
+
+		std::vector<MaterialCommand> applyScratch; // For applyPreset
 	};
 
 }
\ No newline at end of file
@@ -2,13 +2,17 @@
 
 #include <kbf/util/re_engine/reinvoke.hpp>
 #include <kbf/debug/debug_stack.hpp>
+#include <kbf/data/data_footprint.hpp>
 #include <kbf/util/re_engine/re_object_properties_to_string.hpp>
 #include <kbf/util/string/ptr_to_hex_string.hpp>
 #include <kbf/util/string/byte_to_binary_string.hpp>
 #include <kbf/util/re_engine/find_transform.hpp>
+#include <kbf/profiling/alloc_tracker.hpp>
 
 #include <kbf/data/mesh/parts/part_cache_manager.hpp>
 
+#include <algorithm>
+
 #define KBF_BONE_MANAGER_LOG_TAG "[PartManager]"
 
 namespace kbf {
@@ -36,43 +40,86 @@ namespace kbf {
 		initialized = loadParts();
 	}
 
-	bool PartManager::applyPreset(const Preset* preset, ArmourPiece piece) {
+	bool PartManager::planPreset(const Preset* preset, ArmourPiece piece) {
 		if (preset == nullptr) return false;
-
-		const std::set<OverrideMeshPart> partOverrides = preset->getPieceSettings(piece).partOverrides;
 		// TODO: Should probably check that the parts being removed actually exist in the mesh.
 
-		REApi::ManagedObject* mesh = nullptr;
-		switch (piece) {
-		case ArmourPiece::AP_SET:  mesh = baseMesh; break;
-		case ArmourPiece::AP_HELM: mesh = helmMesh; break;
-		case ArmourPiece::AP_BODY: mesh = bodyMesh; break;
-		case ArmourPiece::AP_ARMS: mesh = armsMesh; break;
-		case ArmourPiece::AP_COIL: mesh = coilMesh; break;
-		case ArmourPiece::AP_LEGS: mesh = legsMesh; break;
+		if (getPieceMesh(piece) == nullptr) return false;
+
+		const std::vector<MeshPart>* targetParts = getPieceParts(piece);
+		if (targetParts == nullptr) return false;
+
+		plannedVisibility[piece].layer(getCompiledMask(preset, piece, *targetParts));
+		return true;
+	}
+
+	void PartManager::finishPlan(std::vector<PartCommand>& out) {
+		if (++plansFinished % RESYNC_INTERVAL_PLANS == 0) {
+			for (PartVisibilityMask& committed : committedVisibility) std::fill(committed.overridden.begin(), committed.overridden.end(), 0);
 		}
-		if (mesh == nullptr) return false;
 
-		const std::vector<MeshPart>* targetParts = nullptr;
-		switch (piece) {
-		case ArmourPiece::AP_SET:  targetParts = &baseParts; break;
-		case ArmourPiece::AP_HELM: targetParts = &helmParts; break;
-		case ArmourPiece::AP_BODY: targetParts = &bodyParts; break;	
-		case ArmourPiece::AP_ARMS: targetParts = &armsParts; break;
-		case ArmourPiece::AP_COIL: targetParts = &coilParts; break;
-		case ArmourPiece::AP_LEGS: targetParts = &legsParts; break;
+		for (int i = ArmourPiece::AP_MIN; i <= ArmourPiece::AP_MAX_EXCLUDING_SLINGER; i++) {
+			const ArmourPiece piece = static_cast<ArmourPiece>(i);
+			PartVisibilityMask& planned = plannedVisibility[piece];
+			if (!planned.any()) continue;
+
+			REApi::ManagedObject* mesh = getPieceMesh(piece);
+			const std::vector<MeshPart>& parts = *getPieceParts(piece);
+			PartVisibilityMask::diff(planned, committedVisibility[piece], [&](size_t partIdx, bool shown) {
+				out.push_back(PartCommand{ mesh, parts[partIdx].index, shown });
+			});
+
+			std::fill(planned.overridden.begin(), planned.overridden.end(), 0);
+			std::fill(planned.shown.begin(), planned.shown.end(), 0);
 		}
-		if (targetParts == nullptr) return false;
+	}
+
+	void PartManager::applyPlan() {
+		applyScratch.clear();
+		finishPlan(applyScratch);
+		commit(applyScratch);
+	}
 
-		// Only mask out visible items
-		for (const MeshPart& part : *targetParts) {
-			if (partOverrides.find(part) == partOverrides.end()) continue;
+	// Compiled once per (preset, piece) & reused until the preset's overrides for the piece are edited.
+	const PartVisibilityMask& PartManager::getCompiledMask(const Preset* preset, ArmourPiece piece, const std::vector<MeshPart>& parts) {
+		const PresetPieceSettings& settings = preset->getPieceSettings(piece);
+		const uint32_t pieceKey = static_cast<uint32_t>(piece);
 
-			bool vis = partOverrides.find(part)->shown;
-			REInvokeVoid(mesh, "setPartsEnable(System.UInt64, System.Boolean)", { (void*)part.index, (void*)vis });
+		if (const PartVisibilityMask* mask = compiledMasks.find(preset, pieceKey, settings.partOverridesGeneration, plansFinished)) return *mask;
+
+		// A new preset or an edit - compiling (re)sizes the mask & may grow the cache.
+		ALLOC_TRACKER_ALLOW(compileMaskScope);
+		return compiledMasks.compile(preset, pieceKey, settings.partOverridesGeneration, plansFinished, settings.partOverrides, parts);
+	}
+
+	REApi::ManagedObject* PartManager::getPieceMesh(ArmourPiece piece) const {
+		switch (piece) {
+		case ArmourPiece::AP_SET:  return baseMesh;
+		case ArmourPiece::AP_HELM: return helmMesh;
+		case ArmourPiece::AP_BODY: return bodyMesh;
+		case ArmourPiece::AP_ARMS: return armsMesh;
+		case ArmourPiece::AP_COIL: return coilMesh;
+		case ArmourPiece::AP_LEGS: return legsMesh;
+		default:                   return nullptr;
 		}
+	}
 
-		return true;
+	const std::vector<MeshPart>* PartManager::getPieceParts(ArmourPiece piece) const {
+		switch (piece) {
+		case ArmourPiece::AP_SET:  return &baseParts;
+		case ArmourPiece::AP_HELM: return &helmParts;
+		case ArmourPiece::AP_BODY: return &bodyParts;
+		case ArmourPiece::AP_ARMS: return &armsParts;
+		case ArmourPiece::AP_COIL: return &coilParts;
+		case ArmourPiece::AP_LEGS: return &legsParts;
+		default:                   return nullptr;
+		}
+	}
+
+	void PartManager::commit(const std::vector<PartCommand>& commands) {
+		for (const PartCommand& command : commands) {
+			REInvokeVoid(command.mesh, "setPartsEnable(System.UInt64, System.Boolean)", { (void*)command.index, (void*)command.shown });
+		}
 	}
 
 	bool PartManager::loadParts() {
@@ -114,6 +161,14 @@ namespace kbf {
 			dataManager->partCacheManager().cache(armourWithSex, legsParts, ArmourPiece::AP_LEGS);
 		}
 
+		// Masks are indexed by part order, so anything compiled against the old parts is meaningless now.
+		compiledMasks.clear();
+		for (int i = ArmourPiece::AP_MIN; i <= ArmourPiece::AP_MAX_EXCLUDING_SLINGER; i++) {
+			const ArmourPiece piece = static_cast<ArmourPiece>(i);
+			plannedVisibility[piece].reset(getPieceParts(piece)->size());
+			committedVisibility[piece].reset(getPieceParts(piece)->size());
+		}
+
 		return bodyParts.size() > 0;
 	}
 
@@ -150,4 +205,16 @@ namespace kbf {
 		}
 	}
 
+	size_t PartManager::getHeapBytes() const {
+		size_t bytes = footprint::armourInfoBytes(armourInfo);
+		for (const std::vector<MeshPart>* parts : { &baseParts, &helmParts, &bodyParts, &armsParts, &coilParts, &legsParts }) {
+			bytes += footprint::vectorBytes(*parts, footprint::meshPartBytes);
+		}
+		bytes += compiledMasks.getBytes();
+		for (const PartVisibilityMask& mask : plannedVisibility)   bytes += mask.getBytes();
+		for (const PartVisibilityMask& mask : committedVisibility) bytes += mask.getBytes();
+		bytes += applyScratch.capacity() * sizeof(PartCommand);
+		return bytes;
+	}
+
 }
\ No newline at end of file
@@ -4,9 +4,13 @@
 #include <kbf/data/armour/armour_info.hpp>
 #include <kbf/data/preset/preset.hpp>
 #include <kbf/data/mesh/parts/mesh_part.hpp>
+#include <kbf/mesh/apply_commands.hpp>
+#include <kbf/mesh/part_visibility_mask.hpp>
 
 #include <reframework/API.hpp>
 
+#include <array>
+
 using REApi = reframework::API;
 
 namespace kbf {
@@ -24,16 +28,33 @@ namespace kbf {
 			REApi::ManagedObject* legsTransform,
 			bool female);
 
-		bool applyPreset(const Preset* preset, ArmourPiece piece);
+		// Layers `preset`'s part overrides for `piece` onto this frame's plan - later calls win where they overlap.
+		//  No engine access; may run on a planner thread, but only one thread at a time per manager.
+		bool planPreset(const Preset* preset, ArmourPiece piece);
+		// Appends writes for the planned parts whose visibility differs from what was last committed, & clears the plan.
+		//  Assumes the writes do get committed - if they don't, the manager is thrown away with its character anyway.
+		void finishPlan(std::vector<PartCommand>& out);
+		// finishPlan & commit in one go, on the calling (game) thread.
+		void applyPlan();
+		// Game thread only.
+		static void commit(const std::vector<PartCommand>& commands);
 		bool loadParts();
 
 		bool isInitialized() const { return initialized; }
+		size_t getHeapBytes() const;
 
 	private:
 		//std::set<std::string> getPartNames(REApi::ManagedObject* jointArr) const;
 		//void DEBUG_printPartNames(REApi::ManagedObject* jointArr, std::string message) const;
 		bool getMesh(REApi::ManagedObject* transform, REApi::ManagedObject** out) const;
 		void getParts(REApi::ManagedObject* mesh, std::vector<MeshPart>& out) const;
+		REApi::ManagedObject* getPieceMesh(ArmourPiece piece) const;
+		const std::vector<MeshPart>* getPieceParts(ArmourPiece piece) const;
+		const PartVisibilityMask& getCompiledMask(const Preset* preset, ArmourPiece piece, const std::vector<MeshPart>& parts);
+
+		// Every this many plans, forget what was committed & write every planned part again, in case the game changed
+		//  one behind our back.
+		static constexpr uint32_t RESYNC_INTERVAL_PLANS = 30;
 
 		KBFDataManager* dataManager;
 		ArmourInfo armourInfo;
@@ -60,6 +81,13 @@ namespace kbf {
 		REApi::ManagedObject* armsMesh = nullptr;
 		REApi::ManagedObject* coilMesh = nullptr;
 		REApi::ManagedObject* legsMesh = nullptr;
+
+		CompiledPartMaskCache compiledMasks;
+		std::array<PartVisibilityMask, ArmourPiece::AP_MAX_EXCLUDING_SLINGER + 1> plannedVisibility;   // This frame's, by piece
+		std::array<PartVisibilityMask, ArmourPiece::AP_MAX_EXCLUDING_SLINGER + 1> committedVisibility; // As last written, by piece
+		uint64_t plansFinished = 0;
+
+		std::vector<PartCommand> applyScratch; // For applyPlan
 	};
 
 }
\ No newline at end of file
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <kbf/data/mesh/parts/mesh_part.hpp>
+#include <kbf/data/preset/override_mesh_part.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+namespace kbf {
+
+	// Visibility of one armour piece's parts as bits - bit i is the i'th part in the part cache's order (PartManager's
+	//  xxxParts vectors). `overridden` marks the parts that are set at all; `shown` which of those are shown, and is
+	//  always a subset of `overridden`. Parts outside `overridden` are left as the game has them.
+	struct PartVisibilityMask {
+		std::vector<uint64_t> overridden;
+		std::vector<uint64_t> shown;
+
+		static size_t wordCount(size_t partCount) { return (partCount + 63) / 64; }
+
+		// All clear, sized for `partCount` parts. Keeps capacity.
+		void reset(size_t partCount) {
+			overridden.assign(wordCount(partCount), 0);
+			shown.assign(wordCount(partCount), 0);
+		}
+
+		bool any() const {
+			return std::any_of(overridden.begin(), overridden.end(), [](uint64_t word) { return word != 0; });
+		}
+
+		// The desired visibility `overrides` describes for `parts` - what PartManager used to look up part by part,
+		//  every frame.
+		static void compile(const std::set<OverrideMeshPart>& overrides, const std::vector<MeshPart>& parts, PartVisibilityMask& out) {
+			out.reset(parts.size());
+			for (size_t i = 0; i < parts.size(); i++) {
+				const auto it = overrides.find(parts[i]);
+				if (it == overrides.end()) continue;
+
+				const uint64_t bit = uint64_t{ 1 } << (i % 64);
+				out.overridden[i / 64] |= bit;
+				if (it->shown) out.shown[i / 64] |= bit;
+			}
+		}
+
+		// Lays `top` over this mask - where both set a part, `top` wins, as it would have by being written last.
+		void layer(const PartVisibilityMask& top) {
+			for (size_t w = 0; w < overridden.size() && w < top.overridden.size(); w++) {
+				overridden[w] |= top.overridden[w];
+				shown[w] = (shown[w] & ~top.overridden[w]) | top.shown[w];
+			}
+		}
+
+		// Calls emit(partIdx, shown) for every part `desired` sets that `committed` doesn't hold in that state yet (in
+		//  part order), then records them in `committed`. Parts `committed` has never set always count as different.
+		template <typename Fn>
+		static void diff(const PartVisibilityMask& desired, PartVisibilityMask& committed, Fn&& emit) {
+			for (size_t w = 0; w < desired.overridden.size() && w < committed.overridden.size(); w++) {
+				uint64_t changed = desired.overridden[w] & (~committed.overridden[w] | (desired.shown[w] ^ committed.shown[w]));
+				while (changed != 0) {
+					const int bit = std::countr_zero(changed);
+					changed &= changed - 1;
+					emit(w * 64 + bit, (desired.shown[w] >> bit) & 1);
+				}
+
+				committed.overridden[w] |= desired.overridden[w];
+				committed.shown[w] = (committed.shown[w] & ~desired.overridden[w]) | desired.shown[w];
+			}
+		}
+
+		size_t getBytes() const {
+			return (overridden.capacity() + shown.capacity()) * sizeof(uint64_t);
+		}
+	};
+
+	// Compiled masks by (preset, piece), reused until that preset's part overrides are edited. Presets are edited in
+	//  place, so the preset pointer alone can't tell - every edit to a piece's overrides gives them a new generation
+	//  (PresetPieceSettings::partOverridesGeneration), & a mask compiled at another generation is stale. Checking is a
+	//  pointer & integer compare per entry, with nothing hashed per plan.
+	//  find() & compile() are split so callers can let the compile - the only part that allocates - off the heap check.
+	class CompiledPartMaskCache {
+	public:
+		// Entries not used for this many plans are free to be replaced.
+		static constexpr uint64_t STALE_PLANS = 600;
+
+		// The mask compiled for (owner, piece) at `generation`, or null if it needs compiling.
+		const PartVisibilityMask* find(const void* owner, uint32_t piece, uint64_t generation, uint64_t plan) {
+			Entry* entry = findEntry(owner, piece);
+			if (entry == nullptr || entry->generation != generation) return nullptr;
+			entry->lastUsedPlan = plan;
+			return &entry->mask;
+		}
+
+		// Compiles `overrides` over `parts` for (owner, piece), replacing a stale entry or an unused one where possible.
+		const PartVisibilityMask& compile(
+			const void* owner, uint32_t piece, uint64_t generation, uint64_t plan,
+			const std::set<OverrideMeshPart>& overrides, const std::vector<MeshPart>& parts
+		) {
+			Entry* entry = findEntry(owner, piece);
+			if (entry == nullptr) {
+				for (Entry& candidate : entries) {
+					if (candidate.lastUsedPlan + STALE_PLANS < plan) { entry = &candidate; break; }
+				}
+				if (entry == nullptr) entry = &entries.emplace_back();
+				entry->owner = owner;
+				entry->piece = piece;
+			}
+
+			PartVisibilityMask::compile(overrides, parts, entry->mask);
+			entry->generation   = generation;
+			entry->lastUsedPlan = plan;
+			compiles++;
+			return entry->mask;
+		}
+
+		size_t size() const { return entries.size(); }
+		uint64_t getCompiles() const { return compiles; }
+
+		size_t getBytes() const {
+			size_t bytes = entries.capacity() * sizeof(Entry);
+			for (const Entry& entry : entries) bytes += entry.mask.getBytes();
+			return bytes;
+		}
+
+	private:
+		struct Entry {
+			const void* owner        = nullptr; // Compared only, never dereferenced
+			uint32_t    piece        = 0;
+			uint64_t    generation   = 0;
+			uint64_t    lastUsedPlan = 0;
+			PartVisibilityMask mask;
+		};
+
+		Entry* findEntry(const void* owner, uint32_t piece) {
+			for (Entry& entry : entries) {
+				if (entry.owner == owner && entry.piece == piece) return &entry;
+			}
+			return nullptr;
+		}
+
+		std::vector<Entry> entries;
+		uint64_t compiles = 0;
+	};
+
+}
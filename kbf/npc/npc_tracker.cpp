@@ -11,12 +11,22 @@
 #include <kbf/util/re_engine/print_re_object.hpp>
 #include <kbf/data/armour/format_full_armour_id.hpp>
 #include <kbf/util/re_engine/find_transform.hpp>
+#include <kbf/util/re_engine/hot_properties.hpp>
 #include <kbf/util/re_engine/dump_components.hpp>
 #include <kbf/util/re_engine/re_memory_ptr.hpp>
+#include <kbf/util/memory/frame_arena.hpp>
 #include <kbf/debug/debug_stack.hpp>
+#include <kbf/data/data_footprint.hpp>
 #include <kbf/data/ids/special_armour_ids.hpp>
 
 #include <kbf/profiling/cpu_profiler.hpp>
+#include <kbf/profiling/frame_budget_controller.hpp>
+#include <kbf/profiling/alloc_tracker.hpp>
+#include <kbf/replay/tracker_recorder.hpp>
+
+#include <algorithm>
+#include <array>
+#include <limits>
 
 using REApi = reframework::API;
 
@@ -40,19 +50,28 @@ namespace kbf {
     }
 
     void NpcTracker::setupLists() {
-        bool gotNumNPCslots = getNpcListSize(npcListSize);
+        size_t listSize = 0;
+        bool gotNumNPCslots = getNpcListSize(listSize);
         if (!gotNumNPCslots) {
             DEBUG_STACK.fpush<LOG_TAG>(DebugStack::Color::COL_ERROR, "Failed to get NPC list from NPC Manager! NPC modifications will not function.");
         }
         else {
-            DEBUG_STACK.fpush<LOG_TAG>(DebugStack::Color::COL_SUCCESS, "Successfully fetched NPC list size: {}", npcListSize);
-            
+            DEBUG_STACK.fpush<LOG_TAG>(DebugStack::Color::COL_SUCCESS, "Successfully fetched NPC list size: {}", listSize);
+
+            // Hooks bounds check against npcListSize (acquire) on their own threads, so the event queue must exist before
+            //  it's published - the release store makes both visible to any hook that sees the new size.
+            npcEvents.reset(listSize);
+            npcEventQueued = std::make_unique<std::atomic<bool>[]>(listSize);
+            npcListSize.store(listSize, std::memory_order_release);
+
             // empty initialize arrays
-            npcsToFetch       .resize(npcListSize, false);
-			tryFetchCountTable.resize(npcListSize, 0);
-			npcInfos          .resize(npcListSize, std::nullopt);
-			persistentNpcInfos.resize(npcListSize, std::nullopt);
-			npcInfoCaches     .resize(npcListSize, std::nullopt);
+            npcsToFetch       .resize(listSize, false);
+            fetchRetries      .resize(listSize);
+            applyScheduler    .resize(listSize);
+            pointerValidity   .resize(listSize);
+			npcInfos          .resize(listSize, std::nullopt);
+			persistentNpcInfos.resize(listSize, std::nullopt);
+			npcInfoCaches     .resize(listSize, std::nullopt);
         }
     }
 
@@ -79,12 +98,110 @@ namespace kbf {
 		return std::vector<size_t>(npcSlotTable.begin(), npcSlotTable.end());
     }
 
+    MemoryFootprint NpcTracker::getMemoryFootprint() const {
+        MemoryFootprint report{ "NPC Tracker", 0, sizeof(*this) };
+
+        const auto countPopulated = [](const auto& infos) {
+            return static_cast<size_t>(std::count_if(infos.begin(), infos.end(), [](const auto& info) { return info.has_value(); }));
+        };
+
+        report.add(MemoryFootprint{ "NPC Infos", countPopulated(npcInfos), footprint::vectorBytes(npcInfos, [](const auto& info) {
+            return info.has_value() ? footprint::stringBytes(info->prefabPath) : 0;
+        }) });
+        report.add(MemoryFootprint{ "Persistent NPC Infos", countPopulated(persistentNpcInfos), footprint::vectorBytes(persistentNpcInfos, [](const auto& pInfo) {
+            if (!pInfo.has_value()) return size_t{ 0 };
+            return footprint::armourInfoBytes(pInfo->armourInfo)
+                + (pInfo->boneManager     ? pInfo->boneManager->getHeapBytes()     : 0)
+                + (pInfo->partManager     ? pInfo->partManager->getHeapBytes()     : 0)
+                + (pInfo->materialManager ? pInfo->materialManager->getHeapBytes() : 0);
+        }) });
+
+        size_t cacheBytes = footprint::vectorBytes(npcInfoCaches, [](const auto& cache) {
+            return cache.has_value() ? footprint::stringBytes(cache->prefabPath) : 0;
+        });
+        for (const auto* mainMenuCache : { &mainMenuAlmaCache, &mainMenuErikCache }) {
+            if (mainMenuCache->has_value()) cacheBytes += footprint::stringBytes((*mainMenuCache)->prefabPath);
+        }
+        report.add(MemoryFootprint{ "NPC Caches", countPopulated(npcInfoCaches), cacheBytes });
+
+        report.add(MemoryFootprint{ "Slot Tables", npcSlotTable.size() + applyScheduler.delayedCount(),
+            footprint::hashContainerBytes(npcSlotTable)
+            + applyScheduler.getBytes()
+            + footprint::vectorBytes(npcsToFetch)
+            + fetchRetries.size() * sizeof(FetchRetryScheduler::SlotState) });
+
+        const size_t listSize = npcListSize.load(std::memory_order_relaxed);
+        report.add(MemoryFootprint{ "Hook Event Queue", listSize, npcEvents.getBytes() + listSize * sizeof(std::atomic<bool>) });
+
+        return report;
+    }
+
     void NpcTracker::updateNpcs() {
         fetchNpcs();
         updateApplyDelays();
+        if (TRACKER_RECORDER.isRecording()) recordInputs();
+        publishSnapshot();
+        if (memoryFootprintRequested.exchange(false, std::memory_order_relaxed)) publishMemoryFootprint();
+    }
+
+    void NpcTracker::publishMemoryFootprint() {
+        // Only on request from the debug tab, so a rebuilt report is fine.
+        ALLOC_TRACKER_ALLOW(memoryFootprintScope);
+        memoryFootprints.back() = getMemoryFootprint();
+        memoryFootprints.publish();
+    }
+
+    void NpcTracker::publishSnapshot() {
+        NpcTrackerSnapshot& snapshot = snapshots.back();
+        snapshot.frame = snapshots.getPublished() + 1;
+
+        // Assign over the previous contents rather than rebuilding, so steady state doesn't allocate.
+        size_t count = 0;
+        for (size_t i = 0; i < npcInfos.size(); i++) {
+            if (!npcInfos[i].has_value()) continue;
+            if (count == snapshot.npcs.size()) snapshot.npcs.emplace_back();
+
+            NpcSnapshot& npc = snapshot.npcs[count++];
+            npc.info = *npcInfos[i];
+
+            const std::optional<PersistentNpcInfo>& pInfo = persistentNpcInfos[i];
+            if (!pInfo.has_value()) {
+                npc.persistent.reset();
+                continue;
+            }
+
+            PersistentNpcSnapshot& persistent = npc.persistent.has_value() ? *npc.persistent : npc.persistent.emplace();
+            persistent.armourInfo = pInfo->armourInfo;
+        }
+        snapshot.npcs.resize(count);
+
+        snapshot.health.capture(fetchRetries, pointerValidity);
+
+        snapshots.publish();
+    }
+
+    void NpcTracker::recordInputs() const {
+        for (size_t i = 0; i < npcInfos.size(); i++) {
+            TrackedSlotState state{};
+            if (npcInfos[i].has_value()) {
+                const NpcInfo& info = *npcInfos[i];
+                state.occupied   = true;
+                state.female     = info.female;
+                state.visible    = info.visible;
+                state.fetched    = persistentNpcInfos[i].has_value();
+                state.distanceSq = info.distanceFromCameraSq;
+                state.id         = info.prefabPath;
+
+                auto deadline = applyScheduler.getDelayDeadline(static_cast<uint32_t>(i));
+                if (deadline.has_value()) state.applyDelayStamp = deadline->time_since_epoch().count();
+            }
+            TRACKER_RECORDER.recordSlot(TrackedCharacterKind::NPC, i, state);
+        }
     }
 
     void NpcTracker::applyPresets() {
+        pointerValidity.beginFrame(dataManager.settings().pointerRecheckInterval);
+
         bool inQuest = SituationWatcher::inSituation(isinQuestPlayingasGuest) || SituationWatcher::inSituation(isinQuestPlayingasHost);
         if (dataManager.settings().enableDuringQuestsOnly && !inQuest) return;
 
@@ -93,41 +210,34 @@ namespace kbf {
         const bool hasPreview = previewedPreset != nullptr;
         const bool applyPreviewUnconditional = hasPreview && previewedPreset->armour == ArmourSet::DEFAULT;
 
-		// Only apply to first n NPCs based on distance to camera
-        const int maxNPCsToApply = std::max<int>(dataManager.settings().maxConcurrentApplications, 0);
+        // Pick up hooks that fired since the fetch, so NPCs that just warped / reloaded aren't applied to this frame.
+        drainNpcEvents();
+
+		// Only apply to the first n visible NPCs in range, based on distance to camera
+        const FrameBudgetLimits limits = FRAME_BUDGET.getLimits(dataManager.settings());
+        const int maxNPCsToApply = std::max<int>(limits.maxConcurrentApplications, 0);
 
-        // Copy slot IDs into a sortable vector
-        std::vector<size_t> npcs;
+        // Copy slot IDs into a sortable vector - per frame, so on the frame arena
+        std::pmr::vector<size_t> npcs{ &FrameArena::local() };
         npcs.reserve(npcSlotTable.size());
 
         for (size_t idx : npcSlotTable)
             npcs.emplace_back(idx);
 
-        if (maxNPCsToApply > 0) {
-            // Partially select closest N NPCs by distance
-            std::nth_element(
-                npcs.begin(),
-                npcs.begin() + std::min<size_t>(maxNPCsToApply, npcs.size()),
-                npcs.end(),
-                [&](size_t a, size_t b) {
-                    return npcInfos[a]->distanceFromCameraSq < npcInfos[b]->distanceFromCameraSq;
-                }
-            );
+        // Cull invisible / out of range NPCs & partially select the closest N of the rest
+        applyScheduler.beginSelection();
+        for (uint32_t i = 0; i < npcs.size(); i++) {
+            const std::optional<NpcInfo>& info = npcInfos[npcs[i]];
+            applyScheduler.addCandidate(i, info && info->visible, info ? info->distanceFromCameraSq : 0.0f);
         }
-
-        size_t npcLimit = maxNPCsToApply > 0 ? std::min<size_t>(maxNPCsToApply, npcs.size()) : npcs.size();
+        size_t npcLimit = applyScheduler.select(limits.applicationRange, maxNPCsToApply);
 
         // Apply only to the N closest
         for (size_t i = 0; i < npcLimit; ++i) {
-            size_t idx = npcs[i];
+            size_t idx = npcs[applyScheduler.selectedId(i)];
 
             if (!npcInfos[idx].has_value()) continue;
-            if (npcApplyDelays[idx] && npcApplyDelays[idx].has_value()) continue;
-
-            if (!npcInfos[idx].has_value()) {
-                npcApplyDelays.erase(idx);
-                continue;
-            }
+            if (applyScheduler.isDelayed(static_cast<uint32_t>(idx))) continue;
 
             const NpcInfo& info = npcInfos[idx].value();
             if (!info.visible) continue;
@@ -135,14 +245,20 @@ namespace kbf {
 			if (!persistentNpcInfos[idx].has_value()) continue;
 
 			PersistentNpcInfo& pInfo = persistentNpcInfos[idx].value();
-            if (!pInfo.areSetPointersValid()) {
-                persistentNpcInfos[idx] = std::nullopt;
-                continue;
+            if (pointerValidity.needsCheck(idx, info.pointers.Transform)) {
+                const bool valid = pInfo.areSetPointersValid();
+                pointerValidity.recordCheck(idx, valid, info.pointers.Transform);
+                if (!valid) {
+                    persistentNpcInfos[idx] = std::nullopt;
+                    continue;
+                }
             }
 
             if (pInfo.boneManager && pInfo.partManager) {
                 // Always apply base presets when they are present, but refrain from re-applying the same base preset multiple times.
-                std::unordered_set<std::string> presetBasesApplied{};
+                std::array<const Preset*, ArmourPiece::AP_MAX_EXCLUDING_SLINGER + 1> presetBasesApplied{};
+                size_t presetBasesAppliedCount = 0;
+                bool slotCleared = false;
 
                 for (ArmourPiece piece = ArmourPiece::AP_MIN_EXCLUDING_SET; piece <= ArmourPiece::AP_MAX_EXCLUDING_SLINGER; piece = static_cast<ArmourPiece>(static_cast<int>(piece) + 1)) {
                     std::optional<ArmourSet>& armourPiece = pInfo.armourInfo.getPiece(piece);
@@ -160,32 +276,40 @@ namespace kbf {
 
                         BoneManager::BoneApplyStatusFlag applyFlag = pInfo.boneManager->applyPreset(activePreset, piece);
                         bool invalidBones = applyFlag == BoneManager::BoneApplyStatusFlag::BONE_APPLY_ERROR_INVALID_BONE;
-                        if (invalidBones) { clearNpcSlot(idx); npcsToFetch[idx] = true; break; }
+                        if (invalidBones) { clearNpcSlot(idx); npcsToFetch[idx] = true; slotCleared = true; break; }
 
-                        pInfo.partManager->applyPreset(setWidePartsPreset, piece); // Apply set-wide part overrides first
-                        pInfo.partManager->applyPreset(activePreset, piece);
+                        pInfo.partManager->planPreset(setWidePartsPreset, piece); // Apply set-wide part overrides first
+                        pInfo.partManager->planPreset(activePreset, piece);
                         pInfo.materialManager->applyPreset(setWideMatsPreset, piece); // Apply set-wide material overrides first
 						pInfo.materialManager->applyPreset(activePreset, piece);
 
-                        if (!invalidBones && activePreset->set.hasModifiers() && !presetBasesApplied.contains(activePreset->uuid)) {
-                            presetBasesApplied.insert(activePreset->uuid);
+                        const auto basesEnd = presetBasesApplied.begin() + presetBasesAppliedCount;
+                        if (!invalidBones && activePreset->set.hasModifiers() && std::find(presetBasesApplied.begin(), basesEnd, activePreset) == basesEnd) {
+                            presetBasesApplied[presetBasesAppliedCount++] = activePreset;
                             BoneManager::BoneApplyStatusFlag baseApplyFlag = pInfo.boneManager->applyPreset(activePreset, AP_SET);
                             bool invalidBaseBones = baseApplyFlag == BoneManager::BoneApplyStatusFlag::BONE_APPLY_ERROR_INVALID_BONE;
-                            if (invalidBaseBones) { clearNpcSlot(idx); npcsToFetch[idx] = true; break; }
+                            if (invalidBaseBones) { clearNpcSlot(idx); npcsToFetch[idx] = true; slotCleared = true; break; }
                         }
                     }
                 }
+
+                // Only the parts whose visibility actually changes get written
+                if (!slotCleared) pInfo.partManager->applyPlan();
             }
         }
 	}
 
     void NpcTracker::reset() {
+        TRACKER_RECORDER.recordReset(TrackedCharacterKind::NPC);
+
         npcSlotTable.clear();
-        npcApplyDelays.clear();
+        applyScheduler.cancelAll();
+        pointerValidity.invalidateAll();
         for (auto& p : npcInfos)           p.reset();
         for (auto& p : persistentNpcInfos) p.reset();
 
 		std::fill(npcsToFetch.begin(), npcsToFetch.end(), false);
+        fetchRetries.resetAll();
 
         mainMenuAlmaCache = std::nullopt;
         mainMenuErikCache = std::nullopt;
@@ -247,7 +371,8 @@ namespace kbf {
 
             bool fetchedPInfo = fetchNpcs_MainMenu_PersistentInfo(almaInfo, almaPInfo);
             if (fetchedPInfo) {
-                npcApplyDelays[almaIdx] = std::chrono::high_resolution_clock::now();
+                startApplyDelay(almaIdx);
+                pointerValidity.invalidate(almaIdx);
                 persistentNpcInfos[almaIdx] = std::move(almaPInfo);
             }
         }
@@ -262,7 +387,8 @@ namespace kbf {
 
             bool fetchedPInfo = fetchNpcs_MainMenu_PersistentInfo(erikInfo, erikPInfo);
             if (fetchedPInfo) {
-                npcApplyDelays[erikIdx] = std::chrono::high_resolution_clock::now();
+                startApplyDelay(erikIdx);
+                pointerValidity.invalidate(erikIdx);
                 persistentNpcInfos[erikIdx] = std::move(erikPInfo);
             }
         }
@@ -349,7 +475,7 @@ namespace kbf {
                 REApi::ManagedObject* gameObject = REInvokePtr<REApi::ManagedObject>(transform, "get_GameObject", {});
                 if (gameObject == nullptr) continue;
 
-                std::string name = REInvokeStr(gameObject, "get_Name", {});
+                std::string_view name = REInvokeStrView(gameObject, "get_Name", {});
 
                 static const REApi::ManagedObject* volumeocludeeType = REApi::get()->typeof("via.render.VolumeOccludee");
                 static const REApi::ManagedObject* meshBoundaryType = REApi::get()->typeof("ace.MeshBoundary");
@@ -430,10 +556,11 @@ namespace kbf {
     }
 
     void NpcTracker::fetchNpcs_NormalGameplay() {
-        std::unique_lock lock(fetchListMutex);
+        drainNpcEvents();
 
         const bool useCache = !needsAllNpcFetch;
-        for (size_t i = 0; i < npcListSize; i++) {
+        const size_t listSize = npcListSize.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < listSize; i++) {
             if (needsAllNpcFetch || npcSlotTable.contains(i) || npcsToFetch[i]) {
                 fetchNpcs_NormalGameplay_SingleNpc(i, useCache);
             }
@@ -466,11 +593,18 @@ namespace kbf {
             END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "NPC Fetch - Normal Gameplay - Basic Info");
         }
 
+        const FetchRetryScheduler::Clock::time_point now = FetchRetryScheduler::Clock::now();
         if (!usedCache) {
+            // The cache went stale, so whatever the last pointer check vouched for may have gone with it.
+            if (cacheExists && !cacheValid) pointerValidity.invalidate(i);
+
+            // NPCs that haven't come up yet (e.g. no transform) wait out their backoff before the next full basic fetch.
+            if (!npcSlotTable.contains(i) && !fetchRetries.isDue(i, now)) return;
+
             BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "NPC Fetch - Normal Gameplay - Basic Info");
             NpcFetchFlags fetchFlags = fetchNpc_BasicInfo(i, info);
             if (fetchFlags == NpcFetchFlags::FETCH_ERROR_NULL) {
-                if (!npcSlotTable.contains(i)) tryFetchCountTable[i] = 0;
+                if (!npcSlotTable.contains(i)) fetchRetries.reset(i);
                 npcInfoCaches[i] = NormalGameplayNpcCache{ .cacheIsEmpty = true };
                 END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "NPC Fetch - Normal Gameplay - Basic Info");
                 return;
@@ -480,7 +614,7 @@ namespace kbf {
                 return;
             }
             if (info.pointers.Transform == nullptr) {
-                tryFetchCountTable[i]++; 
+                fetchRetries.recordFailure(i, FetchFailure::MISSING_TRANSFORM, now);
                 npcInfoCaches[i] = NormalGameplayNpcCache{ .cacheIsEmpty = true };
                 END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "NPC Fetch - Normal Gameplay - Basic Info");
                 return;
@@ -492,6 +626,8 @@ namespace kbf {
             newCache.Transform       = info.pointers.Transform;
             newCache.Motion          = info.optionalPointers.Motion;
             newCache.HunterCharacter = info.optionalPointers.HunterCharacter;
+            // A refetch landing on a different transform means the pointer set last checked belonged to someone else.
+            if (cacheExists && npcInfoCaches[i]->Transform != newCache.Transform) pointerValidity.invalidate(i);
             npcInfoCaches[i] = newCache;
             END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "NPC Fetch - Normal Gameplay - Basic Info");
         }
@@ -502,17 +638,22 @@ namespace kbf {
         END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "NPC Fetch - Normal Gameplay - Visibility");
         // ----------------------------------------------------------------------------------------------------------
 
-        if (info.visible && !persistentNpcInfos[i].has_value() && tryFetchCountTable[i] < TRY_FETCH_LIMIT) {
+        if (info.visible && !persistentNpcInfos[i].has_value() && fetchRetries.isDue(i, now)) {
             BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "NPC Fetch - Normal Gameplay - Persistent Info");
 
             PersistentNpcInfo persistentInfo{};
             persistentInfo.index = i;
 
-            bool fetchedPInfo = fetchNpc_PersistentInfo(i, info, persistentInfo);
-            if (fetchedPInfo) {
-                npcApplyDelays[i] = std::chrono::high_resolution_clock::now();
+            FetchFailure failure = fetchNpc_PersistentInfo(i, info, persistentInfo);
+            if (failure == FetchFailure::NONE) {
+                startApplyDelay(i);
+                pointerValidity.invalidate(i);
                 persistentNpcInfos[i] = std::move(persistentInfo);
-                tryFetchCountTable[i] = 0; // Reset try count on success
+                fetchRetries.recordSuccess(i);
+            }
+            else if (fetchRetries.recordFailure(i, failure, now)) {
+                DEBUG_STACK.fpush<LOG_TAG>(DebugStack::Color::COL_WARNING, "Failed to fetch NPC [{}] {} times (last: {}). The NPC is probably invalid, skipping for now...",
+                    i, FetchRetryScheduler::GIVE_UP_AFTER, fetchFailureName(failure));
             }
 
             END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "NPC Fetch - Normal Gameplay - Persistent Info");
@@ -588,76 +729,46 @@ namespace kbf {
         return NpcFetchFlags::FETCH_SUCCESS;
     }
 
-    bool NpcTracker::fetchNpc_PersistentInfo(size_t i, const NpcInfo& info, PersistentNpcInfo& pInfo) {
-        if (frameBoneFetchCount != 0 && frameBoneFetchCount >= dataManager.settings().maxBoneFetchesPerFrame) return false;
+    FetchFailure NpcTracker::fetchNpc_PersistentInfo(size_t i, const NpcInfo& info, PersistentNpcInfo& pInfo) {
+        if (frameBoneFetchCount != 0 && frameBoneFetchCount >= FRAME_BUDGET.getLimits(dataManager.settings()).maxBoneFetchesPerFrame) return FetchFailure::FRAME_BUDGET;
 
         BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "NPC Fetch - Normal Gameplay - Equipped Armours");
         bool fetchedArmour = fetchNpc_EquippedArmourSet(info, pInfo);
         END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "NPC Fetch - Normal Gameplay - Equipped Armours");
-        if (!fetchedArmour) {
-            tryFetchCountTable[i]++;
-            if (tryFetchCountTable[i] >= TRY_FETCH_LIMIT) {
-                DEBUG_STACK.fpush<LOG_TAG>(DebugStack::Color::COL_WARNING, "Failed to find NPC [{}] Armour info {} times. The NPC is probably invalid, skipping for now...", i, TRY_FETCH_LIMIT);
-            }
-            return false;
-        }
+        if (!fetchedArmour) return FetchFailure::ARMOUR_INFO;
 
         BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "NPC Fetch - Normal Gameplay - Armour Transforms");
         bool fetchedArmourTransforms = fetchNpc_ArmourTransforms(info, pInfo);
         END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "NPC Fetch - Normal Gameplay - Armour Transforms");
-        if (!fetchedArmourTransforms) {
-            tryFetchCountTable[i]++;
-            if (tryFetchCountTable[i] >= TRY_FETCH_LIMIT) {
-                DEBUG_STACK.fpush<LOG_TAG>(DebugStack::Color::COL_WARNING, "Failed to find NPC [{}] Armour Transforms {} times. The NPC is probably invalid, skipping for now...", i, TRY_FETCH_LIMIT);
-            }
-            return false;
-        }
+        if (!fetchedArmourTransforms) return FetchFailure::ARMOUR_TRANSFORMS;
 
         BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "NPC Fetch - Normal Gameplay - Bones");
         bool fetchedBones = fetchNpc_Bones(info, pInfo);
         END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "NPC Fetch - Normal Gameplay - Bones");
-        if (!fetchedBones) {
-            tryFetchCountTable[i]++;
-            if (tryFetchCountTable[i] >= TRY_FETCH_LIMIT) {
-                DEBUG_STACK.fpush<LOG_TAG>(DebugStack::Color::COL_WARNING, "Failed to find NPC [{}] Bones {} times. The NPC is probably invalid, skipping for now...", i, TRY_FETCH_LIMIT);
-            }
-            return false;
-        }
+        if (!fetchedBones) return FetchFailure::BONES;
 
         BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "NPC Fetch - Normal Gameplay - Parts");
         bool fetchedParts = fetchNpc_Parts(info, pInfo);
         END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "NPC Fetch - Normal Gameplay - Parts");
-        if (!fetchedParts) {
-            tryFetchCountTable[i]++;
-            if (tryFetchCountTable[i] >= TRY_FETCH_LIMIT) {
-                DEBUG_STACK.fpush<LOG_TAG>(DebugStack::Color::COL_WARNING, "Failed to find NPC [{}] Parts {} times. The NPC is probably invalid, skipping for now...", i, TRY_FETCH_LIMIT);
-            }
-            return false;
-        }
+        if (!fetchedParts) return FetchFailure::PARTS;
 
         BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "NPC Fetch - Normal Gameplay - Materials");
         bool fetchedMats = fetchNpc_Materials(info, pInfo);
         END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "NPC Fetch - Normal Gameplay - Materials");
-        if (!fetchedMats) {
-            tryFetchCountTable[i]++;
-            if (tryFetchCountTable[i] >= TRY_FETCH_LIMIT) {
-                DEBUG_STACK.fpush<LOG_TAG>(DebugStack::Color::COL_WARNING, "Failed to find NPC [{}] Materials {} times. The NPC is probably invalid, skipping for now...", i, TRY_FETCH_LIMIT);
-            }
-            return false;
-        }
+        if (!fetchedMats) return FetchFailure::MATERIALS;
 
         frameBoneFetchCount++; // Consider moving this to top to limit effect of failed fetches - may make fetches inaccessible if there are enough errors though.
-        return true;
+        return FetchFailure::NONE;
     }
 
     void NpcTracker::fetchNpc_Visibility(NpcInfo& info) {
         info.visible = false;
         info.distanceFromCameraSq = FLT_MAX;
 
-        bool motionSkipped = REInvoke<bool>(info.optionalPointers.Motion, "get_SkipUpdate", {}, InvokeReturnType::BOOL);
+        bool motionSkipped = MOTION_SKIP_UPDATE.read(info.optionalPointers.Motion);
         if (motionSkipped) return;
 
-        const float& distThreshold = dataManager.settings().applicationRange;
+        const float distThreshold = FRAME_BUDGET.getLimits(dataManager.settings()).applicationRange;
         double sqDist = REInvoke<double>(info.optionalPointers.HunterCharacter, "getCameraDistanceSqXZ", {}, InvokeReturnType::DOUBLE);
         if (distThreshold > 0 && sqDist > distThreshold * distThreshold) return;
 
@@ -693,7 +804,8 @@ namespace kbf {
                     if (auto setId = dataMgr.getArmourSetIDFromArmourSet(*optPiece))
                         return findTransform(
                             info.pointers.Transform,
-                            dataMgr.getPrefabNameFromArmourSetID(*setId, piece, info.female)
+                            dataMgr.getPrefabNameFromArmourSetID(*setId, piece, info.female),
+                            "NpcArmour"
                         );
 
                     return nullptr;
@@ -815,9 +927,11 @@ namespace kbf {
 
     void NpcTracker::clearNpcSlot(size_t index) {
         if (index >= npcInfos.size()) return;
+        fetchRetries.reset(index);
+        applyScheduler.cancelDelay(static_cast<uint32_t>(index));
+        pointerValidity.invalidate(index);
         if (npcInfos[index]) {
             npcSlotTable.erase(index);
-            tryFetchCountTable[index] = 0;
             npcInfoCaches[index]      = std::nullopt;
             npcInfos[index]           = std::nullopt;
             persistentNpcInfos[index] = std::nullopt;
@@ -857,18 +971,13 @@ namespace kbf {
         return scene;
     }
 
-    void NpcTracker::updateApplyDelays() {
-        std::vector<size_t> timestampsExpired{};
-        std::chrono::steady_clock::time_point now = std::chrono::high_resolution_clock::now();
-
-        for (const auto& [npcIdx, optTimestamp] : npcApplyDelays) {
-            if (!optTimestamp.has_value()) continue;
+    void NpcTracker::startApplyDelay(size_t index) {
+        applyScheduler.startDelay(static_cast<uint32_t>(index), ApplyScheduler::Clock::now(), dataManager.settings().delayOnEquip);
+    }
 
-            double durationMs = std::chrono::duration<double, std::milli>(now - optTimestamp.value()).count();
-            if (durationMs >= dataManager.settings().delayOnEquip * 1000.0f) {
-                npcApplyDelays[npcIdx] = std::nullopt;
-            }
-        }
+    void NpcTracker::updateApplyDelays() {
+        // Expired slots simply stop being delayed, which is all applyPresets checks for.
+        applyScheduler.advance(ApplyScheduler::Clock::now());
     }
 
     int NpcTracker::onNpcChangeStateHook(int argc, void** argv, REFrameworkTypeDefinitionHandle* arg_tys, unsigned long long ret_addr) {
@@ -901,15 +1010,35 @@ namespace kbf {
         if (idxPtr == nullptr) return REFRAMEWORK_HOOK_CALL_ORIGINAL;
         int idx = *idxPtr;
 
-        if (idx < 0 || idx >= npcListSize) return REFRAMEWORK_HOOK_CALL_ORIGINAL;
+        // Pairs with the release in setupLists - a hook that sees the size also sees the queue & flags it guards.
+        if (idx < 0 || static_cast<size_t>(idx) >= npcListSize.load(std::memory_order_acquire)) return REFRAMEWORK_HOOK_CALL_ORIGINAL;
 
-        {
-            std::unique_lock lock(fetchListMutex);
-            clearNpcSlot(idx);
-            npcsToFetch[idx] = true;
+        // Already queued since the last drain - the refetch it causes covers this one too.
+        if (npcEventQueued[idx].exchange(true, std::memory_order_acq_rel)) return REFRAMEWORK_HOOK_CALL_ORIGINAL;
+
+        if (!npcEvents.tryPush(static_cast<uint32_t>(idx))) {
+            npcEventQueued[idx].store(false, std::memory_order_release);
+            npcEventsOverflowed.store(true, std::memory_order_release);
         }
 
         return REFRAMEWORK_HOOK_CALL_ORIGINAL;
     }
 
+    void NpcTracker::drainNpcEvents() {
+        npcEvents.drain([this](uint32_t idx) {
+            // Cleared before handling, so a hook firing from here on queues the NPC again.
+            npcEventQueued[idx].store(false, std::memory_order_release);
+
+            clearNpcSlot(idx);
+            npcsToFetch[idx] = true;
+            TRACKER_RECORDER.recordRefetch(TrackedCharacterKind::NPC, idx);
+        });
+
+        // Shouldn't happen given the dedupe, but if an event was ever lost, fall back to refetching everyone.
+        if (npcEventsOverflowed.exchange(false, std::memory_order_acq_rel)) {
+            DEBUG_STACK.fpush<LOG_TAG>(DebugStack::Color::COL_WARNING, "NPC hook event queue overflowed, refetching all NPCs.");
+            needsAllNpcFetch = true;
+        }
+    }
+
 }
\ No newline at end of file
@@ -1,24 +1,29 @@
 #pragma once
 
 #include <kbf/debug/debug_stack.hpp>
+#include <kbf/debug/memory_footprint.hpp>
+#include <kbf/util/algorithm/apply_scheduler.hpp>
+#include <kbf/util/concurrency/mpsc_queue.hpp>
+#include <kbf/util/concurrency/snapshot_buffer.hpp>
+#include <kbf/util/algorithm/fetch_retry_scheduler.hpp>
+#include <kbf/util/re_engine/pointer_validity_cache.hpp>
 #include <kbf/npc/npc_info.hpp>
 #include <kbf/npc/persistent_npc_info.hpp>
 #include <kbf/npc/npc_cache.hpp>
 #include <kbf/npc/npc_fetch_flags.hpp>
+#include <kbf/npc/npc_tracker_snapshot.hpp>
 #include <kbf/situation/lobby_type.hpp>
 #include <kbf/situation/custom_situation.hpp>
 
+#include <atomic>
+#include <memory>
 #include <unordered_set>
 
 #include <kbf/util/re_engine/re_singleton.hpp>
 
-// UPDATE NOTE: This size may change with future updates.
-
-#define TRY_FETCH_LIMIT 100
-
 namespace kbf {
 
-    class NpcTracker {
+    class NpcTracker : public iMemoryReporter {
     public:
         NpcTracker(KBFDataManager& dataManager) : dataManager{ dataManager } { initialize(); };
 
@@ -34,6 +39,19 @@ namespace kbf {
 		const std::optional<PersistentNpcInfo>& getPersistentNpcInfo(size_t idx) const { return persistentNpcInfos.at(idx); }
         std::optional<PersistentNpcInfo>& getPersistentNpcInfo(size_t idx) { return persistentNpcInfos.at(idx); }
 
+        // GUI thread only. The newest state published by the update thread - never waits on it, & the reference stays
+        //  unchanged until the next readSnapshot().
+        const NpcTrackerSnapshot& readSnapshot() { return snapshots.read(); }
+
+        // GUI thread. Asks the update thread to re-measure getMemoryFootprint() - the containers it walks are only safe to
+        //  read there. The result lands in readMemoryFootprint() after the next update, bumping getMemoryFootprints().
+        void requestMemoryFootprint() { memoryFootprintRequested.store(true, std::memory_order_relaxed); }
+        const MemoryFootprint& readMemoryFootprint() { return memoryFootprints.read(); } // GUI thread only
+        uint64_t getMemoryFootprints() const { return memoryFootprints.getPublished(); }
+
+        // Update thread only, see requestMemoryFootprint().
+        MemoryFootprint getMemoryFootprint() const override;
+
     private:
         void initialize();
         void setupLists();
@@ -41,7 +59,7 @@ namespace kbf {
 
 		KBFDataManager& dataManager;
         static NpcTracker* g_instance;
-		size_t npcListSize = 0;
+		std::atomic<size_t> npcListSize = 0; // Read by the onNpcChangeState hook, off the update thread
 
         void fetchNpcs();
         void fetchNpcs_MainMenu();
@@ -51,7 +69,7 @@ namespace kbf {
         void fetchNpcs_NormalGameplay();
         void fetchNpcs_NormalGameplay_SingleNpc(size_t i, bool useCache);
         NpcFetchFlags fetchNpc_BasicInfo(size_t i, NpcInfo& out);
-        bool fetchNpc_PersistentInfo(size_t i, const NpcInfo& info, PersistentNpcInfo& pInfo);
+        FetchFailure fetchNpc_PersistentInfo(size_t i, const NpcInfo& info, PersistentNpcInfo& pInfo);
 		void fetchNpc_Visibility(NpcInfo& info);
         bool fetchNpc_EquippedArmourSet(const NpcInfo& info, PersistentNpcInfo& pInfo);
 		bool fetchNpc_ArmourTransforms(const NpcInfo& info, PersistentNpcInfo& pInfo, bool searchTransforms = false);
@@ -65,22 +83,37 @@ namespace kbf {
         REApi::ManagedObject* getVolumeOccludeeComponentExhaustive(REApi::ManagedObject* obj, const char* nameFilter) const;
         REApi::ManagedObject* getCurrentScene() const;
 
+		void startApplyDelay(size_t index);
 		void updateApplyDelays();
+		void recordInputs() const;
+		void publishSnapshot();
+		void publishMemoryFootprint();
 
         static int onNpcChangeStateHook(int argc, void** argv, REFrameworkTypeDefinitionHandle* arg_tys, unsigned long long ret_addr);
         int onNpcChangeState(REApi::ManagedObject* app_NpcCharacterCore);
+        void drainNpcEvents();
 
-        std::mutex fetchListMutex;
+        // Hooks only queue the NPC index; the slot is cleared & refetched when the frame update drains the queue.
+        //  An index already queued (and not yet drained) isn't queued again, so the queue can never hold more than
+        //  npcListSize entries & pushes never fail.
+        MpscQueue<uint32_t> npcEvents;
+        std::unique_ptr<std::atomic<bool>[]> npcEventQueued;
+        std::atomic<bool> npcEventsOverflowed = false;
 
         std::unordered_set<size_t> npcSlotTable{};
         std::vector<bool> npcsToFetch;
-        std::vector<size_t> tryFetchCountTable{};
-        std::unordered_map<size_t, std::optional<std::chrono::steady_clock::time_point>> npcApplyDelays{};
+        FetchRetryScheduler fetchRetries{};
+        ApplyScheduler applyScheduler{}; // Apply delays by slot index & the per-frame nearest-N selection
+        PointerValidityCache pointerValidity{ 7 }; // Pointers checked by PersistentNpcInfo::areSetPointersValid
         std::vector<std::optional<NpcInfo>> npcInfos;
 		std::vector<std::optional<PersistentNpcInfo>> persistentNpcInfos;
 
         std::vector<std::optional<NormalGameplayNpcCache>> npcInfoCaches;
 
+        SnapshotBuffer<NpcTrackerSnapshot> snapshots;
+        SnapshotBuffer<MemoryFootprint> memoryFootprints;
+        std::atomic<bool> memoryFootprintRequested{ false };
+
         // Main Menu Refs
         RENativeSingleton sceneManager{ "via.SceneManager" };
         RESingleton saveDataManager{ "app.SaveDataManager" };
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <kbf/npc/npc_info.hpp>
+#include <kbf/data/armour/armour_info.hpp>
+#include <kbf/profiling/tracker_health_snapshot.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace kbf {
+
+	// The parts of PersistentNpcInfo the GUI shows - the managers stay with the tracker.
+	struct PersistentNpcSnapshot {
+		ArmourInfo armourInfo;
+	};
+
+	struct NpcSnapshot {
+		NpcInfo info;
+		std::optional<PersistentNpcSnapshot> persistent;
+	};
+
+	// Everything the GUI reads from the NPC tracker, published once per frame by the update thread.
+	struct NpcTrackerSnapshot {
+		uint64_t frame = 0;
+		std::vector<NpcSnapshot> npcs; // Tracked slots, in slot order
+		TrackerHealthSnapshot health;
+	};
+
+}
@@ -7,6 +7,7 @@
 #include <kbf/util/string/ptr_to_hex_string.hpp>
 #include <kbf/util/re_engine/dump_transform_tree.hpp>
 #include <kbf/util/re_engine/find_transform.hpp>
+#include <kbf/util/re_engine/hot_properties.hpp>
 #include <kbf/util/hash/ptr_hasher.hpp>
 #include <kbf/util/re_engine/re_memory_ptr.hpp>
 #include <kbf/util/re_engine/dump_components.hpp>
@@ -17,9 +18,18 @@
 #include <kbf/data/armour/armor_set_id.hpp>
 #include <kbf/data/armour/armour_data_manager.hpp>
 #include <kbf/debug/debug_stack.hpp>
+#include <kbf/data/data_footprint.hpp>
 
 #include <kbf/util/re_engine/guid_to_string.hpp>
 #include <kbf/profiling/cpu_profiler.hpp>
+#include <kbf/profiling/trace_capture.hpp>
+#include <kbf/profiling/frame_budget_controller.hpp>
+#include <kbf/profiling/alloc_tracker.hpp>
+#include <kbf/replay/tracker_recorder.hpp>
+
+#include <algorithm>
+#include <array>
+#include <limits>
 
 #define PLAYER_TRACKER_LOG_TAG "[PlayerTracker]"
 
@@ -54,19 +64,28 @@ namespace kbf {
     }
 
     void PlayerTracker::setupLists() {
-        bool gotNumPlayers = getPlayerListSize(playerListSize);
+        size_t listSize = 0;
+        bool gotNumPlayers = getPlayerListSize(listSize);
         if (!gotNumPlayers) {
             DEBUG_STACK.fpush<PLAYER_TRACKER_LOG_TAG>(DebugStack::Color::COL_ERROR, "Failed to get player list from Player Manager! Player modifications will not function.");
         }
         else {
-            DEBUG_STACK.fpush<PLAYER_TRACKER_LOG_TAG>(DebugStack::Color::COL_SUCCESS, "Successfully fetched player list size: {}", playerListSize);
-            
+            DEBUG_STACK.fpush<PLAYER_TRACKER_LOG_TAG>(DebugStack::Color::COL_SUCCESS, "Successfully fetched player list size: {}", listSize);
+
+            // The equip / warp hooks bounds check against playerListSize (acquire) on their own threads, so the request
+            //  flags must exist before it's published.
+            playerFetchRequests = std::make_unique<std::atomic<bool>[]>(listSize);
+            playerListSize.store(listSize, std::memory_order_release);
+
             // empty initialize arrays
-			playersToFetch             .resize(playerListSize, false);
-			occupiedNormalGameplaySlots.resize(playerListSize, false);
-			playerInfos                .resize(playerListSize, std::nullopt);
-			persistentPlayerInfos      .resize(playerListSize, std::nullopt);
-			playerInfoCaches           .resize(playerListSize, std::nullopt);
+			playersToFetch             .resize(listSize, false);
+			fetchRetries               .resize(listSize);
+			applyScheduler             .resize(listSize);
+			pointerValidity            .resize(listSize);
+			occupiedNormalGameplaySlots.resize(listSize, false);
+			playerInfos                .resize(listSize, std::nullopt);
+			persistentPlayerInfos      .resize(listSize, std::nullopt);
+			playerInfoCaches           .resize(listSize, std::nullopt);
         }
 	}
 
@@ -97,21 +116,135 @@ namespace kbf {
         return playerDataList;
     }
 
+    MemoryFootprint PlayerTracker::getMemoryFootprint() const {
+        MemoryFootprint report{ "Player Tracker", 0, sizeof(*this) };
+
+        const auto countPopulated = [](const auto& infos) {
+            return static_cast<size_t>(std::count_if(infos.begin(), infos.end(), [](const auto& info) { return info.has_value(); }));
+        };
+
+        report.add(MemoryFootprint{ "Player Infos", countPopulated(playerInfos), footprint::vectorBytes(playerInfos, [](const auto& info) {
+            return info.has_value() ? footprint::playerDataBytes(info->playerData) : 0;
+        }) });
+        report.add(MemoryFootprint{ "Persistent Player Infos", countPopulated(persistentPlayerInfos), footprint::vectorBytes(persistentPlayerInfos, [](const auto& pInfo) {
+            if (!pInfo.has_value()) return size_t{ 0 };
+            return footprint::playerDataBytes(pInfo->playerData)
+                + footprint::armourInfoBytes(pInfo->armourInfo)
+                + (pInfo->boneManager     ? pInfo->boneManager->getHeapBytes()     : 0)
+                + (pInfo->partManager     ? pInfo->partManager->getHeapBytes()     : 0)
+                + (pInfo->materialManager ? pInfo->materialManager->getHeapBytes() : 0);
+        }) });
+        report.add(MemoryFootprint{ "Player Caches", countPopulated(playerInfoCaches), footprint::vectorBytes(playerInfoCaches) });
+
+        const auto playerDataKeyBytes = [](const auto& entry) { return footprint::playerDataBytes(entry.first); };
+        report.add(MemoryFootprint{ "Slot Tables", playerSlotTable.size() + applyScheduler.delayedCount(),
+            footprint::hashContainerBytes(playerSlotTable, playerDataKeyBytes)
+            + applyScheduler.getBytes()
+            + footprint::vectorBytes(playersToFetch)
+            + playersToFetch.size() * sizeof(std::atomic<bool>)
+            + fetchRetries.size() * sizeof(FetchRetryScheduler::SlotState)
+            + footprint::vectorBytes(occupiedNormalGameplaySlots) });
+
+        report.add(MemoryFootprint{ "Apply Plans", applyPlans.size(),
+            footprint::vectorBytes(applyPlans, [](const ApplyCommandBuffer& plan) { return plan.getBytes(); })
+            + footprint::vectorBytes(plannedSlots) });
+
+        return report;
+    }
+
     void PlayerTracker::updatePlayers() {
         fetchPlayers();
         updateApplyDelays();
+        if (TRACKER_RECORDER.isRecording()) recordInputs();
+        publishSnapshot();
+        if (memoryFootprintRequested.exchange(false, std::memory_order_relaxed)) publishMemoryFootprint();
+    }
+
+    void PlayerTracker::publishMemoryFootprint() {
+        // Only on request from the debug tab, so a rebuilt report is fine.
+        ALLOC_TRACKER_ALLOW(memoryFootprintScope);
+        memoryFootprints.back() = getMemoryFootprint();
+        memoryFootprints.publish();
+    }
+
+    void PlayerTracker::publishSnapshot() {
+        PlayerTrackerSnapshot& snapshot = snapshots.back();
+        snapshot.frame = snapshots.getPublished() + 1;
+
+        // Assign over the previous contents rather than rebuilding, so steady state doesn't allocate.
+        size_t count = 0;
+        for (size_t i = 0; i < playerInfos.size(); i++) {
+            if (!playerInfos[i].has_value()) continue;
+            if (count == snapshot.players.size()) snapshot.players.emplace_back();
+
+            PlayerSnapshot& player = snapshot.players[count++];
+            player.info = *playerInfos[i];
+
+            const std::optional<PersistentPlayerInfo>& pInfo = persistentPlayerInfos[i];
+            if (!pInfo.has_value()) {
+                player.persistent.reset();
+                continue;
+            }
+
+            PersistentPlayerSnapshot& persistent = player.persistent.has_value() ? *player.persistent : player.persistent.emplace();
+            persistent.armourInfo                     = pInfo->armourInfo;
+            persistent.Wp_Parent_GameObject           = pInfo->Wp_Parent_GameObject;
+            persistent.WpSub_Parent_GameObject        = pInfo->WpSub_Parent_GameObject;
+            persistent.Wp_ReserveParent_GameObject    = pInfo->Wp_ReserveParent_GameObject;
+            persistent.WpSub_ReserveParent_GameObject = pInfo->WpSub_ReserveParent_GameObject;
+            persistent.Wp_Insect                      = pInfo->Wp_Insect;
+            persistent.Wp_ReserveInsect               = pInfo->Wp_ReserveInsect;
+        }
+        snapshot.players.resize(count);
+
+        snapshot.health.capture(fetchRetries, pointerValidity);
+        snapshot.plannedLastFrame = plannedSlots.size();
+        snapshot.plannerThreads   = applyPlanners.getWorkerCount();
+        snapshot.plannersStarted  = applyPlanners.isStarted();
+        snapshot.parallelPlans    = applyPlanners.getParallelJobs();
+        snapshot.inlinePlans      = applyPlanners.getInlineJobs();
+
+        snapshots.publish();
+    }
+
+    void PlayerTracker::recordInputs() const {
+        for (size_t i = 0; i < playerInfos.size(); i++) {
+            TrackedSlotState state{};
+            if (playerInfos[i].has_value()) {
+                const PlayerInfo& info = *playerInfos[i];
+                state.occupied   = true;
+                state.female     = info.playerData.female;
+                state.visible    = info.visible;
+                state.fetched    = persistentPlayerInfos[i].has_value();
+                state.distanceSq = info.distanceFromCameraSq;
+                state.id         = info.playerData.hunterId;
+                state.name       = info.playerData.name;
+
+                auto deadline = applyScheduler.getDelayDeadline(static_cast<uint32_t>(i));
+                if (deadline.has_value()) state.applyDelayStamp = deadline->time_since_epoch().count();
+            }
+            TRACKER_RECORDER.recordSlot(TrackedCharacterKind::PLAYER, i, state);
+        }
     }
 
     void PlayerTracker::applyPresets() {
 		constexpr auto& profiler = CpuProfiler::GlobalMultiScopeProfiler;
         constexpr const char* BLOCK_PRECOMPUTE      = "Player Apply - Precompute & Sort";
         constexpr const char* BLOCK_INFO_VALIDATION = "Player Apply - Info Validation";
-        constexpr const char* BLOCK_APPLY_BONES     = "Player Apply - Apply Bones";
-        constexpr const char* BLOCK_APPLY_PARTS     = "Player Apply - Apply Parts";
-        constexpr const char* BLOCK_APPLY_MATS      = "Player Apply - Apply Materials";
+        constexpr const char* BLOCK_PLAN            = "Player Apply - Plan";
+        constexpr const char* BLOCK_COMMIT_BONES    = "Player Apply - Commit Bones";
+        constexpr const char* BLOCK_COMMIT_PARTS    = "Player Apply - Commit Parts";
+        constexpr const char* BLOCK_COMMIT_MATS     = "Player Apply - Commit Materials";
         constexpr const char* BLOCK_WEAPON_VIS      = "Player Apply - Weapon Visibility";
         constexpr const char* BLOCK_SLINGER_VIS     = "Player Apply - Slinger Visibility";
 
+        pointerValidity.beginFrame(dataManager.settings().pointerRecheckInterval);
+        plannedSlots.clear();
+        if (plannedSlots.capacity() < playerInfos.size()) {
+            ALLOC_TRACKER_ALLOW(growSlotsScope);
+            plannedSlots.reserve(playerInfos.size());
+        }
+
         bool inQuest = SituationWatcher::inSituation(isinQuestPlayingasGuest) || SituationWatcher::inSituation(isinQuestPlayingasHost);
         if (dataManager.settings().enableDuringQuestsOnly && !inQuest) return;
 
@@ -119,47 +252,30 @@ namespace kbf {
         BEGIN_CPU_PROFILING_BLOCK(profiler, BLOCK_PRECOMPUTE);
         // Additionally consider one extra 'preview preset' for those currently being edited in the GUI
         const Preset* previewedPreset = dataManager.getPreviewedPreset();
-        const bool hasPreview = previewedPreset != nullptr;
-        const bool applyPreviewUnconditional = hasPreview && previewedPreset->armour == ArmourSet::DEFAULT;
-
-        // Only apply first n players based on distance to camera
-        const int maxPlayersToApply = std::max<int>(dataManager.settings().maxConcurrentApplications, 0);
 
-        std::vector<std::pair<const PlayerData*, size_t>> players;
-        players.reserve(playerSlotTable.size());
+        // Only apply to the first n visible players in range, based on distance to camera
+        const FrameBudgetLimits limits = FRAME_BUDGET.getLimits(dataManager.settings());
+        const int maxPlayersToApply = std::max<int>(limits.maxConcurrentApplications, 0);
 
-        for (const auto& [player, idx] : playerSlotTable)
-            players.emplace_back(&player, idx);
-
-        if (maxPlayersToApply > 0) {
-            std::nth_element(
-                players.begin(),
-                players.begin() + std::min<size_t>(maxPlayersToApply, players.size()),
-                players.end(),
-                [&](const std::pair<const PlayerData*, size_t>& a, const std::pair<const PlayerData*, size_t>& b) {
-                    if (!playerInfos[a.second]) return false;
-                    if (!playerInfos[b.second]) return true;
-                    return playerInfos[a.second]->distanceFromCameraSq < playerInfos[b.second]->distanceFromCameraSq;
-                }
-            );
+        applyScheduler.beginSelection();
+        for (uint32_t i = 0; i < playerInfos.size(); i++) {
+            const std::optional<PlayerInfo>& info = playerInfos[i];
+            if (!info) continue;
+            applyScheduler.addCandidate(i, info->visible, info->distanceFromCameraSq);
         }
-
-        size_t limit = maxPlayersToApply > 0 ? std::min<size_t>(maxPlayersToApply, players.size()) : players.size();
+        size_t limit = applyScheduler.select(limits.applicationRange, maxPlayersToApply);
         END_CPU_PROFILING_BLOCK(profiler, BLOCK_PRECOMPUTE);
         // ==================================================================================================================
 
+        // ==== VALIDATE ====================================================================================================
+        // Anything that can drop a slot happens here, on this thread, before planning reads the slots.
         for (size_t i = 0; i < limit; ++i) {
+            size_t idx = applyScheduler.selectedId(i);
+            TRACE_CAPTURE_SCOPED_ARGS(playerTraceArgs, static_cast<int32_t>(idx))
 			BEGIN_CPU_PROFILING_BLOCK(profiler, BLOCK_INFO_VALIDATION);
-            const PlayerData& player = *players[i].first;
-            size_t idx = players[i].second;
 
             if (!playerInfos[idx].has_value())                                      PROFILED_FLOW_OP(profiler, BLOCK_INFO_VALIDATION, continue);
-            if (playerApplyDelays[player] && playerApplyDelays[player].has_value()) PROFILED_FLOW_OP(profiler, BLOCK_INFO_VALIDATION, continue);
-
-            if (!playerInfos[idx].has_value()) {
-                playerApplyDelays.erase(player);
-                PROFILED_FLOW_OP(profiler, BLOCK_INFO_VALIDATION, continue);
-            }
+            if (applyScheduler.isDelayed(static_cast<uint32_t>(idx)))               PROFILED_FLOW_OP(profiler, BLOCK_INFO_VALIDATION, continue);
 
             const PlayerInfo& info = *playerInfos[idx];
             if (!info.visible) PROFILED_FLOW_OP(profiler, BLOCK_INFO_VALIDATION, continue);
@@ -167,122 +283,164 @@ namespace kbf {
             if (!persistentPlayerInfos[idx].has_value()) PROFILED_FLOW_OP(profiler, BLOCK_INFO_VALIDATION, continue);
 
 			PersistentPlayerInfo& pInfo = persistentPlayerInfos[idx].value();
-            if (!persistentPlayerInfos[idx].value().areSetPointersValid()) {
-                persistentPlayerInfos[idx] = std::nullopt;
-                PROFILED_FLOW_OP(profiler, BLOCK_INFO_VALIDATION, continue);
+            if (pointerValidity.needsCheck(idx, info.pointers.Transform)) {
+                const bool valid = pInfo.areSetPointersValid();
+                pointerValidity.recordCheck(idx, valid, info.pointers.Transform);
+                if (!valid) {
+                    persistentPlayerInfos[idx] = std::nullopt;
+                    PROFILED_FLOW_OP(profiler, BLOCK_INFO_VALIDATION, continue);
+                }
             }
 			END_CPU_PROFILING_BLOCK(profiler, BLOCK_INFO_VALIDATION);
 
-            if (pInfo.boneManager && pInfo.partManager) {
-
-                // Always apply base presets when they are present, but refrain from re-applying the same base preset multiple times.
-                std::unordered_set<std::string> presetBasesApplied{};
-
-                bool hideWeapon = false;
-                bool hideSlinger = false;
-
-                bool applyError = false;
-                for (ArmourPiece piece = ArmourPiece::AP_MIN_EXCLUDING_SET; piece <= ArmourPiece::AP_MAX_EXCLUDING_SLINGER; piece = static_cast<ArmourPiece>(static_cast<int>(piece) + 1)) {
-                    std::optional<ArmourSet>& armourPiece = pInfo.armourInfo.getPiece(piece);
-
-                    if (armourPiece.has_value()) {
-                        const Preset* preset = dataManager.getActivePreset(player, armourPiece.value(), piece);
-
-                        bool usePreview = hasPreview && (applyPreviewUnconditional || previewedPreset->armour == armourPiece.value());
-                        if (preset == nullptr && !usePreview) continue;
-
-                        const Preset* activePreset = usePreview ? previewedPreset : preset;
-                        const Preset* setWidePartsPreset = usePreview ? nullptr : dataManager.getActivePreset(player, armourPiece.value(), ArmourPiece::CUSTOM_AP_PARTS);
-                        const Preset* setWideMatsPreset  = usePreview ? nullptr : dataManager.getActivePreset(player, armourPiece.value(), ArmourPiece::CUSTOM_AP_MATS);
-
-						BEGIN_CPU_PROFILING_BLOCK(profiler, BLOCK_APPLY_BONES);
-                        BoneManager::BoneApplyStatusFlag applyFlag = pInfo.boneManager->applyPreset(activePreset, piece);
-                        bool invalidBones = applyFlag == BoneManager::BoneApplyStatusFlag::BONE_APPLY_ERROR_INVALID_BONE;
-                        if (invalidBones) { 
-                            applyError = true; 
-                            clearPlayerSlot(idx); 
-                            playersToFetch[idx] = true;
-                            PROFILED_FLOW_OP(profiler, BLOCK_APPLY_BONES, break);
-                        }
-						END_CPU_PROFILING_BLOCK(profiler, BLOCK_APPLY_BONES);
-
-						BEGIN_CPU_PROFILING_BLOCK(profiler, BLOCK_APPLY_PARTS);
-                        pInfo.partManager->applyPreset(setWidePartsPreset, piece); // Apply set-wide part overrides first
-                        pInfo.partManager->applyPreset(activePreset, piece);
-						END_CPU_PROFILING_BLOCK(profiler, BLOCK_APPLY_PARTS);
-
-						BEGIN_CPU_PROFILING_BLOCK(profiler, BLOCK_APPLY_MATS);
-                        pInfo.materialManager->applyPreset(setWideMatsPreset, piece); // Apply set-wide material overrides first
-						pInfo.materialManager->applyPreset(activePreset, piece);
-						END_CPU_PROFILING_BLOCK(profiler, BLOCK_APPLY_MATS);
-
-                        if (!invalidBones && activePreset->set.hasModifiers() && !presetBasesApplied.contains(activePreset->uuid)) {
-                            BEGIN_CPU_PROFILING_BLOCK(profiler, BLOCK_APPLY_BONES);
-                            presetBasesApplied.insert(activePreset->uuid);
-                            BoneManager::BoneApplyStatusFlag baseApplyFlag = pInfo.boneManager->applyPreset(activePreset, AP_SET);
-                            bool invalidBaseBones = baseApplyFlag == BoneManager::BoneApplyStatusFlag::BONE_APPLY_ERROR_INVALID_BONE;
-                            if (invalidBaseBones) { 
-                                applyError = true; 
-                                clearPlayerSlot(idx); 
-                                playersToFetch[idx] = true; 
-                                PROFILED_FLOW_OP(profiler, BLOCK_APPLY_BONES, break);
-                            }
-                            END_CPU_PROFILING_BLOCK(profiler, BLOCK_APPLY_BONES);
-                        }
-
-                        // Check Weapon & Slinger Disables
-                        bool setWideWantsToHideWeapon  = setWidePartsPreset ? setWidePartsPreset->hideWeapon : false;
-                        bool setWideWantsToHideSlinger = setWidePartsPreset ? setWidePartsPreset->hideSlinger : false;
-                        hideWeapon  |= setWideWantsToHideWeapon  | activePreset->hideWeapon;
-                        hideSlinger |= setWideWantsToHideSlinger | activePreset->hideSlinger;
-                    }
-                }
+            if (pInfo.boneManager && pInfo.partManager) plannedSlots.push_back(static_cast<uint32_t>(idx));
+        }
+        // ==================================================================================================================
 
-                if (!applyError) {
-					BEGIN_CPU_PROFILING_BLOCK(profiler, BLOCK_WEAPON_VIS);
-                    // Weapon Visibility
-                    if (dataManager.settings().enableHideWeapons) {
-
-                        bool weaponVisible = info.weaponDrawn || !hideWeapon 
-                            || (info.inCombat && dataManager.settings().hideWeaponsOutsideOfCombatOnly)
-                            || (info.inTent && dataManager.settings().forceShowWeaponInTent)
-                            || (info.isRidingSeikret && dataManager.settings().forceShowWeaponWhenOnSeikret)
-                            || (info.isSharpening && dataManager.settings().forceShowWeaponWhenSharpening);
-
-                        if (pInfo.Wp_Parent_GameObject)           REInvokeVoid(pInfo.Wp_Parent_GameObject,           "set_DrawSelf", { (void*)(weaponVisible) });
-                        if (pInfo.WpSub_Parent_GameObject)        REInvokeVoid(pInfo.WpSub_Parent_GameObject,        "set_DrawSelf", { (void*)(weaponVisible) });
-                        if (pInfo.Wp_ReserveParent_GameObject)    REInvokeVoid(pInfo.Wp_ReserveParent_GameObject,    "set_DrawSelf", { (void*)(weaponVisible) });
-                        if (pInfo.WpSub_ReserveParent_GameObject) REInvokeVoid(pInfo.WpSub_ReserveParent_GameObject, "set_DrawSelf", { (void*)(weaponVisible) });
-                    
-                        bool kinsectVisible = !dataManager.settings().enableHideKinsect || weaponVisible;
-
-                        const static reframework::API::TypeDefinition* def_GameObject = reframework::API::get()->tdb()->find_type("via.GameObject");
-                        bool validWpInsect        = pInfo.Wp_Insect        && checkREPtrValidity(pInfo.Wp_Insect,        def_GameObject);
-						bool validWpReserveInsect = pInfo.Wp_ReserveInsect && checkREPtrValidity(pInfo.Wp_ReserveInsect, def_GameObject);
-
-                        if (validWpInsect)        REInvokeVoid(pInfo.Wp_Insect,        "set_DrawSelf", { (void*)(kinsectVisible) });
-                        if (validWpReserveInsect) REInvokeVoid(pInfo.Wp_ReserveInsect, "set_DrawSelf", { (void*)(kinsectVisible) });
-                    }
-					END_CPU_PROFILING_BLOCK(profiler, BLOCK_WEAPON_VIS);
+        // ==== PLAN ========================================================================================================
+        // Pure CPU work - preset resolution & building each player's bone / part / material writes - spread over the
+        //  planner pool. Nothing here touches the engine or tracker state.
+        BEGIN_CPU_PROFILING_BLOCK(profiler, BLOCK_PLAN);
+        if (applyPlans.size() < plannedSlots.size()) {
+            ALLOC_TRACKER_ALLOW(growPlansScope);
+            applyPlans.resize(plannedSlots.size());
+        }
+        applyPlanners.parallelFor(plannedSlots.size(), MIN_PARALLEL_APPLY_PLANS, [&](size_t i) {
+            ALLOC_TRACKER_EXPECT_NONE(planScope); // The caller's scope is on the update thread only
+            planPlayerApply(plannedSlots[i], previewedPreset, applyPlans[i]);
+        });
+        END_CPU_PROFILING_BLOCK(profiler, BLOCK_PLAN);
+        // ==================================================================================================================
 
-					BEGIN_CPU_PROFILING_BLOCK(profiler, BLOCK_SLINGER_VIS);
-                    // Slinger Visibility
-                    bool slingerVisible = !hideSlinger || (info.inCombat && dataManager.settings().hideSlingerOutsideOfCombatOnly);
-                    if (pInfo.Slinger_GameObject) REInvokeVoid(pInfo.Slinger_GameObject, "set_DrawSelf", { (void*)(slingerVisible) });
-					END_CPU_PROFILING_BLOCK(profiler, BLOCK_SLINGER_VIS);
-                }
+        // ==== COMMIT ======================================================================================================
+        for (size_t i = 0; i < plannedSlots.size(); ++i) {
+            const size_t idx = plannedSlots[i];
+            const ApplyCommandBuffer& plan = applyPlans[i];
+            TRACE_CAPTURE_SCOPED_ARGS(playerTraceArgs, static_cast<int32_t>(idx))
+
+            const PlayerInfo& info = *playerInfos[idx];
+            PersistentPlayerInfo& pInfo = *persistentPlayerInfos[idx];
+
+			BEGIN_CPU_PROFILING_BLOCK(profiler, BLOCK_COMMIT_BONES);
+            BoneManager::BoneApplyStatusFlag applyFlag = BoneManager::commit(plan.bones);
+            if (applyFlag == BoneManager::BoneApplyStatusFlag::BONE_APPLY_ERROR_INVALID_BONE) {
+                clearPlayerSlot(idx);
+                playersToFetch[idx] = true;
+                PROFILED_FLOW_OP(profiler, BLOCK_COMMIT_BONES, continue);
+            }
+			END_CPU_PROFILING_BLOCK(profiler, BLOCK_COMMIT_BONES);
+
+			BEGIN_CPU_PROFILING_BLOCK(profiler, BLOCK_COMMIT_PARTS);
+            PartManager::commit(plan.parts);
+			END_CPU_PROFILING_BLOCK(profiler, BLOCK_COMMIT_PARTS);
+
+			BEGIN_CPU_PROFILING_BLOCK(profiler, BLOCK_COMMIT_MATS);
+            MaterialManager::commit(plan.materials);
+			END_CPU_PROFILING_BLOCK(profiler, BLOCK_COMMIT_MATS);
+
+			BEGIN_CPU_PROFILING_BLOCK(profiler, BLOCK_WEAPON_VIS);
+            // Weapon Visibility
+            if (dataManager.settings().enableHideWeapons) {
+
+                bool weaponVisible = info.weaponDrawn || !plan.hideWeapon 
+                    || (info.inCombat && dataManager.settings().hideWeaponsOutsideOfCombatOnly)
+                    || (info.inTent && dataManager.settings().forceShowWeaponInTent)
+                    || (info.isRidingSeikret && dataManager.settings().forceShowWeaponWhenOnSeikret)
+                    || (info.isSharpening && dataManager.settings().forceShowWeaponWhenSharpening);
+
+                if (pInfo.Wp_Parent_GameObject)           REInvokeVoid(pInfo.Wp_Parent_GameObject,           "set_DrawSelf", { (void*)(weaponVisible) });
+                if (pInfo.WpSub_Parent_GameObject)        REInvokeVoid(pInfo.WpSub_Parent_GameObject,        "set_DrawSelf", { (void*)(weaponVisible) });
+                if (pInfo.Wp_ReserveParent_GameObject)    REInvokeVoid(pInfo.Wp_ReserveParent_GameObject,    "set_DrawSelf", { (void*)(weaponVisible) });
+                if (pInfo.WpSub_ReserveParent_GameObject) REInvokeVoid(pInfo.WpSub_ReserveParent_GameObject, "set_DrawSelf", { (void*)(weaponVisible) });
+            
+                bool kinsectVisible = !dataManager.settings().enableHideKinsect || weaponVisible;
+
+                const static reframework::API::TypeDefinition* def_GameObject = reframework::API::get()->tdb()->find_type("via.GameObject");
+                bool validWpInsect        = pInfo.Wp_Insect        && checkREPtrValidity(pInfo.Wp_Insect,        def_GameObject);
+				bool validWpReserveInsect = pInfo.Wp_ReserveInsect && checkREPtrValidity(pInfo.Wp_ReserveInsect, def_GameObject);
+
+                if (validWpInsect)        REInvokeVoid(pInfo.Wp_Insect,        "set_DrawSelf", { (void*)(kinsectVisible) });
+                if (validWpReserveInsect) REInvokeVoid(pInfo.Wp_ReserveInsect, "set_DrawSelf", { (void*)(kinsectVisible) });
             }
+			END_CPU_PROFILING_BLOCK(profiler, BLOCK_WEAPON_VIS);
+
+			BEGIN_CPU_PROFILING_BLOCK(profiler, BLOCK_SLINGER_VIS);
+            // Slinger Visibility
+            bool slingerVisible = !plan.hideSlinger || (info.inCombat && dataManager.settings().hideSlingerOutsideOfCombatOnly);
+            if (pInfo.Slinger_GameObject) REInvokeVoid(pInfo.Slinger_GameObject, "set_DrawSelf", { (void*)(slingerVisible) });
+			END_CPU_PROFILING_BLOCK(profiler, BLOCK_SLINGER_VIS);
+        }
+        // ==================================================================================================================
+    }
+
+    // Planner pool thread. Reads the slot's infos, presets & cached engine pointers only - writes nothing but `out` and
+    //  the slot's own part manager's visibility plan.
+    void PlayerTracker::planPlayerApply(size_t index, const Preset* previewedPreset, ApplyCommandBuffer& out) {
+        TRACE_CAPTURE_SCOPED_ARGS(playerTraceArgs, static_cast<int32_t>(index))
+        out.clear();
+
+        const PlayerData& player = playerInfos[index]->playerData;
+        PersistentPlayerInfo& pInfo = *persistentPlayerInfos[index];
+
+        const bool hasPreview = previewedPreset != nullptr;
+        const bool applyPreviewUnconditional = hasPreview && previewedPreset->armour == ArmourSet::DEFAULT;
+
+        // Always apply base presets when they are present, but refrain from re-applying the same base preset multiple times.
+        std::array<const Preset*, ArmourPiece::AP_MAX_EXCLUDING_SLINGER + 1> presetBasesApplied{};
+        size_t presetBasesAppliedCount = 0;
+
+        for (ArmourPiece piece = ArmourPiece::AP_MIN_EXCLUDING_SET; piece <= ArmourPiece::AP_MAX_EXCLUDING_SLINGER; piece = static_cast<ArmourPiece>(static_cast<int>(piece) + 1)) {
+            const std::optional<ArmourSet>& armourPiece = pInfo.armourInfo.getPiece(piece);
+            if (!armourPiece.has_value()) continue;
+
+            const Preset* preset = dataManager.getActivePreset(player, armourPiece.value(), piece);
+
+            bool usePreview = hasPreview && (applyPreviewUnconditional || previewedPreset->armour == armourPiece.value());
+            if (preset == nullptr && !usePreview) continue;
+
+            const Preset* activePreset = usePreview ? previewedPreset : preset;
+            const Preset* setWidePartsPreset = usePreview ? nullptr : dataManager.getActivePreset(player, armourPiece.value(), ArmourPiece::CUSTOM_AP_PARTS);
+            const Preset* setWideMatsPreset  = usePreview ? nullptr : dataManager.getActivePreset(player, armourPiece.value(), ArmourPiece::CUSTOM_AP_MATS);
+
+            TRACE_CAPTURE_SCOPED_ARGS(pieceTraceArgs, -1, armourPiece.value().name.c_str(),
+                TRACE_CAPTURE.isCapturing() ? static_cast<int32_t>(activePreset->getPieceSettings(piece).modifiers.size()) : -1)
+
+            pInfo.boneManager->planPreset(activePreset, piece, out.bones);
+            pInfo.partManager->planPreset(setWidePartsPreset, piece); // Apply set-wide part overrides first
+            pInfo.partManager->planPreset(activePreset, piece);
+            pInfo.materialManager->planPreset(setWideMatsPreset, piece, out.materials); // Apply set-wide material overrides first
+            pInfo.materialManager->planPreset(activePreset, piece, out.materials);
+
+            const auto basesEnd = presetBasesApplied.begin() + presetBasesAppliedCount;
+            if (activePreset->set.hasModifiers() && std::find(presetBasesApplied.begin(), basesEnd, activePreset) == basesEnd) {
+                presetBasesApplied[presetBasesAppliedCount++] = activePreset;
+                pInfo.boneManager->planPreset(activePreset, AP_SET, out.bones);
+            }
+
+            // Check Weapon & Slinger Disables
+            bool setWideWantsToHideWeapon  = setWidePartsPreset ? setWidePartsPreset->hideWeapon : false;
+            bool setWideWantsToHideSlinger = setWidePartsPreset ? setWidePartsPreset->hideSlinger : false;
+            out.hideWeapon  |= setWideWantsToHideWeapon  | activePreset->hideWeapon;
+            out.hideSlinger |= setWideWantsToHideSlinger | activePreset->hideSlinger;
         }
+
+        // Only the parts whose visibility actually changes get written
+        pInfo.partManager->finishPlan(out.parts);
     }
 
     void PlayerTracker::reset() {
+        TRACKER_RECORDER.recordReset(TrackedCharacterKind::PLAYER);
+
         playerSlotTable.clear();
-        playerApplyDelays.clear();
+        applyScheduler.cancelAll();
+        pointerValidity.invalidateAll();
         for (auto& p : playerInfos)                 p.reset();
         for (auto& p : persistentPlayerInfos)       p.reset();
         
 		std::fill(playersToFetch.begin(), playersToFetch.end(), false);
+		for (size_t i = 0; i < playersToFetch.size(); i++) playerFetchRequests[i].store(false, std::memory_order_relaxed);
 		std::fill(occupiedNormalGameplaySlots.begin(), occupiedNormalGameplaySlots.end(), false);
+        fetchRetries.resetAll();
 
         saveSelectHunterTransformCache              = nullptr;
         saveSelectSceneControllerCache              = nullptr;
@@ -329,6 +487,15 @@ namespace kbf {
         else                       fetchPlayers_NormalGameplay();
     }
 
+    void PlayerTracker::drainFetchRequests() {
+        // An equip / warp is a fresh start for the slot, so a slot that had given up retrying is tried again.
+        for (size_t i = 0; i < playersToFetch.size(); i++) {
+            if (!playerFetchRequests[i].exchange(false, std::memory_order_acq_rel)) continue;
+            playersToFetch[i] = true;
+            fetchRetries.reset(i);
+        }
+    }
+
     void PlayerTracker::fetchPlayers_MainMenu() {
         // Player info only needs to be fetched once, as it will never change until we leave and re-enter.
         if (playerSlotTable.size() > 0) return;
@@ -353,7 +520,7 @@ namespace kbf {
         BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Player Fetch - Main Menu - Equipped Armours");
 
         if (!fetchedArmours) {
-            DEBUG_STACK.push(std::format("{} Failed to fetch equipped armours for Main Menu Hunter: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId), DebugStack::Color::COL_WARNING);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Failed to fetch equipped armours for Main Menu Hunter: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId);
             return; // We terminate this whole fetch in this case, but can probably just try this portion again instead - ...Too bad!
         }
 
@@ -365,7 +532,7 @@ namespace kbf {
 
         bool fetchedTransforms = fetchPlayer_ArmourTransforms_FromEventModel(info, persistentInfo);
         if (!fetchedTransforms) {
-            DEBUG_STACK.push(std::format(
+            DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING,
                 "{} Failed to fetch armour transforms for Main Menu Hunter: {} [{}]. Relevant info:\n"
                 "  Base @ {}\n  Helm: {} @ {}\n  Body: {} @ {}\n  Arms: {} @ {}\n  Coil: {} @ {}\n  Legs: {} @ {}",
                 PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId,
@@ -375,7 +542,7 @@ namespace kbf {
                 persistentInfo.armourInfo.arms.has_value() ? persistentInfo.armourInfo.arms.value().name : "NULL", ptrToHexString(persistentInfo.Transform_arms),
                 persistentInfo.armourInfo.coil.has_value() ? persistentInfo.armourInfo.coil.value().name : "NULL", ptrToHexString(persistentInfo.Transform_coil),
                 persistentInfo.armourInfo.legs.has_value() ? persistentInfo.armourInfo.legs.value().name : "NULL", ptrToHexString(persistentInfo.Transform_legs)
-            ), DebugStack::Color::COL_WARNING);
+            );
             return;
         }
 
@@ -393,7 +560,7 @@ namespace kbf {
             else if (persistentInfo.Transform_legs == nullptr)     reason = "Legs Transform ptr was null";
             else if (!persistentInfo.armourInfo.body.has_value())  reason = "No body armour found";
             else if (!persistentInfo.armourInfo.legs.has_value())  reason = "No legs armour found";
-            DEBUG_STACK.push(std::format("{} Failed to fetch bones for Main Menu Hunter: {} [{}]. Reason: {}.", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId, reason), DebugStack::Color::COL_WARNING);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Failed to fetch bones for Main Menu Hunter: {} [{}]. Reason: {}.", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId, reason);
             return;
         }
 
@@ -405,7 +572,7 @@ namespace kbf {
 
         bool fetchedParts = fetchPlayer_Parts(info, persistentInfo);
         if (!fetchedParts) {
-            DEBUG_STACK.push(std::format("{} Failed to fetch parts for Main Menu Hunter: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId), DebugStack::Color::COL_WARNING);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Failed to fetch parts for Main Menu Hunter: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId);
             return;
         }
 
@@ -417,7 +584,7 @@ namespace kbf {
 
         bool fetchedMaterials = fetchPlayer_Materials(info, persistentInfo);
         if (!fetchedMaterials) {
-            DEBUG_STACK.push(std::format("{} Failed to fetch materials for Main Menu Hunter: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId), DebugStack::Color::COL_WARNING);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Failed to fetch materials for Main Menu Hunter: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId);
             return;
         }
 
@@ -429,18 +596,18 @@ namespace kbf {
 
         bool fetchedWeapons = fetchPlayers_MainMenu_WeaponObjects(info, persistentInfo);
         if (!fetchedWeapons) {
-            DEBUG_STACK.push(std::format("{} Failed to fetch weapon objects for Main Menu Hunter: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId), DebugStack::Color::COL_WARNING);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Failed to fetch weapon objects for Main Menu Hunter: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId);
             return;
         }
 
         END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Player Fetch - Main Menu - Weapon Objects");
         //--------------------------------------------------
 
-        playerApplyDelays[persistentInfo.playerData] = std::chrono::high_resolution_clock::now();
+        startApplyDelay(0);
+        pointerValidity.invalidate(0);
         persistentPlayerInfos[0] = std::move(persistentInfo);
 
-        playerSlotTable.emplace(info.playerData, 0);
-        playerInfos[0] = std::move(info);
+        storePlayerInfo(0, std::move(info));
     }
 
     bool PlayerTracker::fetchPlayers_MainMenu_BasicInfo(PlayerInfo& outInfo, int& outSaveIdx) {
@@ -462,7 +629,7 @@ namespace kbf {
             REApi::ManagedObject* gameObject = REInvokePtr<REApi::ManagedObject>(transform, "get_GameObject", {});
             if (gameObject == nullptr) continue;
 
-            std::string name = REInvokeStr(gameObject, "get_Name", {});
+            std::string_view name = REInvokeStrView(gameObject, "get_Name", {});
             if (name.starts_with(playerTransformNamePrefix)) {
 
                 static const REApi::ManagedObject* typeof_EventModelSetupper = REApi::get()->typeof("app.EventModelSetupper");
@@ -574,7 +741,7 @@ namespace kbf {
                 else if (persistentInfo.Transform_legs == nullptr)     reason = "Legs Transform ptr was null";
                 else if (!persistentInfo.armourInfo.body.has_value())  reason = "No body armour found";
                 else if (!persistentInfo.armourInfo.legs.has_value())  reason = "No legs armour found";
-                DEBUG_STACK.push(std::format("{} Failed to fetch bones for Save Select Hunter: {} [{}]. Reason: {}.", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId, reason), DebugStack::Color::COL_WARNING);
+                DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Failed to fetch bones for Save Select Hunter: {} [{}]. Reason: {}.", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId, reason);
                 return;
             }
 
@@ -586,7 +753,7 @@ namespace kbf {
 
             bool fetchedParts = fetchPlayer_Parts(info, persistentInfo);
             if (!fetchedParts) {
-                DEBUG_STACK.push(std::format("{} Failed to fetch parts for Save Select Hunter: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId), DebugStack::Color::COL_WARNING);
+                DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Failed to fetch parts for Save Select Hunter: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId);
                 return;
             }
 
@@ -598,7 +765,7 @@ namespace kbf {
 
             bool fetchedMaterials = fetchPlayer_Materials(info, persistentInfo);
             if (!fetchedMaterials) {
-                DEBUG_STACK.push(std::format("{} Failed to fetch materials for Save Select Hunter: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId), DebugStack::Color::COL_WARNING);
+                DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Failed to fetch materials for Save Select Hunter: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId);
                 return;
             }
 
@@ -610,19 +777,19 @@ namespace kbf {
 
             bool fetchedWeapons = fetchPlayers_SaveSelect_WeaponObjects(info, persistentInfo);
             if (!fetchedWeapons) {
-                DEBUG_STACK.push(std::format("{} Failed to fetch weapon objects for Save Select Hunter: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId), DebugStack::Color::COL_WARNING);
+                DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Failed to fetch weapon objects for Save Select Hunter: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId);
                 return;
             }
 
             END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Player Fetch - Save Select - Weapon Objects");
             //--------------------------------------------------
 
-            playerApplyDelays[persistentInfo.playerData] = std::chrono::high_resolution_clock::now();
+            startApplyDelay(0);
+            pointerValidity.invalidate(0);
             persistentPlayerInfos[0] = std::move(persistentInfo);
         }
 
-        playerSlotTable.emplace(info.playerData, 0);
-        playerInfos[0] = std::move(info);
+        storePlayerInfo(0, std::move(info));
     }
 
     bool PlayerTracker::fetchPlayers_SaveSelect_BasicInfo(PlayerInfo& outInfo) {
@@ -681,7 +848,7 @@ namespace kbf {
             REApi::ManagedObject* gameObject = REInvokePtr<REApi::ManagedObject>(transform, "get_GameObject", {});
             if (gameObject == nullptr) continue;
 
-            std::string name = REInvokeStr(gameObject, "get_Name", {});
+            std::string_view name = REInvokeStrView(gameObject, "get_Name", {});
             if (name.starts_with(weaponStrPrefix)) {
                 if (!foundMainWp && name.starts_with(weaponParentStr)) {
                     REApi::ManagedObject* partsSwitch = REInvokePtr<REApi::ManagedObject>(gameObject, "getComponent(System.Type)", { (void*)REApi::get()->typeof("app.PartsSwitch") });
@@ -779,7 +946,7 @@ namespace kbf {
                 else if (persistentInfo.Transform_legs == nullptr)     reason = "Legs Transform ptr was null";
                 else if (!persistentInfo.armourInfo.body.has_value())  reason = "No body armour found";
                 else if (!persistentInfo.armourInfo.legs.has_value())  reason = "No legs armour found";
-                DEBUG_STACK.push(std::format("{} Failed to fetch bones for Character Creator Hunter: {} [{}]. Reason: {}.", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId, reason), DebugStack::Color::COL_WARNING);
+                DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Failed to fetch bones for Character Creator Hunter: {} [{}]. Reason: {}.", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId, reason);
                 return;
             }
 
@@ -791,7 +958,7 @@ namespace kbf {
 
             bool fetchedParts = fetchPlayer_Parts(info, persistentInfo);
             if (!fetchedParts) {
-                DEBUG_STACK.push(std::format("{} Failed to fetch parts for Character Creator Hunter: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId), DebugStack::Color::COL_WARNING);
+                DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Failed to fetch parts for Character Creator Hunter: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId);
                 return;
             }
 
@@ -803,19 +970,19 @@ namespace kbf {
 
             bool fetchedMaterials = fetchPlayer_Materials(info, persistentInfo);
             if (!fetchedMaterials) {
-                DEBUG_STACK.push(std::format("{} Failed to fetch materials for Character Creator Hunter: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId), DebugStack::Color::COL_WARNING);
+                DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Failed to fetch materials for Character Creator Hunter: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId);
                 return;
             }
 
             END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Player Fetch - Guild Card - Materials");
             //--------------------------------------------------
 
-            playerApplyDelays[persistentInfo.playerData] = std::chrono::high_resolution_clock::now();
+            startApplyDelay(0);
+            pointerValidity.invalidate(0);
             persistentPlayerInfos[0] = std::move(persistentInfo);
         }
 
-        playerSlotTable.emplace(info.playerData, 0);
-        playerInfos[0] = std::move(info);
+        storePlayerInfo(0, std::move(info));
     }
 
     bool PlayerTracker::fetchPlayers_CharacterCreator_BasicInfo(PlayerInfo& outInfo) {
@@ -917,7 +1084,7 @@ namespace kbf {
                 else if (persistentInfo.Transform_legs == nullptr)     reason = "Legs Transform ptr was null";
                 else if (!persistentInfo.armourInfo.body.has_value())  reason = "No body armour found";
                 else if (!persistentInfo.armourInfo.legs.has_value())  reason = "No legs armour found";
-                DEBUG_STACK.push(std::format("{} Failed to fetch bones for Guild Card Hunter: {} [{}]. Reason: {}.", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId, reason), DebugStack::Color::COL_WARNING);
+                DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Failed to fetch bones for Guild Card Hunter: {} [{}]. Reason: {}.", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId, reason);
                 return;
             }
 
@@ -929,7 +1096,7 @@ namespace kbf {
 
             bool fetchedParts = fetchPlayer_Parts(info, persistentInfo);
             if (!fetchedParts) {
-                DEBUG_STACK.push(std::format("{} Failed to fetch parts for Guild Card Hunter: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId), DebugStack::Color::COL_WARNING);
+                DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Failed to fetch parts for Guild Card Hunter: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId);
                 return;
             }
 
@@ -941,19 +1108,19 @@ namespace kbf {
 
 			bool fetchedMaterials = fetchPlayer_Materials(info, persistentInfo);
             if (!fetchedMaterials) {
-                DEBUG_STACK.push(std::format("{} Failed to fetch materials for Guild Card Hunter: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId), DebugStack::Color::COL_WARNING);
+                DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Failed to fetch materials for Guild Card Hunter: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, info.playerData.hunterId);
                 return;
 			}
 
 			END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Player Fetch - Guild Card - Materials");
 			//--------------------------------------------------
 
-            playerApplyDelays[persistentInfo.playerData] = std::chrono::high_resolution_clock::now();
+            startApplyDelay(0);
+            pointerValidity.invalidate(0);
             persistentPlayerInfos[0] = std::move(persistentInfo);
         }
 
-        playerSlotTable.emplace(info.playerData, 0);
-        playerInfos[0] = std::move(info);
+        storePlayerInfo(0, std::move(info));
     }
 
     bool PlayerTracker::fetchPlayers_HunterGuildCard_BasicInfo(PlayerInfo& outInfo) {
@@ -1034,7 +1201,7 @@ namespace kbf {
                 if (gameObject == nullptr) continue;
 
                 // TODO: Choose based on char info
-                std::string name = REInvokeStr(gameObject, "get_Name", {});
+                std::string_view name = REInvokeStrView(gameObject, "get_Name", {});
                 if (name.starts_with(hunter.female ? playerTransformNamePrefixXX : playerTransformNamePrefixXY)) {
                     outInfo.pointers.Transform = transform;
                     guildCardHunterTransformCache = transform;
@@ -1068,8 +1235,10 @@ namespace kbf {
                        SituationWatcher::inSituation(isinQuestPlayingasHost);
         bool online  = SituationWatcher::inSituation(isOnline);
 
+        drainFetchRequests();
+
         const bool useCache = !needsAllPlayerFetch;
-        for (size_t i = 0; i < playerListSize; i++) {
+        for (size_t i = 0; i < playersToFetch.size(); i++) {
             if (needsAllPlayerFetch || occupiedNormalGameplaySlots[i] || playersToFetch[i]) {
                 fetchPlayers_NormalGameplay_SinglePlayer(i, useCache, inQuest, online);
             }
@@ -1103,7 +1272,14 @@ namespace kbf {
             END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Player Fetch - Normal Gameplay - Basic Info");
         }
 
+        const FetchRetryScheduler::Clock::time_point now = FetchRetryScheduler::Clock::now();
         if (!usedCache) {
+            // The cache went stale, so whatever the last pointer check vouched for may have gone with it.
+            if (cacheExists && !cacheValid) pointerValidity.invalidate(i);
+
+            // Players that haven't come up yet wait out their backoff before the next full basic fetch.
+            if (!playerInfos[i].has_value() && !fetchRetries.isDue(i, now)) return;
+
             BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Player Fetch - Normal Gameplay - Basic Info");
             PlayerFetchFlags fetchFlags = fetchPlayer_BasicInfo(i, inQuest, online, info);
             if (fetchFlags == PlayerFetchFlags::FETCH_PLAYER_SLOT_EMPTY) {
@@ -1111,6 +1287,7 @@ namespace kbf {
                 return;
             }
             else if (fetchFlags == PlayerFetchFlags::FETCH_ERROR_NULL || info.pointers.Transform == nullptr) {
+                fetchRetries.recordFailure(i, fetchFlags == PlayerFetchFlags::FETCH_ERROR_NULL ? FetchFailure::BASIC_INFO : FetchFailure::MISSING_TRANSFORM, now);
                 playerInfoCaches[i] = NormalGameplayPlayerCache{ .cacheIsEmpty = true };
                 END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Player Fetch - Normal Gameplay - Basic Info");
                 return;
@@ -1123,6 +1300,8 @@ namespace kbf {
             newCache.Motion            = info.optionalPointers.Motion;
             newCache.HunterCharacter   = info.optionalPointers.HunterCharacter;
             newCache.cHunterCreateInfo = info.optionalPointers.cHunterCreateInfo;
+            // A refetch landing on a different transform means the pointer set last checked belonged to someone else.
+            if (cacheExists && playerInfoCaches[i]->Transform != newCache.Transform) pointerValidity.invalidate(i);
             playerInfoCaches[i] = newCache;
             END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Player Fetch - Normal Gameplay - Basic Info");
         }
@@ -1133,26 +1312,31 @@ namespace kbf {
         END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Player Fetch - Normal Gameplay - Visibility");
 
         // Fetch when requested, or if no fetch has been done but the player is in-view.
-        if (playersToFetch[i] || (info.visible && !persistentPlayerInfos[i].has_value())) {
+        if ((playersToFetch[i] || (info.visible && !persistentPlayerInfos[i].has_value())) && fetchRetries.isDue(i, now)) {
             BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Player Fetch - Normal Gameplay - Persistent Info");
 
             PersistentPlayerInfo persistentInfo{};
             persistentInfo.playerData = info.playerData;
             persistentInfo.index = i;
 
-            bool fetchedPInfo = fetchPlayer_PersistentInfo(i, info, persistentInfo);
-            if (fetchedPInfo) {
+            FetchFailure failure = fetchPlayer_PersistentInfo(i, info, persistentInfo);
+            if (failure == FetchFailure::NONE) {
                 playersToFetch[i] = false;
-                playerApplyDelays[persistentInfo.playerData] = std::chrono::high_resolution_clock::now();
+                startApplyDelay(i);
+                pointerValidity.invalidate(i);
                 persistentPlayerInfos[i] = std::move(persistentInfo);
                 occupiedNormalGameplaySlots[i] = true;
+                fetchRetries.recordSuccess(i);
+            }
+            else if (fetchRetries.recordFailure(i, failure, now)) {
+                DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Failed to fetch Player: {} [{}] {} times (last: {}), skipping until they reload.",
+                    PLAYER_TRACKER_LOG_TAG, info.playerData.name, i, FetchRetryScheduler::GIVE_UP_AFTER, fetchFailureName(failure));
             }
 
             END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Player Fetch - Normal Gameplay - Persistent Info");
         }
 
-        if (!playerSlotTable.contains(info.playerData)) playerSlotTable.emplace(info.playerData, i);
-        playerInfos[i] = std::move(info);
+        storePlayerInfo(i, std::move(info));
     }
 
     PlayerFetchFlags PlayerTracker::fetchPlayer_BasicInfo(size_t i, bool inQuest, bool online, PlayerInfo& out) {
@@ -1178,7 +1362,7 @@ namespace kbf {
 
         std::string playerName = REInvokeStr(cPlayerContext, "get_PlayerName", {});
         if (playerName.empty()) {
-            DEBUG_STACK.push(std::format("{} Fetched player at index {}, but name returned nullptr, skipping.", PLAYER_TRACKER_LOG_TAG, i), DebugStack::Color::COL_WARNING);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Fetched player at index {}, but name returned nullptr, skipping.", PLAYER_TRACKER_LOG_TAG, i);
             return PlayerFetchFlags::FETCH_ERROR_NULL;
         }
 
@@ -1187,7 +1371,7 @@ namespace kbf {
 
         REApi::ManagedObject* playerNetInfo = REInvokePtr<REApi::ManagedObject>(Net_UserInfoList, "getInfoSystem(System.UInt32)", { (void*)unsignedNetworkIdx });
         if (playerNetInfo == nullptr) {
-            DEBUG_STACK.push(std::format("{} Fetched player at index {}, but playerNetInfo returned nullptr, skipping.", PLAYER_TRACKER_LOG_TAG, i), DebugStack::Color::COL_WARNING);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Fetched player at index {}, but playerNetInfo returned nullptr, skipping.", PLAYER_TRACKER_LOG_TAG, i);
             return PlayerFetchFlags::FETCH_ERROR_NULL;
         }
         //DEBUG_STACK.push(std::format("playerNetInfo PTR: {} - Properties:\n{}",       ptrToHexString(playerNetInfo),       reObjectPropertiesToString(playerNetInfo)),       DebugStack::Color::DEBUG);
@@ -1196,7 +1380,7 @@ namespace kbf {
         if (online) {
             hunterId = REInvokeStr(playerNetInfo, "get_ShortHunterId", {});
             if (hunterId.empty()) {
-                DEBUG_STACK.push(std::format("{} Fetched player at index {}, but hunterId returned nullptr, skipping.", PLAYER_TRACKER_LOG_TAG, i), DebugStack::Color::COL_WARNING);
+                DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Fetched player at index {}, but hunterId returned nullptr, skipping.", PLAYER_TRACKER_LOG_TAG, i);
                 return PlayerFetchFlags::FETCH_ERROR_NULL;
             }
         }
@@ -1207,14 +1391,14 @@ namespace kbf {
                 hunterId = REInvokeStr(netContextManager, "get_HunterShortId", {});
             }
             else {
-                DEBUG_STACK.push(std::format("{} Failed to fetch Hunter ID in singleplayer.", PLAYER_TRACKER_LOG_TAG, i), DebugStack::Color::COL_WARNING);
+                DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Failed to fetch Hunter ID in singleplayer.", PLAYER_TRACKER_LOG_TAG, i);
                 return PlayerFetchFlags::FETCH_ERROR_NULL;
             }
         }
 
         bool female      = REInvoke<bool>(HunterCharacter, "get_IsFemale",   {}, InvokeReturnType::BOOL);
-        bool weaponDrawn = REInvoke<bool>(HunterCharacter, "get_IsWeaponOn", {}, InvokeReturnType::BOOL);
-        bool inCombat    = REInvoke<bool>(HunterCharacter, "get_IsCombat",   {}, InvokeReturnType::BOOL);
+        bool weaponDrawn = HUNTER_CHARACTER_IS_WEAPON_ON.read(HunterCharacter);
+        bool inCombat    = HUNTER_CHARACTER_IS_COMBAT.read(HunterCharacter);
 
         PlayerData playerData{};
         playerData.name = playerName;
@@ -1252,27 +1436,27 @@ namespace kbf {
     void PlayerTracker::fetchPlayer_Visibility(PlayerInfo& info) {
 		info.visible = false;
 
-		bool isSetUp = REInvoke<bool>(info.optionalPointers.HunterCharacter, "get_IsSetUp", {}, InvokeReturnType::BOOL);
+		bool isSetUp = HUNTER_CHARACTER_IS_SET_UP.read(info.optionalPointers.HunterCharacter);
         if (!isSetUp) return;
 
         info.distanceFromCameraSq = FLT_MAX;
 
-        info.weaponDrawn     = REInvoke<bool>(info.optionalPointers.HunterCharacter, "get_IsWeaponOn", {}, InvokeReturnType::BOOL);
-        info.inCombat        = REInvoke<bool>(info.optionalPointers.HunterCharacter, "get_IsCombat", {}, InvokeReturnType::BOOL);
-        info.inTent          = REInvoke<bool>(info.optionalPointers.HunterCharacter, "get_IsInAllTent", {}, InvokeReturnType::BOOL);
-        info.isRidingSeikret = REInvoke<bool>(info.optionalPointers.HunterCharacter, "get_IsPorterRiding", {}, InvokeReturnType::BOOL);
+        info.weaponDrawn     = HUNTER_CHARACTER_IS_WEAPON_ON.read(info.optionalPointers.HunterCharacter);
+        info.inCombat        = HUNTER_CHARACTER_IS_COMBAT.read(info.optionalPointers.HunterCharacter);
+        info.inTent          = HUNTER_CHARACTER_IS_IN_ALL_TENT.read(info.optionalPointers.HunterCharacter);
+        info.isRidingSeikret = HUNTER_CHARACTER_IS_PORTER_RIDING.read(info.optionalPointers.HunterCharacter);
 
         // UPDATE NOTE: These will likely change with future updates!!
         // ITEM_0019 = Whetstone (v=20)
         // ITEM_0297 = Whetfish Fin (v=270)
         // ITEM_0710 = Whetfish Fin+ (v=683)
-        uint32_t itemDef_ID = REInvoke<uint32_t>(info.optionalPointers.HunterCharacter, "get_UsedItemID", {}, InvokeReturnType::DWORD);
+        uint32_t itemDef_ID = HUNTER_CHARACTER_USED_ITEM_ID.read(info.optionalPointers.HunterCharacter);
         info.isSharpening = (itemDef_ID == 20 || itemDef_ID == 270 || itemDef_ID == 683);
 
-        const bool motionSkipped = REInvoke<bool>(info.optionalPointers.Motion, "get_SkipUpdate", {}, InvokeReturnType::BOOL);
+        const bool motionSkipped = MOTION_SKIP_UPDATE.read(info.optionalPointers.Motion);
         if (motionSkipped) return;
 
-        const float& distThreshold = dataManager.settings().applicationRange;
+        const float distThreshold = FRAME_BUDGET.getLimits(dataManager.settings()).applicationRange;
         double sqDist = REInvoke<double>(info.optionalPointers.HunterCharacter, "getCameraDistanceSqXZ", {}, InvokeReturnType::DOUBLE);
         if (distThreshold > 0 && sqDist > distThreshold * distThreshold) return;
 
@@ -1281,15 +1465,15 @@ namespace kbf {
         return;
     }
 
-    bool PlayerTracker::fetchPlayer_PersistentInfo(size_t i, const PlayerInfo& info, PersistentPlayerInfo& pInfo) {
-        if (frameBoneFetchCount != 0 && frameBoneFetchCount >= dataManager.settings().maxBoneFetchesPerFrame) return false;
+    FetchFailure PlayerTracker::fetchPlayer_PersistentInfo(size_t i, const PlayerInfo& info, PersistentPlayerInfo& pInfo) {
+        if (frameBoneFetchCount != 0 && frameBoneFetchCount >= FRAME_BUDGET.getLimits(dataManager.settings()).maxBoneFetchesPerFrame) return FetchFailure::FRAME_BUDGET;
 
         BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Player Fetch - Normal Gameplay - Equipped Armours");
         bool fetchedArmours = fetchPlayer_EquippedArmours(info, pInfo);
         END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Player Fetch - Normal Gameplay - Equipped Armours");
         if (!fetchedArmours) {
-            DEBUG_STACK.push(std::format("{} Failed to fetch equipped armours for Player: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, i), DebugStack::Color::COL_WARNING);
-            return false;
+            DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Failed to fetch equipped armours for Player: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, i);
+            return FetchFailure::ARMOUR_INFO;
         }
 
         BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Player Fetch - Normal Gameplay - Armour Transforms");
@@ -1318,7 +1502,7 @@ namespace kbf {
             //    expectedSlinger.name,
             //    dumpTransformTreeString(info.pointers.Transform)
             //), DebugStack::Color::COL_DEBUG);
-            return false;
+            return FetchFailure::ARMOUR_TRANSFORMS;
         }
 
         BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Player Fetch - Normal Gameplay - Bones");
@@ -1331,24 +1515,24 @@ namespace kbf {
             else if (pInfo.Transform_legs == nullptr)     reason = "Legs Transform ptr was null";
             else if (!pInfo.armourInfo.body.has_value())  reason = "No body armour found";
             else if (!pInfo.armourInfo.legs.has_value())  reason = "No legs armour found";
-            DEBUG_STACK.push(std::format("{} Failed to fetch bones for Player: {} [{}]. Reason: {}.", PLAYER_TRACKER_LOG_TAG, info.playerData.name, i, reason), DebugStack::Color::COL_WARNING);
-            return false;
+            DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Failed to fetch bones for Player: {} [{}]. Reason: {}.", PLAYER_TRACKER_LOG_TAG, info.playerData.name, i, reason);
+            return FetchFailure::BONES;
         }
 
         BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Player Fetch - Normal Gameplay - Parts");
         bool fetchedParts = fetchPlayer_Parts(info, pInfo);
         END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Player Fetch - Normal Gameplay - Parts");
         if (!fetchedParts) {
-            DEBUG_STACK.push(std::format("{} Failed to fetch parts for Player: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, i), DebugStack::Color::COL_WARNING);
-            return false;
+            DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Failed to fetch parts for Player: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, i);
+            return FetchFailure::PARTS;
         }
 
         BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Player Fetch - Normal Gameplay - Materials");
         bool fetchedMats = fetchPlayer_Materials(info, pInfo);
         END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Player Fetch - Normal Gameplay - Materials");
         if (!fetchedMats) {
-            DEBUG_STACK.push(std::format("{} Failed to fetch materials for Player: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, i), DebugStack::Color::COL_WARNING);
-            return false;
+            DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Failed to fetch materials for Player: {} [{}]", PLAYER_TRACKER_LOG_TAG, info.playerData.name, i);
+            return FetchFailure::MATERIALS;
         }
 
         BEGIN_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Player Fetch - Normal Gameplay - Weapons");
@@ -1356,7 +1540,7 @@ namespace kbf {
         END_CPU_PROFILING_BLOCK(CpuProfiler::GlobalMultiScopeProfiler, "Player Fetch - Normal Gameplay - Weapons");
 
         frameBoneFetchCount++; // Consider moving this to top to limit effect of failed fetches - may make fetches inaccessible if there are enough errors though.
-        return true;
+        return FetchFailure::NONE;
     }
 
     bool PlayerTracker::fetchPlayer_EquippedArmours(const PlayerInfo& info, PersistentPlayerInfo& pInfo) {
@@ -1700,10 +1884,10 @@ namespace kbf {
         if (pInfo.Transform_base == nullptr) return false;
 
         // TOOD: Could grab these from HunterCharacter::get_Weapon() / ::get_ReserveWeapon() / get_SubWeapon() / get_ReserveSubWeapon()
-        REApi::ManagedObject* Wp_Parent           = findTransform(pInfo.Transform_base, "Wp_Parent");
-        REApi::ManagedObject* WpSub_Parent        = findTransform(pInfo.Transform_base, "WpSub_Parent");
-        REApi::ManagedObject* Wp_ReserveParent    = findTransform(pInfo.Transform_base, "Wp_ReserveParent");
-        REApi::ManagedObject* WpSub_ReserveParent = findTransform(pInfo.Transform_base, "WpSub_ReserveParent");
+        REApi::ManagedObject* Wp_Parent           = findTransform(pInfo.Transform_base, "Wp_Parent", "Player");
+        REApi::ManagedObject* WpSub_Parent        = findTransform(pInfo.Transform_base, "WpSub_Parent", "Player");
+        REApi::ManagedObject* Wp_ReserveParent    = findTransform(pInfo.Transform_base, "Wp_ReserveParent", "Player");
+        REApi::ManagedObject* WpSub_ReserveParent = findTransform(pInfo.Transform_base, "WpSub_ReserveParent", "Player");
 
         if (Wp_Parent == nullptr)           return false;
         if (WpSub_Parent == nullptr)        return false;
@@ -1993,7 +2177,7 @@ namespace kbf {
             REApi::ManagedObject* gameObject = REInvokePtr<REApi::ManagedObject>(transform, "get_GameObject", {});
             if (!gameObject) continue;
 
-            std::string name = REInvokeStr(gameObject, "get_Name", {});
+            std::string_view name = REInvokeStrView(gameObject, "get_Name", {});
 
             if (name.starts_with(hunter.female ? transformPrefixXX : transformPrefixXY)) {
                 outInfo.pointers.Transform = transform;
@@ -2055,18 +2239,13 @@ namespace kbf {
         return scene;
     }
 
-    void PlayerTracker::updateApplyDelays() {
-        std::vector<PlayerData> timestampsExpired{};
-        std::chrono::steady_clock::time_point now = std::chrono::high_resolution_clock::now();
+    void PlayerTracker::startApplyDelay(size_t index) {
+        applyScheduler.startDelay(static_cast<uint32_t>(index), ApplyScheduler::Clock::now(), dataManager.settings().delayOnEquip);
+    }
 
-        for (const auto& [player, optTimestamp] : playerApplyDelays) {
-            if (!optTimestamp.has_value()) continue;
-            
-            double durationMs = std::chrono::duration<double, std::milli>(now - optTimestamp.value()).count();
-            if (durationMs >= dataManager.settings().delayOnEquip * 1000.0f) {
-                playerApplyDelays[player] = std::nullopt;
-            }
-        }
+    void PlayerTracker::updateApplyDelays() {
+        // Expired slots simply stop being delayed, which is all applyPresets checks for.
+        applyScheduler.advance(ApplyScheduler::Clock::now());
     }
 
     int PlayerTracker::onIsEquipBuildEndHook(int argc, void** argv, REFrameworkTypeDefinitionHandle* arg_tys, unsigned long long ret_addr) {
@@ -2111,21 +2290,44 @@ namespace kbf {
         if (app_HunterCharacter == nullptr) return REFRAMEWORK_HOOK_CALL_ORIGINAL;
 
         int idx = REInvoke<int>(app_HunterCharacter, "get_StableMemberIndex", {}, InvokeReturnType::DWORD);
-        if (idx < 0 || idx >= playerListSize) return REFRAMEWORK_HOOK_CALL_ORIGINAL;
+        if (idx < 0 || static_cast<size_t>(idx) >= playerListSize.load(std::memory_order_acquire)) return REFRAMEWORK_HOOK_CALL_ORIGINAL;
+
+        // Only flag the slot - the update thread picks this up in drainFetchRequests and resets its retry state there.
+        playerFetchRequests[static_cast<size_t>(idx)].store(true, std::memory_order_release);
+        TRACKER_RECORDER.recordRefetch(TrackedCharacterKind::PLAYER, static_cast<size_t>(idx));
 
-        playersToFetch[static_cast<size_t>(idx)] = true;
+        // Equipping & warping swap out the objects we hold pointers to, so re-check them until the refetch lands.
+        pointerValidity.invalidateAll();
 
         return REFRAMEWORK_HOOK_CALL_ORIGINAL;
     }
 
     void PlayerTracker::clearPlayerSlot(size_t index) {
         if (index >= playerInfos.size()) return;
+        fetchRetries.reset(index);
+        applyScheduler.cancelDelay(static_cast<uint32_t>(index));
+        pointerValidity.invalidate(index);
         if (playerInfos[index]) {
-            playerSlotTable.erase(playerInfos[index]->playerData);
+            releaseSlot(index);
             occupiedNormalGameplaySlots[index] = false;
             playerInfos[index]           = std::nullopt;
             persistentPlayerInfos[index] = std::nullopt;
         }
     }
 
+    void PlayerTracker::storePlayerInfo(size_t index, PlayerInfo&& info) {
+        const bool newOccupant = !playerInfos[index].has_value() || !(playerInfos[index]->playerData == info.playerData);
+        if (newOccupant) {
+            if (playerInfos[index]) releaseSlot(index);
+            playerSlotTable.insert_or_assign(info.playerData, index);
+        }
+        playerInfos[index] = std::move(info);
+    }
+
+    void PlayerTracker::releaseSlot(size_t index) {
+        // The same player may have already been re-registered to another slot.
+        const auto it = playerSlotTable.find(playerInfos[index]->playerData);
+        if (it != playerSlotTable.end() && it->second == index) playerSlotTable.erase(it);
+    }
+
 }
\ No newline at end of file
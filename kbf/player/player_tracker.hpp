@@ -5,10 +5,20 @@
 #include <kbf/player/player_info.hpp>
 #include <kbf/player/persistent_player_info.hpp>
 #include <kbf/player/player_fetch_flags.hpp>
+#include <kbf/player/player_tracker_snapshot.hpp>
 #include <kbf/situation/lobby_type.hpp>
 #include <kbf/situation/situation_watcher.hpp>
 #include <kbf/enums/armor_parts.hpp>
-
+#include <kbf/debug/memory_footprint.hpp>
+#include <kbf/util/algorithm/apply_scheduler.hpp>
+#include <kbf/util/algorithm/fetch_retry_scheduler.hpp>
+#include <kbf/util/re_engine/pointer_validity_cache.hpp>
+#include <kbf/util/concurrency/worker_pool.hpp>
+#include <kbf/util/concurrency/snapshot_buffer.hpp>
+#include <kbf/mesh/apply_commands.hpp>
+
+#include <atomic>
+#include <memory>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -18,13 +28,15 @@
 
 namespace kbf {
 
-    class PlayerTracker {
+    class PlayerTracker : public iMemoryReporter {
     public:
         PlayerTracker(KBFDataManager& dataManager) : dataManager{ dataManager } { initialize(); };
 
         void updatePlayers();
         void applyPresets();
         void reset();
+        // Joins the apply planner threads - before the dll unloads, see WorkerPool. They restart on the next big apply.
+        void stopWorkers() { applyPlanners.stop(); }
 
         const std::vector<PlayerData> getPlayerList() const;
 
@@ -34,6 +46,19 @@ namespace kbf {
 		const std::optional<PersistentPlayerInfo>& getPersistentPlayerInfo(const PlayerData& playerData) const { return persistentPlayerInfos.at(playerSlotTable.at(playerData)); }
 		std::optional<PersistentPlayerInfo>& getPersistentPlayerInfo(const PlayerData& playerData) { return persistentPlayerInfos.at(playerSlotTable.at(playerData)); }
 
+        // GUI thread only. The newest state published by the update thread - never waits on it, & the reference stays
+        //  unchanged until the next readSnapshot().
+        const PlayerTrackerSnapshot& readSnapshot() { return snapshots.read(); }
+
+        // GUI thread. Asks the update thread to re-measure getMemoryFootprint() - the containers it walks are only safe to
+        //  read there. The result lands in readMemoryFootprint() after the next update, bumping getMemoryFootprints().
+        void requestMemoryFootprint() { memoryFootprintRequested.store(true, std::memory_order_relaxed); }
+        const MemoryFootprint& readMemoryFootprint() { return memoryFootprints.read(); } // GUI thread only
+        uint64_t getMemoryFootprints() const { return memoryFootprints.getPublished(); }
+
+        // Update thread only, see requestMemoryFootprint().
+        MemoryFootprint getMemoryFootprint() const override;
+
     private:
         void initialize();
         void setupLists();
@@ -41,7 +66,7 @@ namespace kbf {
 
         KBFDataManager& dataManager;
 		static PlayerTracker* g_instance;
-		size_t playerListSize = 0;
+		std::atomic<size_t> playerListSize = 0; // Read by the equip / warp hooks, off the update thread
 
         void fetchPlayers();
         void fetchPlayers_MainMenu();
@@ -57,7 +82,7 @@ namespace kbf {
         void fetchPlayers_NormalGameplay();
         void fetchPlayers_NormalGameplay_SinglePlayer(size_t i, bool useCache, bool inQuest, bool online);
         PlayerFetchFlags fetchPlayer_BasicInfo(size_t i, bool inQuest, bool online, PlayerInfo& outInfo);
-        bool fetchPlayer_PersistentInfo(size_t i, const PlayerInfo& info, PersistentPlayerInfo& pInfo);
+        FetchFailure fetchPlayer_PersistentInfo(size_t i, const PlayerInfo& info, PersistentPlayerInfo& pInfo);
 		void fetchPlayer_Visibility(PlayerInfo& info);
         bool fetchPlayer_EquippedArmours(const PlayerInfo& info, PersistentPlayerInfo& pInfo);
 		bool fetchPlayer_EquippedArmours_FromSaveFile(const PlayerInfo& info, PersistentPlayerInfo& pInfo, int saveIdx = -1, bool overrideInner = false);
@@ -73,6 +98,7 @@ namespace kbf {
         bool fetchPlayer_Parts(const PlayerInfo& info, PersistentPlayerInfo& pInfo);
         bool fetchPlayer_Materials(const PlayerInfo& info, PersistentPlayerInfo& pInfo);
         void clearPlayerSlot(size_t index);
+        void drainFetchRequests();
 
         static int onIsEquipBuildEndHook(int argc, void** argv, REFrameworkTypeDefinitionHandle* arg_tys, unsigned long long ret_addr);
         int onIsEquipBuildEnd(int argc, void** argv, REFrameworkTypeDefinitionHandle* arg_tys, unsigned long long ret_addr);
@@ -116,19 +142,43 @@ namespace kbf {
 
         REApi::ManagedObject* getCurrentScene() const;
 
+        void storePlayerInfo(size_t index, PlayerInfo&& info);
+        void releaseSlot(size_t index);
+
+        void planPlayerApply(size_t index, const Preset* previewedPreset, ApplyCommandBuffer& out);
+
+        void startApplyDelay(size_t index);
         void updateApplyDelays();
+        void recordInputs() const;
+        void publishSnapshot();
+        void publishMemoryFootprint();
 
-        //std::unordered_set<size_t> playersToFetch{};
+        // Everything below is indexed by player manager slot. The PlayerData -> slot table is only touched when a slot's
+        //  occupant changes (storePlayerInfo / releaseSlot), never per frame.
         std::unordered_map<PlayerData, size_t> playerSlotTable{};
-        std::unordered_map<PlayerData, std::optional<std::chrono::steady_clock::time_point>> playerApplyDelays{};
+        ApplyScheduler applyScheduler{}; // Apply delays by slot index & the per-frame nearest-N selection
+        PointerValidityCache pointerValidity{ 11 }; // Pointers checked by PersistentPlayerInfo::areSetPointersValid
 
-        std::vector<bool> playersToFetch;
-        std::vector<bool> occupiedNormalGameplaySlots{};
+        std::vector<uint8_t> playersToFetch;              // Update thread only - slots to keep fetching until one lands
+        std::unique_ptr<std::atomic<bool>[]> playerFetchRequests; // Set by the equip / warp hooks, drained by drainFetchRequests
+        FetchRetryScheduler fetchRetries{};
+        std::vector<uint8_t> occupiedNormalGameplaySlots{};
         std::vector<std::optional<PlayerInfo>> playerInfos;
 		std::vector<std::optional<PersistentPlayerInfo>> persistentPlayerInfos;
 
         std::vector<std::optional<NormalGameplayPlayerCache>> playerInfoCaches;
 
+        // Apply is planned for every selected player in parallel, then committed to the engine serially on this thread.
+        //  Below MIN_PARALLEL_APPLY_PLANS players, waking the planners costs more than planning inline.
+        static constexpr size_t MIN_PARALLEL_APPLY_PLANS = 4;
+        WorkerPool applyPlanners{ WorkerPool::defaultWorkerCount(3) };
+        std::vector<uint32_t> plannedSlots;            // This frame's players to apply, in culled order
+        std::vector<ApplyCommandBuffer> applyPlans;    // By position in plannedSlots, reused frame to frame
+
+        SnapshotBuffer<PlayerTrackerSnapshot> snapshots;
+        SnapshotBuffer<MemoryFootprint> memoryFootprints;
+        std::atomic<bool> memoryFootprintRequested{ false };
+
         // Main Menu Refs
         RENativeSingleton sceneManager{ "via.SceneManager" };
         RESingleton saveDataManager{ "app.SaveDataManager" };
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <kbf/player/player_info.hpp>
+#include <kbf/data/armour/armour_info.hpp>
+#include <kbf/profiling/tracker_health_snapshot.hpp>
+
+#include <reframework/API.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace kbf {
+
+	// The parts of PersistentPlayerInfo the GUI shows - the managers stay with the tracker.
+	struct PersistentPlayerSnapshot {
+		ArmourInfo armourInfo;
+
+		reframework::API::ManagedObject* Wp_Parent_GameObject           = nullptr;
+		reframework::API::ManagedObject* WpSub_Parent_GameObject        = nullptr;
+		reframework::API::ManagedObject* Wp_ReserveParent_GameObject    = nullptr;
+		reframework::API::ManagedObject* WpSub_ReserveParent_GameObject = nullptr;
+		reframework::API::ManagedObject* Wp_Insect                      = nullptr;
+		reframework::API::ManagedObject* Wp_ReserveInsect               = nullptr;
+	};
+
+	struct PlayerSnapshot {
+		PlayerInfo info;
+		std::optional<PersistentPlayerSnapshot> persistent;
+	};
+
+	// Everything the GUI reads from the player tracker, published once per frame by the update thread.
+	struct PlayerTrackerSnapshot {
+		uint64_t frame = 0;
+		std::vector<PlayerSnapshot> players; // Occupied slots, in slot order
+		TrackerHealthSnapshot health;
+
+		size_t   plannedLastFrame = 0;
+		size_t   plannerThreads   = 0;
+		bool     plannersStarted  = false;
+		uint64_t parallelPlans    = 0;
+		uint64_t inlinePlans      = 0;
+	};
+
+}
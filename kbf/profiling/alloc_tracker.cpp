@@ -0,0 +1,213 @@
+#include <kbf/profiling/alloc_tracker.hpp>
+
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <format>
+#include <windows.h>
+#endif
+
+namespace kbf {
+
+    namespace {
+
+        // Plain thread_local PODs - no constructors, so they're safe to touch from inside operator new.
+        thread_local AllocCounters threadAllocCounters{};
+        thread_local uint32_t      threadNoAllocDepth = 0;
+
+        inline void updateMax(std::atomic<uint64_t>& max, uint64_t value) {
+            uint64_t current = max.load(std::memory_order_relaxed);
+            while (value > current && !max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+        }
+
+        void* allocate(std::size_t size) {
+            if (AllocTracker::isEnabled()) AllocTracker::onAllocate(size);
+            if (size == 0) size = 1;
+
+            while (true) {
+                if (void* ptr = std::malloc(size)) return ptr;
+
+                std::new_handler handler = std::get_new_handler();
+                if (handler == nullptr) return nullptr;
+                handler();
+            }
+        }
+
+        void* allocateAligned(std::size_t size, std::align_val_t alignment) {
+            if (AllocTracker::isEnabled()) AllocTracker::onAllocate(size);
+            if (size == 0) size = 1;
+
+            const size_t align = static_cast<size_t>(alignment);
+            while (true) {
+#ifdef _MSC_VER
+                if (void* ptr = _aligned_malloc(size, align)) return ptr;
+#else
+                if (void* ptr = std::aligned_alloc(align, (size + align - 1) & ~(align - 1))) return ptr;
+#endif
+
+                std::new_handler handler = std::get_new_handler();
+                if (handler == nullptr) return nullptr;
+                handler();
+            }
+        }
+
+        void deallocateAligned(void* ptr) {
+#ifdef _MSC_VER
+            _aligned_free(ptr);
+#else
+            std::free(ptr);
+#endif
+        }
+
+    }
+
+    void AllocTracker::onAllocate(size_t size) {
+        threadAllocCounters.allocations++;
+        threadAllocCounters.bytes += size;
+
+        frameAllocations.fetch_add(1, std::memory_order_relaxed);
+        frameBytes.fetch_add(size, std::memory_order_relaxed);
+
+        if (threadNoAllocDepth != 0 && isAssertZero()) onViolation(size);
+    }
+
+    void AllocTracker::onViolation(size_t size) {
+        violations.fetch_add(1, std::memory_order_relaxed);
+        frameViolations.fetch_add(1, std::memory_order_relaxed);
+
+        bool expected = false;
+        if (firstViolationCaptured.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+            firstViolationSize = size;
+#ifdef _WIN32
+            // Skip onViolation, onAllocate & the allocation function itself.
+            firstViolationFrameCount = CaptureStackBackTrace(3, static_cast<DWORD>(MAX_VIOLATION_FRAMES), firstViolationFrames.data(), nullptr);
+#endif
+        }
+
+#ifdef _WIN32
+        if (isBreakOnViolation() && IsDebuggerPresent()) __debugbreak();
+#endif
+    }
+
+    void AllocTracker::beginFrame() {
+        const uint64_t allocations = frameAllocations.exchange(0, std::memory_order_relaxed);
+        const uint64_t bytes       = frameBytes.exchange(0, std::memory_order_relaxed);
+        lastFrameAllocations.store(allocations, std::memory_order_relaxed);
+        lastFrameBytes.store(bytes, std::memory_order_relaxed);
+        updateMax(maxFrameAllocations, allocations);
+        updateMax(maxFrameBytes, bytes);
+
+        if (frameViolations.exchange(0, std::memory_order_relaxed) > 0) violatingFrames.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void AllocTracker::reset() {
+        frameAllocations.store(0, std::memory_order_relaxed);
+        frameBytes.store(0, std::memory_order_relaxed);
+        lastFrameAllocations.store(0, std::memory_order_relaxed);
+        lastFrameBytes.store(0, std::memory_order_relaxed);
+        maxFrameAllocations.store(0, std::memory_order_relaxed);
+        maxFrameBytes.store(0, std::memory_order_relaxed);
+        violations.store(0, std::memory_order_relaxed);
+        frameViolations.store(0, std::memory_order_relaxed);
+        violatingFrames.store(0, std::memory_order_relaxed);
+        firstViolationCaptured.store(false, std::memory_order_release);
+    }
+
+    AllocCounters AllocTracker::threadCounters() {
+        return threadAllocCounters;
+    }
+
+    std::string AllocTracker::formatFirstViolation() {
+        if (!firstViolationCaptured.load(std::memory_order_acquire)) return "No violations recorded.";
+
+        std::string out = "First violation: " + std::to_string(firstViolationSize) + " byte allocation";
+#ifdef _WIN32
+        for (uint16_t i = 0; i < firstViolationFrameCount; i++) {
+            const void* addr = firstViolationFrames[i];
+
+            HMODULE module = nullptr;
+            char moduleFileName[MAX_PATH] = {};
+            if (GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+                reinterpret_cast<LPCSTR>(addr), &module)
+            ) {
+                GetModuleFileNameA(module, moduleFileName, MAX_PATH);
+            }
+
+            const char* moduleName = moduleFileName[0] ? moduleFileName : "UnknownModule";
+            const uintptr_t offset = reinterpret_cast<uintptr_t>(addr) - reinterpret_cast<uintptr_t>(module);
+            out += std::format("\nFrame:    {} + 0x{:016x}", moduleName, offset);
+        }
+#endif
+        return out;
+    }
+
+    NoAllocScope::NoAllocScope() {
+        threadNoAllocDepth++;
+    }
+
+    NoAllocScope::~NoAllocScope() {
+        threadNoAllocDepth--;
+    }
+
+    AllocAllowedScope::AllocAllowedScope() : suspendedDepth{ threadNoAllocDepth } {
+        threadNoAllocDepth = 0;
+    }
+
+    AllocAllowedScope::~AllocAllowedScope() {
+        threadNoAllocDepth = suspendedDepth;
+    }
+
+}
+
+// ---- Replacement allocation functions ---------------------------------------------------------------------
+// These apply to this module only, so only KBF's own allocations are counted.
+
+void* operator new(std::size_t size) {
+    if (void* ptr = kbf::allocate(size)) return ptr;
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size) {
+    if (void* ptr = kbf::allocate(size)) return ptr;
+    throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return kbf::allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return kbf::allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    if (void* ptr = kbf::allocateAligned(size, alignment)) return ptr;
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    if (void* ptr = kbf::allocateAligned(size, alignment)) return ptr;
+    throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return kbf::allocateAligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return kbf::allocateAligned(size, alignment);
+}
+
+void operator delete(void* ptr) noexcept                                          { std::free(ptr); }
+void operator delete[](void* ptr) noexcept                                        { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept                             { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept                           { std::free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept                   { std::free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept                 { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept                        { kbf::deallocateAligned(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept                      { kbf::deallocateAligned(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept           { kbf::deallocateAligned(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept         { kbf::deallocateAligned(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { kbf::deallocateAligned(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { kbf::deallocateAligned(ptr); }
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Mark a region whose steady state must not touch the heap. Allocations inside are violations while assert mode is on.
+#define ALLOC_TRACKER_EXPECT_NONE(varName) ::kbf::NoAllocScope varName{};
+// Lift the above for a nested region that's expected to allocate - a container growing, a cache miss - until it closes.
+#define ALLOC_TRACKER_ALLOW(varName) ::kbf::AllocAllowedScope varName{};
+
+namespace kbf {
+
+    // Monotonic per-thread allocation counters. Diff two reads to get the allocations made in between.
+    struct AllocCounters {
+        uint64_t allocations = 0;
+        uint64_t bytes       = 0;
+    };
+
+    // Counts heap allocations made by KBF, via replacement global operator new / delete (see alloc_tracker.cpp).
+    // Tracking is off by default and costs one relaxed load per allocation until enabled.
+    class AllocTracker {
+    public:
+        static constexpr size_t MAX_VIOLATION_FRAMES = 24;
+
+        static bool isEnabled() { return enabled.load(std::memory_order_relaxed); }
+        static void setEnabled(bool enable) { enabled.store(enable, std::memory_order_relaxed); }
+
+        // Zero-allocation assertion mode - allocations inside ALLOC_TRACKER_EXPECT_NONE scopes are counted as violations,
+        //  the first one's call stack is kept, and we break into an attached debugger if requested.
+        static bool isAssertZero() { return assertZero.load(std::memory_order_relaxed); }
+        static void setAssertZero(bool enable) { assertZero.store(enable, std::memory_order_relaxed); }
+        static bool isBreakOnViolation() { return breakOnViolation.load(std::memory_order_relaxed); }
+        static void setBreakOnViolation(bool enable) { breakOnViolation.store(enable, std::memory_order_relaxed); }
+
+        // Called once per game frame, rolls the per-frame counters over.
+        static void beginFrame();
+        static void reset();
+
+        static AllocCounters threadCounters();
+
+        static uint64_t getLastFrameAllocations() { return lastFrameAllocations.load(std::memory_order_relaxed); }
+        static uint64_t getLastFrameBytes() { return lastFrameBytes.load(std::memory_order_relaxed); }
+        static uint64_t getMaxFrameAllocations() { return maxFrameAllocations.load(std::memory_order_relaxed); }
+        static uint64_t getMaxFrameBytes() { return maxFrameBytes.load(std::memory_order_relaxed); }
+        static uint64_t getViolations() { return violations.load(std::memory_order_relaxed); }
+        static uint64_t getViolatingFrames() { return violatingFrames.load(std::memory_order_relaxed); }
+
+        // Formats the stack captured at the first violation since the last reset, as `module + offset` frames.
+        static std::string formatFirstViolation();
+
+        // Hooks for the replacement allocation functions.
+        static void onAllocate(size_t size);
+
+    private:
+        friend class NoAllocScope;
+        friend class AllocAllowedScope;
+
+        static void onViolation(size_t size);
+
+        static inline std::atomic<bool> enabled{ false };
+        static inline std::atomic<bool> assertZero{ false };
+        static inline std::atomic<bool> breakOnViolation{ false };
+
+        static inline std::atomic<uint64_t> frameAllocations{ 0 };
+        static inline std::atomic<uint64_t> frameBytes{ 0 };
+        static inline std::atomic<uint64_t> lastFrameAllocations{ 0 };
+        static inline std::atomic<uint64_t> lastFrameBytes{ 0 };
+        static inline std::atomic<uint64_t> maxFrameAllocations{ 0 };
+        static inline std::atomic<uint64_t> maxFrameBytes{ 0 };
+
+        static inline std::atomic<uint64_t> violations{ 0 };
+        static inline std::atomic<uint64_t> frameViolations{ 0 };
+        static inline std::atomic<uint64_t> violatingFrames{ 0 };
+
+        static inline std::atomic<bool> firstViolationCaptured{ false };
+        static inline size_t firstViolationSize = 0;
+        static inline uint16_t firstViolationFrameCount = 0;
+        static inline std::array<void*, MAX_VIOLATION_FRAMES> firstViolationFrames{};
+    };
+
+    class NoAllocScope {
+    public:
+        NoAllocScope();
+        ~NoAllocScope();
+
+        NoAllocScope(const NoAllocScope&) = delete;
+        NoAllocScope& operator=(const NoAllocScope&) = delete;
+    };
+
+    // Scopes are per-thread - work handed to another thread (e.g. the planner pool) needs its own NoAllocScope.
+    class AllocAllowedScope {
+    public:
+        AllocAllowedScope();
+        ~AllocAllowedScope();
+
+        AllocAllowedScope(const AllocAllowedScope&) = delete;
+        AllocAllowedScope& operator=(const AllocAllowedScope&) = delete;
+
+    private:
+        uint32_t suspendedDepth = 0;
+    };
+
+}
@@ -1,7 +1,16 @@
 #include <kbf/profiling/cpu_profiler.hpp>
 
+#include <kbf/profiling/trace_capture.hpp>
+#include <kbf/profiling/alloc_tracker.hpp>
+
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <cassert>
+#include <fstream>
 
 namespace kbf {
 
@@ -10,11 +19,94 @@ namespace kbf {
     // Profiler reserved for arbitrary usage. i.e. allow overlapping profiling blocks.
     std::unique_ptr<CpuProfiler> CpuProfiler::GlobalMultiScopeProfiler = nullptr;
 
+    namespace {
+
+        inline int64_t nowTicks() {
+            return std::chrono::steady_clock::now().time_since_epoch().count();
+        }
+
+        inline double ticksToMs(int64_t ticks) {
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::duration(ticks)).count();
+        }
+
+        inline uint64_t ticksToNs(int64_t ticks) {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::duration(ticks)).count());
+        }
+
+        inline double nsToMs(uint64_t ns) {
+            return static_cast<double>(ns) / 1e6;
+        }
+
+        ProfilingPercentiles getPercentiles(const LatencyHistogram::Snapshot& snapshot) {
+            ProfilingPercentiles percentiles{};
+            percentiles.p50Ms   = nsToMs(snapshot.valueAtPercentileNs(0.50));
+            percentiles.p90Ms   = nsToMs(snapshot.valueAtPercentileNs(0.90));
+            percentiles.p99Ms   = nsToMs(snapshot.valueAtPercentileNs(0.99));
+            percentiles.p999Ms  = nsToMs(snapshot.valueAtPercentileNs(0.999));
+            percentiles.samples = snapshot.total;
+            return percentiles;
+        }
+
+        inline int64_t msToTicks(double ms) {
+            return std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double, std::milli>(ms)).count();
+        }
+
+        // Start timestamps live per-thread so that concurrent threads timing the same block don't clobber each other.
+        inline int64_t& threadStartTicks(uint32_t profilerSlot, uint32_t blockIdx) {
+            thread_local std::array<int64_t, CpuProfiler::MAX_PROFILERS * CpuProfiler::MAX_BLOCKS> starts{};
+            return starts[profilerSlot * CpuProfiler::MAX_BLOCKS + blockIdx];
+        }
+
+        inline AllocCounters& threadStartAllocs(uint32_t profilerSlot, uint32_t blockIdx) {
+            thread_local std::array<AllocCounters, CpuProfiler::MAX_PROFILERS * CpuProfiler::MAX_BLOCKS> starts{};
+            return starts[profilerSlot * CpuProfiler::MAX_BLOCKS + blockIdx];
+        }
+
+        std::atomic<uint32_t> usedProfilerSlots{ 0 };
+
+        uint32_t claimProfilerSlot() {
+            uint32_t used = usedProfilerSlots.load();
+            while (true) {
+                uint32_t slot = 0;
+                while (slot < CpuProfiler::MAX_PROFILERS && (used & (1u << slot))) slot++;
+                if (slot == CpuProfiler::MAX_PROFILERS) return UINT32_MAX;
+
+                // On failure used is refreshed, so just rescan
+                if (usedProfilerSlots.compare_exchange_weak(used, used | (1u << slot))) return slot;
+            }
+        }
+
+        void releaseProfilerSlot(uint32_t slot) {
+            if (slot < CpuProfiler::MAX_PROFILERS) usedProfilerSlots.fetch_and(~(1u << slot));
+        }
+
+        // Live profiler per slot, so deferred samples can be routed without holding a pointer that may have died.
+        std::array<std::atomic<CpuProfiler*>, CpuProfiler::MAX_PROFILERS> liveProfilers{};
+        std::atomic<uint32_t> nextProfilerGeneration{ 1 };
+        std::atomic<uint32_t> frameEpoch{ 0 };
+
+    }
+
+    // The window maxes & histograms cost several integer divides and contended RMWs per sample - more than the rest of
+    //  endBlock() put together. endBlock() only queues them here, and they're applied in a batch when the buffer fills or
+    //  the thread first ends a block in a new frame, where runs of the same block share the divides.
+    // Samples are tagged with the profiler's generation, so ones left behind by a destroyed profiler are dropped.
+    struct CpuProfiler::PendingSamples {
+        static constexpr size_t CAPACITY = 128;
+
+        std::array<PendingSample, CAPACITY> samples;
+        size_t   count     = 0;
+        uint32_t seenFrame = 0;
+    };
+
+    CpuProfiler::PendingSamples& CpuProfiler::threadPendingSamples() {
+        thread_local PendingSamples pending;
+        return pending;
+    }
+
     // ---- Builder ----------------------------------------------------------------------------------------------
     CpuProfiler::Builder& CpuProfiler::Builder::addBlock(std::string name) {
-        profilingBlocks.emplace(name, ProfilingBlock{ currentBlockIdx });
-        currentBlockIdx += 1u;
-
+        blockNames.push_back(std::move(name));
         return *this;
     };
 
@@ -24,122 +116,391 @@ namespace kbf {
 	}
 
     std::unique_ptr<CpuProfiler> CpuProfiler::Builder::build() const {
-        return std::make_unique<CpuProfiler>(profilingBlocks, windowSize);
+        return std::make_unique<CpuProfiler>(blockNames, windowSize);
     }
 
     // ---- Profiler ---------------------------------------------------------------------------------------------
     CpuProfiler::CpuProfiler(
-        NamedProfilingBlockMap profilingBlocks,
+        std::vector<std::string> names,
         double windowSize
-    ) : namedProfilingBlocks{ profilingBlocks }, windowSize{ windowSize } {
-        for (auto& kv : namedProfilingBlocks) {
-            recordedTimestamps.emplace(kv.first, ProfilingBlockTimestamp{});
-			namedSampleHistories.emplace(kv.first, std::deque<ProfilingSample>{});
+    ) : blockNames{ std::move(names) } {
+        assert(blockNames.size() <= MAX_BLOCKS && "Too many blocks for a single CpuProfiler, raise MAX_BLOCKS.");
+        if (blockNames.size() > MAX_BLOCKS) blockNames.resize(MAX_BLOCKS);
+
+        blockStates = std::make_unique<BlockState[]>(blockNames.size());
+
+        const int64_t windowTicks = msToTicks(windowSize * 1000.0);
+        bucketTicks = std::max<int64_t>(1, windowTicks / static_cast<int64_t>(SlidingWindowMax::BUCKET_COUNT));
+        setHistogramWindow(histogramWindowSeconds);
+
+        // Open addressed id -> index table, kept at most half full so probes stay short.
+        size_t tableSize = 8;
+        while (tableSize < blockNames.size() * 2) tableSize <<= 1;
+        lookupTable.resize(tableSize);
+        lookupMask = tableSize - 1;
+
+        for (uint32_t i = 0; i < blockNames.size(); i++) {
+            const ProfilingBlockId id = profilingBlockId(blockNames[i]);
+            size_t slot = id & lookupMask;
+            while (lookupTable[slot].id != 0) {
+                assert(lookupTable[slot].id != id && "Duplicate or colliding profiling block name.");
+                slot = (slot + 1) & lookupMask;
+            }
+            lookupTable[slot] = LookupEntry{ id, i };
+        }
+
+        profilerSlot = claimProfilerSlot();
+        assert(profilerSlot != UINT32_MAX && "Too many live CpuProfilers, raise MAX_PROFILERS.");
+
+        generation = nextProfilerGeneration.fetch_add(1, std::memory_order_relaxed);
+        if (profilerSlot != UINT32_MAX) liveProfilers[profilerSlot].store(this, std::memory_order_release);
+    }
+
+    CpuProfiler::~CpuProfiler() {
+        if (profilerSlot != UINT32_MAX) liveProfilers[profilerSlot].store(nullptr, std::memory_order_release);
+        releaseProfilerSlot(profilerSlot);
+    }
+
+    uint32_t CpuProfiler::findBlock(ProfilingBlockId id) const {
+        size_t slot = id & lookupMask;
+        while (true) {
+            const LookupEntry& entry = lookupTable[slot];
+            if (entry.id == id) return entry.idx;
+            if (entry.id == 0)  return INVALID_BLOCK;
+            slot = (slot + 1) & lookupMask;
         }
     }
 
     double CpuProfiler::getMs(const std::string& name) const {
-        auto it = namedProfilingBlocks.find(name);
-        if (it == namedProfilingBlocks.end()) return 0.0;
-        return it->second.ms;
+        uint32_t idx = findBlock(name);
+        if (idx == INVALID_BLOCK) return 0.0;
+        return ticksToMs(blockStates[idx].lastTicks.load(std::memory_order_relaxed));
     }
 
     double CpuProfiler::getAccumulatedMs(const std::string& name) const {
-        auto it = namedProfilingBlocks.find(name);
-        if (it == namedProfilingBlocks.end()) return 0.0;
-        return it->second.totalMs;
+        uint32_t idx = findBlock(name);
+        if (idx == INVALID_BLOCK) return 0.0;
+        return ticksToMs(blockStates[idx].totalTicks.load(std::memory_order_relaxed));
     }
 
     double CpuProfiler::getAverageMs(const std::string& name) const {
-        auto it = namedProfilingBlocks.find(name);
-        if (it == namedProfilingBlocks.end() || it->second.count == 0) return 0.0;
-        return it->second.totalMs / static_cast<double>(it->second.count);
+        uint32_t idx = findBlock(name);
+        if (idx == INVALID_BLOCK) return 0.0;
+
+        uint64_t count = blockStates[idx].count.load(std::memory_order_relaxed);
+        if (count == 0) return 0.0;
+        return ticksToMs(blockStates[idx].totalTicks.load(std::memory_order_relaxed)) / static_cast<double>(count);
     }
 
     void CpuProfiler::resetAccumulated(const std::string& name) {
-        auto it = namedProfilingBlocks.find(name);
-        if (it != namedProfilingBlocks.end()) {
-            it->second.totalMs = 0.0;
-            it->second.count = 0;
-        }
+        uint32_t idx = findBlock(name);
+        if (idx == INVALID_BLOCK) return;
+
+        blockStates[idx].totalTicks.store(0, std::memory_order_relaxed);
+        blockStates[idx].count.store(0, std::memory_order_relaxed);
+        blockStates[idx].allocations.store(0, std::memory_order_relaxed);
+        blockStates[idx].allocatedBytes.store(0, std::memory_order_relaxed);
     }
 
     void CpuProfiler::resetAccumulatedAll() {
-        for (auto& kv : namedProfilingBlocks) {
-            kv.second.totalMs = 0.0;
-            kv.second.count = 0;
+        for (size_t i = 0; i < blockNames.size(); i++) {
+            blockStates[i].totalTicks.store(0, std::memory_order_relaxed);
+            blockStates[i].count.store(0, std::memory_order_relaxed);
+            blockStates[i].allocations.store(0, std::memory_order_relaxed);
+            blockStates[i].allocatedBytes.store(0, std::memory_order_relaxed);
         }
     }
 
     void CpuProfiler::setBlockMillis(const std::string& name, double ms) {
-        namedProfilingBlocks[name].ms = ms;
+        uint32_t idx = findBlock(name);
+        if (idx == INVALID_BLOCK) return;
+        blockStates[idx].lastTicks.store(msToTicks(ms), std::memory_order_relaxed);
     }
 
-    void CpuProfiler::beginBlock(const std::string& name) {
-        assert(namedProfilingBlocks.find(name) != namedProfilingBlocks.end()
-            && "Tried to begin a block not specified when building the CpuProfiler.");
-        ProfilingBlock& block = namedProfilingBlocks[name];
-        recordedTimestamps[name].start = std::chrono::high_resolution_clock::now();
+    void CpuProfiler::beginBlock(ProfilingBlockId id) {
+        uint32_t idx = findBlock(id);
+        assert(idx != INVALID_BLOCK && "Tried to begin a block not specified when building the CpuProfiler.");
+        if (idx == INVALID_BLOCK || profilerSlot == UINT32_MAX) return;
+
+        const int64_t now = nowTicks();
+        threadStartTicks(profilerSlot, idx) = now;
+        if (AllocTracker::isEnabled()) threadStartAllocs(profilerSlot, idx) = AllocTracker::threadCounters();
+
+        if (TRACE_CAPTURE.isCapturing()) TRACE_CAPTURE.record(TraceEventPhase::BEGIN, blockNames[idx].c_str(), now);
     }
 
-    void CpuProfiler::endBlock(const std::string& name) {
-        assert(namedProfilingBlocks.find(name) != namedProfilingBlocks.end()
-            && "Tried to end a block not specified when building the CpuProfiler.");
+    void CpuProfiler::endBlock(ProfilingBlockId id) {
+        const int64_t now = nowTicks();
+
+        uint32_t idx = findBlock(id);
+        assert(idx != INVALID_BLOCK && "Tried to end a block not specified when building the CpuProfiler.");
+        if (idx == INVALID_BLOCK || profilerSlot == UINT32_MAX) return;
+
+        recordSample(idx, now - threadStartTicks(profilerSlot, idx), now);
+
+        if (AllocTracker::isEnabled()) {
+            const AllocCounters  current = AllocTracker::threadCounters();
+            const AllocCounters& start   = threadStartAllocs(profilerSlot, idx);
+            blockStates[idx].allocations.fetch_add(current.allocations - start.allocations, std::memory_order_relaxed);
+            blockStates[idx].allocatedBytes.fetch_add(current.bytes - start.bytes, std::memory_order_relaxed);
+        }
+
+        if (TRACE_CAPTURE.isCapturing()) TRACE_CAPTURE.record(TraceEventPhase::END, blockNames[idx].c_str(), now);
+    }
+
+    void CpuProfiler::recordSample(uint32_t blockIdx, int64_t durationTicks, int64_t now) {
+        BlockState& state = blockStates[blockIdx];
+        state.lastTicks.store(durationTicks, std::memory_order_relaxed);
+        state.count.fetch_add(1, std::memory_order_relaxed);
+        const int64_t totalTicks = state.totalTicks.fetch_add(durationTicks, std::memory_order_relaxed) + durationTicks;
+
+        PendingSamples& pending = threadPendingSamples();
+        pending.samples[pending.count++] = PendingSample{
+            durationTicks, totalTicks, now, generation, static_cast<uint16_t>(profilerSlot), static_cast<uint16_t>(blockIdx)
+        };
+
+        if (pending.count == PendingSamples::CAPACITY || pending.seenFrame != frameEpoch.load(std::memory_order_relaxed)) {
+            flushPendingSamples();
+        }
+    }
+
+    // Samples of one block that share a window max bucket & histogram window, folded so they pay for those once.
+    struct CpuProfiler::DeferredRun {
+        CpuProfiler*      profiler        = nullptr;
+        uint32_t          blockIdx        = 0;
+        int64_t           startTicks      = 0;
+        int64_t           endTicks        = 0;
+        int64_t           maxDuration     = 0;
+        int64_t           maxTotal        = 0;
+        LatencyHistogram* windowHistogram = nullptr;
+        uint32_t          bucket          = 0; // Consecutive samples in the same histogram bucket share one increment
+        uint32_t          bucketCount     = 0;
+
+        bool accepts(const CpuProfiler* p, uint32_t block, int64_t now) const {
+            return profiler == p && blockIdx == block && now >= startTicks && now < endTicks;
+        }
+
+        void open(CpuProfiler* p, uint32_t block, int64_t now) {
+            const int64_t windowTicks = p->histogramWindowTicks.load(std::memory_order_relaxed);
+
+            profiler        = p;
+            blockIdx        = block;
+            startTicks      = now;
+            endTicks        = std::min((now / p->bucketTicks + 1) * p->bucketTicks, (now / windowTicks + 1) * windowTicks);
+            maxDuration     = 0;
+            maxTotal        = 0;
+            windowHistogram = &p->blockStates[block].windowHistogram.current(now, windowTicks);
+            bucketCount     = 0;
+        }
+
+        void add(const PendingSample& sample) {
+            maxDuration = std::max(maxDuration, sample.durationTicks);
+            maxTotal    = std::max(maxTotal, sample.totalTicks);
+
+            const uint32_t sampleBucket = LatencyHistogram::bucketIndex(ticksToNs(sample.durationTicks));
+            if (bucketCount != 0 && sampleBucket != bucket) flushBucket();
+            bucket = sampleBucket;
+            bucketCount++;
+        }
 
-        ProfilingBlock& block = namedProfilingBlocks[name];
+        void flushBucket() {
+            windowHistogram->recordBucket(bucket, bucketCount);
+            profiler->blockStates[blockIdx].sessionHistogram.recordBucket(bucket, bucketCount);
+            bucketCount = 0;
+        }
 
-        auto now = std::chrono::high_resolution_clock::now();
-        auto& ts = recordedTimestamps[name];
+        void close() {
+            if (!profiler) return;
+            if (bucketCount != 0) flushBucket();
 
-        ts.end = now;
+            BlockState& state = profiler->blockStates[blockIdx];
+            state.windowMax.record(maxDuration, startTicks, profiler->bucketTicks);
+            state.windowMaxTotal.record(maxTotal, startTicks, profiler->bucketTicks);
+            profiler = nullptr;
+        }
+    };
 
-        double durationMs = std::chrono::duration<double, std::milli>(ts.end - ts.start).count();
-        block.ms = durationMs;
+    void CpuProfiler::flushPendingSamples() {
+        PendingSamples& pending = threadPendingSamples();
+        pending.seenFrame = frameEpoch.load(std::memory_order_relaxed);
+
+        // A few runs open at once, so nested blocks (which interleave in the buffer) still fold together.
+        std::array<DeferredRun, 4> runs{};
+        size_t nextRun = 0;
+
+        for (size_t i = 0; i < pending.count; i++) {
+            const PendingSample& sample = pending.samples[i];
+
+            CpuProfiler* profiler = liveProfilers[sample.profilerSlot].load(std::memory_order_acquire);
+            if (!profiler || profiler->generation != sample.generation) continue;
+
+            DeferredRun* run = nullptr;
+            for (DeferredRun& candidate : runs) {
+                if (candidate.accepts(profiler, sample.blockIdx, sample.nowTicks)) {
+                    run = &candidate;
+                    break;
+                }
+            }
+            if (!run) {
+                run = &runs[nextRun];
+                nextRun = (nextRun + 1) % runs.size();
+                run->close();
+                run->open(profiler, sample.blockIdx, sample.nowTicks);
+            }
+
+            run->add(sample);
+        }
 
-        // accumulate
-        block.totalMs += durationMs;
-        block.count++;
+        for (DeferredRun& run : runs) run.close();
+        pending.count = 0;
+    }
 
-        double nowSec = std::chrono::duration<double>(now.time_since_epoch()).count();
+    void CpuProfiler::beginFrame() {
+        frameEpoch.fetch_add(1, std::memory_order_relaxed);
+        flushPendingSamples();
+    }
 
-        // ------------------ duration (existing) ------------------
-        auto& dq = namedSampleHistories[name];
+    void CpuProfiler::setHistogramWindow(double seconds) {
+        histogramWindowSeconds = std::max(seconds, 0.1);
+        histogramWindowTicks.store(std::max<int64_t>(1, msToTicks(histogramWindowSeconds * 1000.0)), std::memory_order_relaxed);
+    }
 
-        // 1. Remove samples from the back that are <= current duration
-        while (!dq.empty() && dq.back().durationMs <= durationMs) {
-            dq.pop_back();
+    void CpuProfiler::resetHistograms() {
+        for (size_t i = 0; i < blockNames.size(); i++) {
+            blockStates[i].windowHistogram.reset();
+            blockStates[i].sessionHistogram.reset();
         }
+    }
+
+    CpuProfiler::NamedProfilingBlockMap CpuProfiler::getNamedBlocks() const {
+        const int64_t now = nowTicks();
+
+        NamedProfilingBlockMap blocks;
+        for (uint32_t i = 0; i < blockNames.size(); i++) {
+            const BlockState& state = blockStates[i];
+
+            ProfilingBlock block{ i };
+            block.ms         = ticksToMs(state.lastTicks.load(std::memory_order_relaxed));
+            block.maxMs      = ticksToMs(state.windowMax.get(now, bucketTicks));
+            block.totalMs    = ticksToMs(state.totalTicks.load(std::memory_order_relaxed));
+            block.maxTotalMs = ticksToMs(state.windowMaxTotal.get(now, bucketTicks));
+            block.count      = static_cast<size_t>(state.count.load(std::memory_order_relaxed));
+            block.allocations    = state.allocations.load(std::memory_order_relaxed);
+            block.allocatedBytes = state.allocatedBytes.load(std::memory_order_relaxed);
 
-        // 2. Add new sample
-        dq.push_back({ durationMs, nowSec });
+            LatencyHistogram::Snapshot windowSnapshot{};
+            state.windowHistogram.snapshot(windowSnapshot, now, histogramWindowTicks.load(std::memory_order_relaxed));
+            block.windowPercentiles = getPercentiles(windowSnapshot);
 
-        // 3. Remove samples outside window
-        while (!dq.empty() && nowSec - dq.front().timestampSec > windowSize) {
-            dq.pop_front();
+            LatencyHistogram::Snapshot sessionSnapshot{};
+            sessionSnapshot.merge(state.sessionHistogram);
+            block.sessionPercentiles = getPercentiles(sessionSnapshot);
+
+            blocks.emplace(blockNames[i], block);
         }
 
-        // 4. Max duration in window
-        block.maxMs = dq.front().durationMs;
+        return blocks;
+    }
+
+    CpuProfiler::Overhead CpuProfiler::measureOverhead(size_t iterations) {
+        Overhead overhead{};
+        if (iterations == 0) return overhead;
+
+        // A profiler of our own, so the samples don't land in (or need scrubbing from) a live one.
+        CpuProfiler profiler{ { "Overhead" }, 1.0 };
+        if (profiler.profilerSlot == UINT32_MAX) return overhead;
+
+        constexpr ProfilingBlockId id = KBF_PROFILING_BLOCK_ID("Overhead");
 
+        const int64_t start = nowTicks();
+        for (size_t i = 0; i < iterations; i++) {
+            profiler.beginBlock(id);
+            profiler.endBlock(id);
+        }
+        flushPendingSamples();
+        const int64_t end = nowTicks();
 
-        // ------------------ totalMs ------------------------
-        auto& tq = namedTotalSampleHistories[name];
+        overhead.enabledNs = ticksToMs(end - start) * 1e6 / static_cast<double>(iterations);
 
-        // 1. Remove samples from the back that are <= current total
-        while (!tq.empty() && tq.back().durationMs <= block.totalMs) {
-            tq.pop_back();
+        // Disabled path, mirroring what the macros expand to. Local flag so the measurement doesn't depend on the setting.
+        std::atomic<bool> disabled{ false };
+        const int64_t disabledStart = nowTicks();
+        for (size_t i = 0; i < iterations; i++) {
+            if (disabled.load(std::memory_order_relaxed)) profiler.beginBlock(id);
+            if (disabled.load(std::memory_order_relaxed)) profiler.endBlock(id);
         }
+        const int64_t disabledEnd = nowTicks();
+
+        overhead.disabledNs = ticksToMs(disabledEnd - disabledStart) * 1e6 / static_cast<double>(iterations);
 
-        // 2. Add new sample
-        tq.push_back({ block.totalMs, nowSec });
+        return overhead;
+    }
 
-        // 3. Remove samples outside window
-        while (!tq.empty() && nowSec - tq.front().timestampSec > windowSize) {
-            tq.pop_front();
+    bool CpuProfiler::writeHistogramsJson(const std::filesystem::path& path) const {
+        const int64_t now = nowTicks();
+
+        rapidjson::StringBuffer s;
+        rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(s);
+
+        const auto writePercentiles = [&](const char* key, const LatencyHistogram::Snapshot& snapshot) {
+            ProfilingPercentiles percentiles = getPercentiles(snapshot);
+
+            writer.Key(key);
+            writer.StartObject();
+            writer.Key("samples");
+            writer.Uint64(percentiles.samples);
+            writer.Key("p50Ms");
+            writer.Double(percentiles.p50Ms);
+            writer.Key("p90Ms");
+            writer.Double(percentiles.p90Ms);
+            writer.Key("p99Ms");
+            writer.Double(percentiles.p99Ms);
+            writer.Key("p999Ms");
+            writer.Double(percentiles.p999Ms);
+
+            // Only non-empty buckets, as [lower bound ns, count] pairs
+            writer.Key("buckets");
+            writer.StartArray();
+            for (uint32_t i = 0; i < LatencyHistogram::BUCKET_COUNT; i++) {
+                if (snapshot.counts[i] == 0) continue;
+                writer.StartArray();
+                writer.Uint64(LatencyHistogram::bucketLowerBound(i));
+                writer.Uint64(snapshot.counts[i]);
+                writer.EndArray();
+            }
+            writer.EndArray();
+            writer.EndObject();
+        };
+
+        writer.StartObject();
+        writer.Key("windowSeconds");
+        writer.Double(histogramWindowSeconds);
+        writer.Key("blocks");
+        writer.StartObject();
+        for (uint32_t i = 0; i < blockNames.size(); i++) {
+            const BlockState& state = blockStates[i];
+
+            LatencyHistogram::Snapshot windowSnapshot{};
+            state.windowHistogram.snapshot(windowSnapshot, now, histogramWindowTicks.load(std::memory_order_relaxed));
+            LatencyHistogram::Snapshot sessionSnapshot{};
+            sessionSnapshot.merge(state.sessionHistogram);
+
+            writer.Key(blockNames[i].c_str());
+            writer.StartObject();
+            writePercentiles("window", windowSnapshot);
+            writePercentiles("session", sessionSnapshot);
+            writer.EndObject();
         }
+        writer.EndObject();
+        writer.EndObject();
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) return false;
+
+        file.write(s.GetString(), s.GetSize());
+        file.close();
 
-        // 4. Max total in window
-        block.maxTotalMs = tq.front().durationMs;
+        return true;
     }
 
 }
\ No newline at end of file
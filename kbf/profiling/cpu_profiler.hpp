@@ -1,30 +1,30 @@
 #pragma once
 
 #include <kbf/profiling/profiling_block.hpp>
-#include <kbf/profiling/profiling_block_timestamp.hpp>
-#include <kbf/profiling/profiling_sample.hpp>
+#include <kbf/profiling/profiling_block_id.hpp>
+#include <kbf/profiling/sliding_window_max.hpp>
+#include <kbf/profiling/latency_histogram.hpp>
 
 #include <memory>
 #include <map>
-#include <deque>
+#include <vector>
+#include <string>
+#include <atomic>
+#include <filesystem>
 
-#ifdef KBF_DEBUG_BUILD
-    #define BEGIN_CPU_PROFILING_BLOCK(profiler, blockName)  \
-       if ((profiler)) (profiler)->beginBlock((blockName));
+// Profiling is compiled into every build, but only records while CpuProfiler::isEnabled() - always on for debug builds,
+//  and toggled by the enableProfiling setting for release builds. When off, each block costs one relaxed load & a predicted branch.
+#define BEGIN_CPU_PROFILING_BLOCK(profiler, blockName)  \
+   if (::kbf::CpuProfiler::isEnabled() && (profiler)) (profiler)->beginBlock(KBF_PROFILING_BLOCK_ID(blockName));
 
-    #define END_CPU_PROFILING_BLOCK(profiler, blockName)  \
-       if ((profiler)) (profiler)->endBlock((blockName));
+#define END_CPU_PROFILING_BLOCK(profiler, blockName)  \
+   if (::kbf::CpuProfiler::isEnabled() && (profiler)) (profiler)->endBlock(KBF_PROFILING_BLOCK_ID(blockName));
 
-    #define PROFILED_FLOW_OP(profiler, blockName, op)           \
-        { 					                                    \
-            END_CPU_PROFILING_BLOCK((profiler), (blockName))    \
-            op;                                                 \
-        }
-#else
-    #define BEGIN_CPU_PROFILING_BLOCK(profiler, blockName)
-    #define END_CPU_PROFILING_BLOCK(profiler, blockName)
-    #define PROFILED_FLOW_OP(profiler, blockName, op) op
-#endif
+#define PROFILED_FLOW_OP(profiler, blockName, op)           \
+    { 					                                    \
+        END_CPU_PROFILING_BLOCK((profiler), (blockName))    \
+        op;                                                 \
+    }
 
 namespace kbf {
 
@@ -34,7 +34,23 @@ namespace kbf {
         static std::unique_ptr<CpuProfiler> GlobalTimelineProfiler;
         static std::unique_ptr<CpuProfiler> GlobalMultiScopeProfiler;
         typedef std::map<std::string, ProfilingBlock> NamedProfilingBlockMap;
-        typedef std::map<std::string, std::deque<ProfilingSample>> NamedSampleHistoryMap;
+
+#ifdef KBF_DEBUG_BUILD
+        static constexpr bool ALWAYS_ENABLED = true;
+#else
+        static constexpr bool ALWAYS_ENABLED = false;
+#endif
+
+        // Only flip this between frames - a block begun while disabled but ended while enabled records garbage.
+        static bool isEnabled() { return enabled.load(std::memory_order_relaxed); }
+        static void setEnabled(bool enable) { enabled.store(ALWAYS_ENABLED || enable, std::memory_order_relaxed); }
+
+        // Toggled from the debug tab, checked by the situation watcher callbacks registered on init.
+        static inline std::atomic<bool> resetHistogramsOnSituationChange{ false };
+
+        // Upper bounds for the per-thread start timestamp table.
+        static constexpr size_t MAX_BLOCKS    = 128;
+        static constexpr size_t MAX_PROFILERS = 8;
 
         class Builder {
         public:
@@ -46,15 +62,17 @@ namespace kbf {
 
         private:
             double windowSize = 5.0;
-            uint32_t currentBlockIdx = 0u;
-            NamedProfilingBlockMap profilingBlocks;
+            std::vector<std::string> blockNames;
         };
 
         CpuProfiler(
-            NamedProfilingBlockMap profilingBlocks,
+            std::vector<std::string> blockNames,
             double windowSize
         );
-        ~CpuProfiler() = default;
+        ~CpuProfiler();
+
+        CpuProfiler(const CpuProfiler&) = delete;
+        CpuProfiler& operator=(const CpuProfiler&) = delete;
 
         double getMs(const std::string& name) const;
         double getAccumulatedMs(const std::string& name) const;
@@ -63,19 +81,87 @@ namespace kbf {
         void resetAccumulatedAll();
 
         void setBlockMillis(const std::string& name, double ms);
-        void beginBlock(const std::string& name);
-        void endBlock(const std::string& name);
 
-        const NamedProfilingBlockMap& getNamedBlocks() const {
-            return namedProfilingBlocks;
-        }
+        // Folds every thread's deferred window max / histogram samples in - see PendingSamples in the .cpp. Call once per
+        //  frame from the update thread; other threads catch up on their next endBlock().
+        static void beginFrame();
+
+        // Hot path - ids are resolved at compile time by the profiling macros.
+        void beginBlock(ProfilingBlockId id);
+        void endBlock(ProfilingBlockId id);
+        void beginBlock(const std::string& name) { beginBlock(profilingBlockId(name)); }
+        void endBlock(const std::string& name)   { endBlock(profilingBlockId(name)); }
+
+        // Snapshot of all blocks, keyed by name. Allocates, so keep it to UI / reporting code.
+        NamedProfilingBlockMap getNamedBlocks() const;
+
+        // Per-block latency histograms - a sliding window (in seconds) & a whole-session histogram.
+        // These & the window maxes are fed in batches, so they can trail the live counters by up to a frame.
+        void setHistogramWindow(double seconds);
+        double getHistogramWindow() const { return histogramWindowSeconds; }
+        void resetHistograms();
+        bool writeHistogramsJson(const std::filesystem::path& path) const;
+
+        struct Overhead {
+            double enabledNs  = 0.0; // Average cost of one beginBlock + endBlock pair
+            double disabledNs = 0.0; // As above, but for a BEGIN / END macro pair while profiling is disabled
+        };
+
+        // Times block pairs on a throwaway profiler. Takes a few ms, so it's run on request (the debug tab,
+        //  bench_cpu_profiler) rather than whenever a profiler is built - that was on every DLL load.
+        static Overhead measureOverhead(size_t iterations = 10000);
 
     private:
-        NamedProfilingBlockMap namedProfilingBlocks;
-        NamedSampleHistoryMap namedSampleHistories;
-        NamedSampleHistoryMap namedTotalSampleHistories;
-        std::map<std::string, ProfilingBlockTimestamp> recordedTimestamps;
-        double windowSize = 1.0f;
+        struct alignas(64) BlockState {
+            std::atomic<int64_t>  lastTicks{ 0 };
+            std::atomic<int64_t>  totalTicks{ 0 };
+            std::atomic<uint64_t> count{ 0 };
+            std::atomic<uint64_t> allocations{ 0 };
+            std::atomic<uint64_t> allocatedBytes{ 0 };
+            SlidingWindowMax windowMax;
+            SlidingWindowMax windowMaxTotal;
+            WindowedLatencyHistogram windowHistogram;
+            LatencyHistogram sessionHistogram;
+        };
+
+        struct LookupEntry {
+            ProfilingBlockId id  = 0;
+            uint32_t         idx = 0;
+        };
+
+        // A finished block whose window max & histogram updates are still queued on the thread that ended it.
+        struct PendingSample {
+            int64_t  durationTicks;
+            int64_t  totalTicks;
+            int64_t  nowTicks;
+            uint32_t generation;
+            uint16_t profilerSlot;
+            uint16_t blockIdx;
+        };
+
+        struct PendingSamples;
+        struct DeferredRun;
+        static PendingSamples& threadPendingSamples();
+
+        static constexpr uint32_t INVALID_BLOCK = UINT32_MAX;
+
+        uint32_t findBlock(ProfilingBlockId id) const;
+        uint32_t findBlock(const std::string& name) const { return findBlock(profilingBlockId(name)); }
+        void recordSample(uint32_t blockIdx, int64_t durationTicks, int64_t nowTicks);
+        static void flushPendingSamples();
+
+        std::vector<std::string> blockNames;
+        std::unique_ptr<BlockState[]> blockStates;
+        std::vector<LookupEntry> lookupTable;
+        size_t lookupMask = 0;
+
+        int64_t bucketTicks = 1;
+        std::atomic<int64_t> histogramWindowTicks{ 1 };
+        double histogramWindowSeconds = 10.0;
+        uint32_t profilerSlot = INVALID_BLOCK;
+        uint32_t generation   = 0;
+
+        static inline std::atomic<bool> enabled{ ALWAYS_ENABLED };
     };
 
 }
\ No newline at end of file
@@ -0,0 +1,123 @@
+#include <kbf/profiling/engine_call_stats.hpp>
+
+#include <kbf/profiling/profiling_block_id.hpp>
+#include <kbf/util/hash/hash_combine.hpp>
+
+#include <chrono>
+#include <cstring>
+
+namespace kbf {
+
+    namespace {
+
+        inline uint64_t callKey(reframework::API::TypeDefinition* type, std::string_view methodName) {
+            size_t key = static_cast<size_t>(profilingBlockId(methodName));
+            hashCombine(key, reinterpret_cast<size_t>(type));
+            return key == 0 ? 1 : static_cast<uint64_t>(key);
+        }
+
+        inline double ticksToMs(int64_t ticks) {
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::duration(ticks)).count();
+        }
+
+    }
+
+    int64_t EngineCallStats::nowTicks() {
+        return std::chrono::steady_clock::now().time_since_epoch().count();
+    }
+
+    EngineCallStats::Entry* EngineCallStats::findOrInsert(reframework::API::TypeDefinition* type, std::string_view methodName) {
+        const uint64_t key = callKey(type, methodName);
+
+        size_t slot = static_cast<size_t>(key) & (CAPACITY - 1);
+        for (size_t probe = 0; probe < CAPACITY; probe++) {
+            Entry& entry = entries[slot];
+
+            uint64_t seenKey = entry.key.load(std::memory_order_acquire);
+            if (seenKey == key) return entry.ready.load(std::memory_order_acquire) ? &entry : nullptr;
+
+            if (seenKey == 0 && entry.key.compare_exchange_strong(seenKey, key, std::memory_order_acq_rel)) {
+                entry.type = type;
+                const size_t nameLength = std::min(methodName.size(), MAX_METHOD_NAME - 1);
+                std::memcpy(entry.methodName, methodName.data(), nameLength);
+                entry.methodName[nameLength] = '\0';
+
+                // Readers may briefly see the new count before the slot index lands, they skip entries that aren't ready.
+                usedSlots[usedCount.fetch_add(1, std::memory_order_acq_rel)] = static_cast<uint32_t>(slot);
+                entry.ready.store(true, std::memory_order_release);
+                return &entry;
+            }
+            // Lost the race to a different key, or the slot was already taken - keep probing.
+            if (entry.key.load(std::memory_order_acquire) == key) return entry.ready.load(std::memory_order_acquire) ? &entry : nullptr;
+
+            slot = (slot + 1) & (CAPACITY - 1);
+        }
+
+        return nullptr;
+    }
+
+    void EngineCallStats::record(reframework::API::TypeDefinition* type, std::string_view methodName, int64_t ticks, bool failed) {
+        Entry* entry = findOrInsert(type, methodName);
+        if (entry == nullptr) {
+            droppedCalls.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        entry->calls.fetch_add(1, std::memory_order_relaxed);
+        entry->callsThisFrame.fetch_add(1, std::memory_order_relaxed);
+        entry->totalTicks.fetch_add(ticks, std::memory_order_relaxed);
+        if (failed) entry->failures.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void EngineCallStats::beginFrame() {
+        const size_t count = getTrackedCount();
+        for (size_t i = 0; i < count; i++) {
+            Entry& entry = entries[usedSlots[i]];
+
+            const uint64_t frameCalls = entry.callsThisFrame.exchange(0, std::memory_order_relaxed);
+            entry.callsLastFrame.store(frameCalls, std::memory_order_relaxed);
+            if (frameCalls > entry.maxCallsPerFrame.load(std::memory_order_relaxed)) {
+                entry.maxCallsPerFrame.store(frameCalls, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::vector<EngineCallStat> EngineCallStats::snapshot() const {
+        const size_t count = getTrackedCount();
+
+        std::vector<EngineCallStat> stats;
+        stats.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            const Entry& entry = entries[usedSlots[i]];
+            if (!entry.ready.load(std::memory_order_acquire)) continue;
+
+            EngineCallStat stat{};
+            stat.typeName         = entry.type ? entry.type->get_full_name() : "<Unknown>";
+            stat.methodName       = entry.methodName;
+            stat.calls            = entry.calls.load(std::memory_order_relaxed);
+            stat.callsLastFrame   = entry.callsLastFrame.load(std::memory_order_relaxed);
+            stat.maxCallsPerFrame = entry.maxCallsPerFrame.load(std::memory_order_relaxed);
+            stat.failures         = entry.failures.load(std::memory_order_relaxed);
+            stat.totalMs          = ticksToMs(entry.totalTicks.load(std::memory_order_relaxed));
+            stats.push_back(std::move(stat));
+        }
+
+        return stats;
+    }
+
+    void EngineCallStats::reset() {
+        // Keep the (type, method) slots, just zero the counters - entries are never removed so recording stays lock-free.
+        const size_t count = getTrackedCount();
+        for (size_t i = 0; i < count; i++) {
+            Entry& entry = entries[usedSlots[i]];
+            entry.calls.store(0, std::memory_order_relaxed);
+            entry.callsThisFrame.store(0, std::memory_order_relaxed);
+            entry.callsLastFrame.store(0, std::memory_order_relaxed);
+            entry.maxCallsPerFrame.store(0, std::memory_order_relaxed);
+            entry.failures.store(0, std::memory_order_relaxed);
+            entry.totalTicks.store(0, std::memory_order_relaxed);
+        }
+        droppedCalls.store(0, std::memory_order_relaxed);
+    }
+
+}
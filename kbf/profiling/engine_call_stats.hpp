@@ -0,0 +1,90 @@
+#pragma once
+
+#include <reframework/API.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace kbf {
+
+    struct EngineCallStat {
+        std::string typeName;
+        std::string methodName;
+        uint64_t calls            = 0; // Since last reset
+        uint64_t callsLastFrame   = 0;
+        uint64_t maxCallsPerFrame = 0;
+        uint64_t failures         = 0; // Exceptions & unresolved types / methods
+        double   totalMs          = 0.0;
+    };
+
+    // Opt-in call counting & timing for reflective engine calls (REInvoke & co.), keyed by (type, method).
+    // Fixed-capacity open-addressed table, so recording never allocates - call sites past capacity are counted as dropped.
+    class EngineCallStats {
+    public:
+        static constexpr size_t CAPACITY        = 1024;
+        static constexpr size_t MAX_METHOD_NAME = 64;
+
+        bool isEnabled() const { return enabled.load(std::memory_order_relaxed); }
+        void setEnabled(bool enable) { enabled.store(enable, std::memory_order_relaxed); }
+
+        // Called once per game frame, rolls the per-frame counters over.
+        void beginFrame();
+
+        void record(reframework::API::TypeDefinition* type, std::string_view methodName, int64_t ticks, bool failed);
+
+        // Allocates & resolves type names, so keep it to UI / reporting code.
+        std::vector<EngineCallStat> snapshot() const;
+        void reset();
+
+        size_t getTrackedCount() const { return std::min<size_t>(usedCount.load(std::memory_order_acquire), CAPACITY); }
+        size_t getDroppedCount() const { return droppedCalls.load(std::memory_order_relaxed); }
+
+        static int64_t nowTicks();
+
+    private:
+        struct Entry {
+            std::atomic<uint64_t> key{ 0 };
+            std::atomic<bool>     ready{ false };
+            reframework::API::TypeDefinition* type = nullptr;
+            char methodName[MAX_METHOD_NAME]{};
+
+            std::atomic<uint64_t> calls{ 0 };
+            std::atomic<uint64_t> callsThisFrame{ 0 };
+            std::atomic<uint64_t> callsLastFrame{ 0 };
+            std::atomic<uint64_t> maxCallsPerFrame{ 0 };
+            std::atomic<uint64_t> failures{ 0 };
+            std::atomic<int64_t>  totalTicks{ 0 };
+        };
+
+        Entry* findOrInsert(reframework::API::TypeDefinition* type, std::string_view methodName);
+
+        std::atomic<bool> enabled{ false };
+        std::array<Entry, CAPACITY> entries{};
+        std::array<uint32_t, CAPACITY> usedSlots{};
+        std::atomic<size_t> usedCount{ 0 };
+        std::atomic<size_t> droppedCalls{ 0 };
+    };
+
+    inline EngineCallStats ENGINE_CALL_STATS{};
+
+    // Times a single engine call when stats are enabled. Costs one relaxed load when they aren't.
+    class EngineCallTimer {
+    public:
+        EngineCallTimer() : start{ ENGINE_CALL_STATS.isEnabled() ? EngineCallStats::nowTicks() : 0 } {}
+
+        bool active() const { return start != 0; }
+
+        void finish(reframework::API::TypeDefinition* type, std::string_view methodName, bool failed) const {
+            if (start != 0) ENGINE_CALL_STATS.record(type, methodName, EngineCallStats::nowTicks() - start, failed);
+        }
+
+    private:
+        int64_t start;
+    };
+
+}
@@ -0,0 +1,78 @@
+#include <kbf/profiling/frame_budget_controller.hpp>
+
+#include <algorithm>
+
+namespace kbf {
+
+    namespace {
+
+        template <typename T>
+        T lerpLimit(T minValue, T maxValue, double t) {
+            minValue = std::min(minValue, maxValue);
+            return static_cast<T>(static_cast<double>(minValue) + (static_cast<double>(maxValue) - static_cast<double>(minValue)) * t);
+        }
+
+    }
+
+    void FrameBudgetController::update(const KBFSettings& settings, double frameCostUs) {
+        lastCostUs.store(frameCostUs, std::memory_order_relaxed);
+
+        double smoothed = smoothedCostUs.load(std::memory_order_relaxed);
+        smoothed += (frameCostUs - smoothed) * COST_SMOOTHING;
+        smoothedCostUs.store(smoothed, std::memory_order_relaxed);
+
+        if (!settings.enableAdaptiveBudget) {
+            scale.store(1.0, std::memory_order_relaxed);
+            cooldown = 0;
+            return;
+        }
+
+        if (cooldown > 0) {
+            cooldown--;
+            return;
+        }
+
+        const double budget  = std::max<double>(settings.adaptiveBudgetUs, 1.0);
+        double       current = scale.load(std::memory_order_relaxed);
+
+        if (smoothed > budget) {
+            current *= DECREASE_FACTOR;
+            cooldown = DECREASE_COOLDOWN;
+        }
+        else if (smoothed < budget * INCREASE_THRESHOLD) {
+            current += INCREASE_STEP;
+        }
+
+        scale.store(std::clamp(current, 0.0, 1.0), std::memory_order_relaxed);
+    }
+
+    void FrameBudgetController::reset() {
+        scale.store(1.0, std::memory_order_relaxed);
+        smoothedCostUs.store(0.0, std::memory_order_relaxed);
+        lastCostUs.store(0.0, std::memory_order_relaxed);
+        cooldown = 0;
+    }
+
+    FrameBudgetLimits FrameBudgetController::getLimits(const KBFSettings& settings) const {
+        FrameBudgetLimits limits{
+            settings.maxConcurrentApplications,
+            settings.maxBoneFetchesPerFrame,
+            settings.applicationRange
+        };
+        if (!settings.enableAdaptiveBudget) return limits;
+
+        const double t = getScale();
+
+        const int   maxApplications = limits.maxConcurrentApplications > 0 ? limits.maxConcurrentApplications : UNLIMITED_CONCURRENT_APPLICATIONS;
+        const int   maxBoneFetches  = limits.maxBoneFetchesPerFrame > 0    ? limits.maxBoneFetchesPerFrame    : UNLIMITED_BONE_FETCHES_PER_FRAME;
+        const float maxRange        = limits.applicationRange > 0.0f       ? limits.applicationRange          : UNLIMITED_APPLICATION_RANGE;
+
+        // Minimums are floored at 1 / a small range - 0 would mean "unlimited" to the trackers.
+        limits.maxConcurrentApplications = lerpLimit(std::max(settings.adaptiveMinConcurrentApplications, 1), maxApplications, t);
+        limits.maxBoneFetchesPerFrame    = lerpLimit(std::max(settings.adaptiveMinBoneFetchesPerFrame, 1), maxBoneFetches, t);
+        limits.applicationRange          = lerpLimit(std::max(settings.adaptiveMinApplicationRange, 1.0f), maxRange, t);
+
+        return limits;
+    }
+
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <kbf/data/formats/kbf_settings.hpp>
+
+#include <atomic>
+
+namespace kbf {
+
+    struct FrameBudgetLimits {
+        int   maxConcurrentApplications = 0;
+        int   maxBoneFetchesPerFrame    = 0;
+        float applicationRange          = 0.0f;
+    };
+
+    // Scales the application limits between the user's minimums and their configured values to hold KBF's own per-frame
+    //  cost under a target budget. AIMD on a single [0, 1] scale: back off multiplicatively when over budget, creep back
+    //  up additively when comfortably under. Deterministic - all state advances only through update().
+    class FrameBudgetController {
+    public:
+        // Ceilings used when the corresponding setting is 0 (i.e. unlimited) - matches the settings slider ranges.
+        static constexpr int   UNLIMITED_CONCURRENT_APPLICATIONS = 99;
+        static constexpr int   UNLIMITED_BONE_FETCHES_PER_FRAME  = 100;
+        static constexpr float UNLIMITED_APPLICATION_RANGE       = 300.0f;
+
+        static constexpr double COST_SMOOTHING     = 0.1;  // EMA weight of the newest frame
+        static constexpr double DECREASE_FACTOR    = 0.7;  // Scale multiplier when over budget
+        static constexpr double INCREASE_STEP      = 0.01; // Scale added per frame when under budget
+        static constexpr double INCREASE_THRESHOLD = 0.85; // Fraction of the budget we must be under to increase
+        static constexpr int    DECREASE_COOLDOWN  = 15;   // Frames to wait after a decrease for the EMA to catch up
+
+        // Call once per frame with KBF's total cost for that frame.
+        void update(const KBFSettings& settings, double frameCostUs);
+        void reset();
+
+        // The limits trackers should use this frame - the plain settings when the controller is off.
+        FrameBudgetLimits getLimits(const KBFSettings& settings) const;
+
+        double getScale() const { return scale.load(std::memory_order_relaxed); }
+        double getSmoothedCostUs() const { return smoothedCostUs.load(std::memory_order_relaxed); }
+        double getLastCostUs() const { return lastCostUs.load(std::memory_order_relaxed); }
+
+    private:
+        std::atomic<double> scale{ 1.0 };
+        std::atomic<double> smoothedCostUs{ 0.0 };
+        std::atomic<double> lastCostUs{ 0.0 };
+        int cooldown = 0;
+    };
+
+    inline FrameBudgetController FRAME_BUDGET{};
+
+}
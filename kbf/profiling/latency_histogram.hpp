@@ -0,0 +1,129 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <algorithm>
+
+namespace kbf {
+
+    // HDR-style log-linear latency histogram over nanoseconds.
+    // Each power of two is split into SUB_BUCKETS linear buckets, so any recorded value is within ~12.5% of its bucket.
+    // Fixed size, and recording is a single relaxed atomic increment - safe from any thread, never allocates.
+    class LatencyHistogram {
+    public:
+        static constexpr uint32_t SUB_BUCKET_BITS = 3;
+        static constexpr uint32_t SUB_BUCKETS     = 1u << SUB_BUCKET_BITS;
+        static constexpr uint32_t MAX_EXPONENT    = 40; // ~18 minutes, anything beyond is clamped into the last bucket
+        static constexpr uint32_t BUCKET_COUNT    = (MAX_EXPONENT - SUB_BUCKET_BITS + 2) * SUB_BUCKETS;
+
+        static constexpr uint32_t bucketIndex(uint64_t ns) {
+            if (ns < SUB_BUCKETS) return static_cast<uint32_t>(ns);
+
+            const uint32_t exponent = 63u - static_cast<uint32_t>(std::countl_zero(ns));
+            const uint32_t shift    = exponent - SUB_BUCKET_BITS;
+            const uint32_t sub      = static_cast<uint32_t>(ns >> shift) & (SUB_BUCKETS - 1);
+
+            return std::min((shift + 1) * SUB_BUCKETS + sub, BUCKET_COUNT - 1);
+        }
+
+        static constexpr uint64_t bucketLowerBound(uint32_t idx) {
+            if (idx < SUB_BUCKETS) return idx;
+
+            const uint32_t group = idx / SUB_BUCKETS;
+            const uint32_t sub   = idx % SUB_BUCKETS;
+            return static_cast<uint64_t>(SUB_BUCKETS + sub) << (group - 1);
+        }
+
+        static constexpr uint64_t bucketMidpoint(uint32_t idx) {
+            if (idx + 1 >= BUCKET_COUNT) return bucketLowerBound(idx);
+            return (bucketLowerBound(idx) + bucketLowerBound(idx + 1)) / 2;
+        }
+
+        // Plain (non-atomic) copy used to merge histograms & answer percentile queries off the hot path.
+        struct Snapshot {
+            std::array<uint64_t, BUCKET_COUNT> counts{};
+            uint64_t total = 0;
+
+            void merge(const LatencyHistogram& histogram) {
+                for (uint32_t i = 0; i < BUCKET_COUNT; i++) {
+                    const uint64_t count = histogram.counts[i].load(std::memory_order_relaxed);
+                    counts[i] += count;
+                    total     += count;
+                }
+            }
+
+            // p in [0, 1]
+            uint64_t valueAtPercentileNs(double p) const {
+                if (total == 0) return 0;
+
+                const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(p * static_cast<double>(total) + 0.5));
+                uint64_t seen = 0;
+                for (uint32_t i = 0; i < BUCKET_COUNT; i++) {
+                    seen += counts[i];
+                    if (seen >= rank) return bucketMidpoint(i);
+                }
+                return bucketMidpoint(BUCKET_COUNT - 1);
+            }
+        };
+
+        void record(uint64_t ns) {
+            counts[bucketIndex(ns)].fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // n samples already binned by bucketIndex(), for callers folding a batch of similar values.
+        void recordBucket(uint32_t bucket, uint32_t n) {
+            counts[bucket].fetch_add(n, std::memory_order_relaxed);
+        }
+
+        void reset() {
+            for (auto& count : counts) count.store(0, std::memory_order_relaxed);
+        }
+
+    private:
+        std::array<std::atomic<uint32_t>, BUCKET_COUNT> counts{};
+    };
+
+    // Two alternating histograms, each covering one window of time. Queries merge the live one with the previous one,
+    //  so percentiles always reflect between one and two windows of recent samples.
+    class WindowedLatencyHistogram {
+    public:
+        void record(uint64_t ns, int64_t nowTicks, int64_t windowTicks) {
+            current(nowTicks, windowTicks).record(ns);
+        }
+
+        // The histogram covering nowTicks, recycling it if its window has passed. Lets a batch of samples from the same
+        //  window skip the epoch check per sample.
+        LatencyHistogram& current(int64_t nowTicks, int64_t windowTicks) {
+            const int64_t epoch = nowTicks / windowTicks;
+            const size_t  slot  = static_cast<size_t>(epoch & 1);
+
+            int64_t seenEpoch = epochs[slot].load(std::memory_order_relaxed);
+            if (seenEpoch != epoch && epochs[slot].compare_exchange_strong(seenEpoch, epoch, std::memory_order_relaxed)) {
+                histograms[slot].reset();
+            }
+
+            return histograms[slot];
+        }
+
+        void snapshot(LatencyHistogram::Snapshot& out, int64_t nowTicks, int64_t windowTicks) const {
+            const int64_t epoch = nowTicks / windowTicks;
+            for (size_t i = 0; i < 2; i++) {
+                if (epoch - epochs[i].load(std::memory_order_relaxed) <= 1) out.merge(histograms[i]);
+            }
+        }
+
+        void reset() {
+            for (size_t i = 0; i < 2; i++) {
+                histograms[i].reset();
+                epochs[i].store(0, std::memory_order_relaxed);
+            }
+        }
+
+    private:
+        std::array<LatencyHistogram, 2> histograms{};
+        std::array<std::atomic<int64_t>, 2> epochs{};
+    };
+
+}
\ No newline at end of file
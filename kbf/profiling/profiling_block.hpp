@@ -1,9 +1,18 @@
 #pragma once
 
 #include <string>
+#include <cstdint>
 
 namespace kbf {
 
+    struct ProfilingPercentiles {
+        double   p50Ms   = 0.0;
+        double   p90Ms   = 0.0;
+        double   p99Ms   = 0.0;
+        double   p999Ms  = 0.0;
+        uint64_t samples = 0;
+    };
+
     struct ProfilingBlock {
         uint32_t idx;
         double ms         = 0.0; // Last measured duration
@@ -11,6 +20,11 @@ namespace kbf {
         double totalMs    = 0.0; // Accumulated duration
         double maxTotalMs = 0.0; // Max observed accumulated duration
         size_t count      = 0;   // Number of times block was executed    
+        uint64_t allocations    = 0; // Heap allocations made inside the block since the last accumulator reset (if tracked)
+        uint64_t allocatedBytes = 0;
+
+        ProfilingPercentiles windowPercentiles{};  // Per-call duration percentiles over the histogram window
+        ProfilingPercentiles sessionPercentiles{}; // Per-call duration percentiles since the last histogram reset
     };
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string_view>
+#include <cstdint>
+#include <type_traits>
+
+// Resolve a block name to its id at compile time, so the profiling macros never construct or hash strings at runtime.
+#define KBF_PROFILING_BLOCK_ID(blockName) \
+    (std::integral_constant<::kbf::ProfilingBlockId, ::kbf::profilingBlockId((blockName))>::value)
+
+namespace kbf {
+
+    typedef uint64_t ProfilingBlockId;
+
+    // FNV-1a. 0 is reserved as the empty marker in CpuProfiler's lookup table.
+    constexpr ProfilingBlockId profilingBlockId(std::string_view name) {
+        uint64_t hash = 14695981039346656037ull;
+        for (char c : name) {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 1099511628211ull;
+        }
+        return hash == 0 ? 1 : hash;
+    }
+
+}
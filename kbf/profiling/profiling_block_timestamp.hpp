@@ -1,12 +0,0 @@
-#pragma once
-
-#include <chrono>
-
-namespace kbf {
-
-    struct ProfilingBlockTimestamp {
-        std::chrono::steady_clock::time_point start{};
-        std::chrono::steady_clock::time_point end{};
-    };
-
-}
\ No newline at end of file
@@ -1,10 +0,0 @@
-#pragma once
-
-namespace kbf {
-
-    struct ProfilingSample {
-        double durationMs;
-        double timestampSec;
-    };
-
-}
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace kbf {
+
+    // Fixed-size sliding window maximum. The window is split into BUCKET_COUNT time buckets which each hold their own max,
+    //  so recording is O(1) with no allocation, and reads fold the live buckets together.
+    // Safe to record from multiple threads - a bucket being recycled concurrently may drop a sample, which is fine for display.
+    class SlidingWindowMax {
+    public:
+        static constexpr size_t BUCKET_COUNT = 16;
+
+        void record(int64_t value, int64_t nowTicks, int64_t bucketTicks) {
+            const int64_t epoch = nowTicks / bucketTicks;
+            const size_t  slot  = static_cast<size_t>(epoch % BUCKET_COUNT);
+
+            int64_t seenEpoch = epochs[slot].load(std::memory_order_relaxed);
+            if (seenEpoch != epoch && epochs[slot].compare_exchange_strong(seenEpoch, epoch, std::memory_order_relaxed)) {
+                maxValues[slot].store(value, std::memory_order_relaxed);
+                return;
+            }
+
+            int64_t current = maxValues[slot].load(std::memory_order_relaxed);
+            while (value > current && !maxValues[slot].compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+        }
+
+        int64_t get(int64_t nowTicks, int64_t bucketTicks) const {
+            const int64_t epoch = nowTicks / bucketTicks;
+
+            int64_t maxValue = 0;
+            for (size_t i = 0; i < BUCKET_COUNT; i++) {
+                if (epoch - epochs[i].load(std::memory_order_relaxed) >= static_cast<int64_t>(BUCKET_COUNT)) continue;
+
+                int64_t value = maxValues[i].load(std::memory_order_relaxed);
+                if (value > maxValue) maxValue = value;
+            }
+            return maxValue;
+        }
+
+        void reset() {
+            for (size_t i = 0; i < BUCKET_COUNT; i++) {
+                epochs[i].store(0, std::memory_order_relaxed);
+                maxValues[i].store(0, std::memory_order_relaxed);
+            }
+        }
+
+    private:
+        std::array<std::atomic<int64_t>, BUCKET_COUNT> maxValues{};
+        std::array<std::atomic<int64_t>, BUCKET_COUNT> epochs{};
+    };
+
+}
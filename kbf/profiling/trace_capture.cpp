@@ -0,0 +1,202 @@
+#include <kbf/profiling/trace_capture.hpp>
+
+#include <rapidjson/writer.h>
+#include <rapidjson/stringbuffer.h>
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <thread>
+
+namespace kbf {
+
+    namespace {
+
+        thread_local TraceArgs currentThreadArgs{};
+
+        inline uint32_t currentThreadId() {
+            thread_local const uint32_t id = static_cast<uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+            return id;
+        }
+
+        inline double ticksToUs(int64_t ticks) {
+            return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::duration(ticks)).count();
+        }
+
+    }
+
+    // ---- Capture ----------------------------------------------------------------------------------------------
+    bool TraceCapture::start(uint32_t frameCount) {
+        if (state.load() == State::CAPTURING || frameCount == 0) return false;
+
+        // Wait out any writer that saw the previous capture as live. The fence pairs with the one in record() - see there.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        while (activeWriters.load(std::memory_order_acquire) != 0) std::this_thread::yield();
+
+        if (!events) events = std::make_unique<TraceEvent[]>(capacity);
+
+        writeIdx.store(0);
+        droppedEvents.store(0);
+        framesRequested = frameCount;
+        startFrame      = currentFrame.load();
+        startTicks      = std::chrono::steady_clock::now().time_since_epoch().count();
+
+        state.store(State::CAPTURING, std::memory_order_release);
+        return true;
+    }
+
+    void TraceCapture::cancel() {
+        State expected = State::CAPTURING;
+        state.compare_exchange_strong(expected, State::IDLE);
+    }
+
+    void TraceCapture::beginFrame() {
+        uint32_t frame = currentFrame.fetch_add(1, std::memory_order_relaxed) + 1;
+        if (!isCapturing()) return;
+
+        if (frame - startFrame > framesRequested) {
+            State expected = State::CAPTURING;
+            state.compare_exchange_strong(expected, State::COMPLETE, std::memory_order_release);
+            return;
+        }
+
+        record(TraceEventPhase::INSTANT, "Frame", std::chrono::steady_clock::now().time_since_epoch().count());
+    }
+
+    void TraceCapture::record(TraceEventPhase phase, const char* name, int64_t ticks) {
+        // Store -> load on both sides (here: activeWriters then state, readers: state then activeWriters), which only
+        //  orders with a seq_cst fence on each side. Without them a writer could still see the capture as live while the
+        //  reader sees no writers, and write into events as they're serialized or reset.
+        activeWriters.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (isCapturing()) {
+            size_t idx = writeIdx.fetch_add(1, std::memory_order_relaxed);
+            if (idx < capacity) {
+                TraceEvent& event = events[idx];
+                event.name     = name;
+                event.ticks    = ticks;
+                event.threadId = currentThreadId();
+                event.frame    = currentFrame.load(std::memory_order_relaxed) - startFrame;
+                event.phase    = phase;
+                event.args     = currentThreadArgs;
+            }
+            else {
+                droppedEvents.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        activeWriters.fetch_sub(1, std::memory_order_release);
+    }
+
+    bool TraceCapture::writeChromeTrace(const std::filesystem::path& path) {
+        if (getState() != State::COMPLETE || !events) return false;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        while (activeWriters.load(std::memory_order_acquire) != 0) std::this_thread::yield();
+
+        rapidjson::StringBuffer s;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(s);
+
+        const size_t eventCount = getEventCount();
+
+        writer.StartObject();
+        writer.Key("displayTimeUnit");
+        writer.String("ms");
+        writer.Key("otherData");
+        writer.StartObject();
+        writer.Key("frames");
+        writer.Uint(framesRequested);
+        writer.Key("droppedEvents");
+        writer.Uint64(getDroppedCount());
+        writer.EndObject();
+
+        writer.Key("traceEvents");
+        writer.StartArray();
+        for (size_t i = 0; i < eventCount; i++) {
+            const TraceEvent& event = events[i];
+
+            writer.StartObject();
+            writer.Key("name");
+            writer.String(event.name);
+            writer.Key("cat");
+            writer.String("KBF");
+            writer.Key("ph");
+            switch (event.phase) {
+            case TraceEventPhase::BEGIN:   writer.String("B"); break;
+            case TraceEventPhase::END:     writer.String("E"); break;
+            case TraceEventPhase::INSTANT: writer.String("i"); break;
+            }
+            if (event.phase == TraceEventPhase::INSTANT) {
+                writer.Key("s");
+                writer.String("g");
+            }
+            writer.Key("ts");
+            writer.Double(ticksToUs(event.ticks - startTicks));
+            writer.Key("pid");
+            writer.Uint(1);
+            writer.Key("tid");
+            writer.Uint(event.threadId);
+
+            writer.Key("args");
+            writer.StartObject();
+            writer.Key("frame");
+            writer.Uint(event.frame);
+            if (event.args.playerIndex >= 0) {
+                writer.Key("playerIndex");
+                writer.Int(event.args.playerIndex);
+            }
+            if (event.args.armourSet[0] != '\0') {
+                writer.Key("armourSet");
+                writer.String(event.args.armourSet);
+            }
+            if (event.args.boneCount >= 0) {
+                writer.Key("boneCount");
+                writer.Int(event.args.boneCount);
+            }
+            writer.EndObject();
+
+            writer.EndObject();
+        }
+        writer.EndArray();
+        writer.EndObject();
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) return false;
+
+        file.write(s.GetString(), s.GetSize());
+        file.close();
+
+        state.store(State::IDLE);
+        return true;
+    }
+
+    const TraceArgs& TraceCapture::threadArgs() {
+        return currentThreadArgs;
+    }
+
+    void TraceCapture::setThreadArgs(const TraceArgs& args) {
+        currentThreadArgs = args;
+    }
+
+    // ---- Args Scope -------------------------------------------------------------------------------------------
+    TraceArgsScope::TraceArgsScope(int32_t playerIndex, const char* armourSet, int32_t boneCount) {
+        active = TRACE_CAPTURE.isCapturing();
+        if (!active) return;
+
+        previous = currentThreadArgs;
+
+        if (playerIndex >= 0) currentThreadArgs.playerIndex = playerIndex;
+        if (boneCount >= 0)   currentThreadArgs.boneCount   = boneCount;
+        if (armourSet != nullptr) {
+            const size_t length = std::min(std::strlen(armourSet), sizeof(currentThreadArgs.armourSet) - 1);
+            std::memcpy(currentThreadArgs.armourSet, armourSet, length);
+            currentThreadArgs.armourSet[length] = '\0';
+        }
+    }
+
+    TraceArgsScope::~TraceArgsScope() {
+        if (active) currentThreadArgs = previous;
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+// Attach arguments (player index, armour set, bone count) to every trace event begun on this thread while in scope.
+//  Only does any work while a capture is running.
+#define TRACE_CAPTURE_SCOPED_ARGS(varName, ...) ::kbf::TraceArgsScope varName{ __VA_ARGS__ };
+
+namespace kbf {
+
+    struct TraceArgs {
+        int32_t playerIndex = -1;
+        int32_t boneCount   = -1;
+        char    armourSet[48]{};
+    };
+
+    enum class TraceEventPhase : char {
+        BEGIN   = 'B',
+        END     = 'E',
+        INSTANT = 'i'
+    };
+
+    struct TraceEvent {
+        const char*     name;
+        int64_t         ticks;
+        uint32_t        threadId;
+        uint32_t        frame;
+        TraceEventPhase phase;
+        TraceArgs       args;
+    };
+
+    // Records profiling block begin/end events for a fixed number of frames into a bounded buffer,
+    //  which can then be written out as a Chrome Trace Event file (loadable in Perfetto / chrome://tracing).
+    class TraceCapture {
+    public:
+        TraceCapture(size_t capacity) : capacity{ capacity } {}
+
+        enum class State : uint8_t {
+            IDLE,
+            CAPTURING,
+            COMPLETE
+        };
+
+        // Called from the UI. Allocates the event buffer up front so recording never allocates.
+        bool start(uint32_t frameCount);
+        void cancel();
+
+        // Called once per game frame, before any profiled work.
+        void beginFrame();
+
+        // Acquire pairs with the release in start(), so a writer that sees the capture as live also sees its buffer,
+        //  startFrame & a reset writeIdx.
+        bool isCapturing() const { return state.load(std::memory_order_acquire) == State::CAPTURING; }
+        State getState() const { return state.load(std::memory_order_acquire); }
+
+        // Name must outlive the capture - profiler block names & string literals only.
+        void record(TraceEventPhase phase, const char* name, int64_t ticks);
+
+        uint32_t getFramesCaptured() const { return currentFrame.load(std::memory_order_relaxed) - startFrame; }
+        uint32_t getFramesRequested() const { return framesRequested; }
+        size_t   getEventCount() const { return std::min<size_t>(writeIdx.load(std::memory_order_relaxed), capacity); }
+        size_t   getDroppedCount() const { return droppedEvents.load(std::memory_order_relaxed); }
+        size_t   getCapacity() const { return capacity; }
+
+        bool writeChromeTrace(const std::filesystem::path& path);
+
+        static const TraceArgs& threadArgs();
+        static void setThreadArgs(const TraceArgs& args);
+
+    private:
+        const size_t capacity;
+        std::unique_ptr<TraceEvent[]> events;
+
+        std::atomic<State>    state{ State::IDLE };
+        std::atomic<size_t>   writeIdx{ 0 };
+        std::atomic<size_t>   droppedEvents{ 0 };
+        std::atomic<uint32_t> activeWriters{ 0 };
+        std::atomic<uint32_t> currentFrame{ 0 };
+        uint32_t startFrame      = 0;
+        uint32_t framesRequested = 0;
+        int64_t  startTicks      = 0;
+    };
+
+    // Overrides the given fields of this thread's trace args, restoring the previous args when destroyed.
+    class TraceArgsScope {
+    public:
+        TraceArgsScope(int32_t playerIndex, const char* armourSet = nullptr, int32_t boneCount = -1);
+        ~TraceArgsScope();
+
+        TraceArgsScope(const TraceArgsScope&) = delete;
+        TraceArgsScope& operator=(const TraceArgsScope&) = delete;
+
+    private:
+        bool active = false;
+        TraceArgs previous;
+    };
+
+    inline TraceCapture TRACE_CAPTURE{ 1 << 17 };
+
+}
\ No newline at end of file
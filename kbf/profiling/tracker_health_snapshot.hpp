@@ -0,0 +1,36 @@
+#pragma once
+
+#include <kbf/util/algorithm/fetch_retry_scheduler.hpp>
+#include <kbf/util/re_engine/pointer_validity_cache.hpp>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace kbf {
+
+    // Fetch & pointer validation state of one tracker, as published for the GUI in its tracker snapshot.
+    struct TrackerHealthSnapshot {
+        FetchRetryScheduler::Stats fetchStats{};
+        std::vector<std::pair<uint32_t, FetchRetryScheduler::SlotState>> failingFetches; // By slot
+
+        PointerValidityCache::Stats pointerStats{};
+        uint32_t pointerEpoch     = 0;
+        size_t   pointersPerCheck = 0;
+
+        // Assigns in place, so republishing every frame doesn't allocate once the failing list has grown.
+        void capture(const FetchRetryScheduler& retries, const PointerValidityCache& validity) {
+            fetchStats = retries.getStats();
+            failingFetches.clear();
+            for (size_t i = 0; i < retries.size(); i++) {
+                const FetchRetryScheduler::SlotState& slot = retries.getSlot(i);
+                if (slot.failures > 0) failingFetches.emplace_back(static_cast<uint32_t>(i), slot);
+            }
+
+            pointerStats     = validity.getStats();
+            pointerEpoch     = validity.getEpoch();
+            pointersPerCheck = validity.getPointersPerCheck();
+        }
+    };
+
+}
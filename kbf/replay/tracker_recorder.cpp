@@ -0,0 +1,183 @@
+#include <kbf/replay/tracker_recorder.hpp>
+
+#include <kbf/util/hash/hash_combine.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <string>
+
+namespace kbf {
+
+    namespace {
+
+        // Distance changes smaller than this (relative) aren't worth a sample - they can't reorder the nearest-N selection meaningfully.
+        constexpr float SAMPLE_DISTANCE_TOLERANCE = 0.01f;
+
+        inline size_t slotIdentity(const TrackedSlotState& state) {
+            size_t identity = std::hash<std::string_view>{}(state.id);
+            hashCombine(identity, std::hash<std::string_view>{}(state.name));
+            hashCombine(identity, static_cast<size_t>(state.female));
+            return identity;
+        }
+
+        inline bool distanceChanged(float last, float current) {
+            if (std::isinf(last) || std::isinf(current)) return last != current;
+            return std::fabs(current - last) > SAMPLE_DISTANCE_TOLERANCE * std::max(std::fabs(last), 1.0f);
+        }
+
+    }
+
+    bool TrackerRecorder::start(const std::filesystem::path& outPath) {
+        std::lock_guard lock(mutex);
+        if (recording.load(std::memory_order_relaxed)) return false;
+
+        file = std::ofstream(outPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) return false;
+
+        path = outPath;
+        buffer.clear();
+        buffer.reserve(bufferCapacity);
+        for (auto& kindSlots : slots) std::fill(kindSlots.begin(), kindSlots.end(), SlotRecord{});
+
+        frameCount.store(0, std::memory_order_relaxed);
+        eventCount.store(0, std::memory_order_relaxed);
+        bytesWritten.store(0, std::memory_order_relaxed);
+        lastFrameTime = std::chrono::steady_clock::now();
+
+        buffer.insert(buffer.end(), std::begin(TRACKER_RECORDING_MAGIC), std::end(TRACKER_RECORDING_MAGIC));
+        write(TRACKER_RECORDING_VERSION);
+
+        recording.store(true, std::memory_order_release);
+        return true;
+    }
+
+    void TrackerRecorder::stop() {
+        std::lock_guard lock(mutex);
+        if (!recording.load(std::memory_order_relaxed)) return;
+
+        recording.store(false, std::memory_order_release);
+        flush();
+        file.close();
+    }
+
+    void TrackerRecorder::beginFrame(int maxConcurrentApplications) {
+        if (!isRecording()) return;
+        std::lock_guard lock(mutex);
+        if (!recording.load(std::memory_order_relaxed)) return;
+
+        const auto now = std::chrono::steady_clock::now();
+        const auto dtUs = std::chrono::duration_cast<std::chrono::microseconds>(now - lastFrameTime).count();
+        lastFrameTime = now;
+
+        write(static_cast<uint8_t>(TrackerEventType::FRAME));
+        write(static_cast<uint32_t>(std::clamp<int64_t>(dtUs, 0, UINT32_MAX)));
+        write(static_cast<uint16_t>(std::clamp(maxConcurrentApplications, 0, static_cast<int>(UINT16_MAX))));
+        frameCount.fetch_add(1, std::memory_order_relaxed);
+
+        if (buffer.size() >= bufferCapacity * 3 / 4) flush();
+    }
+
+    void TrackerRecorder::recordReset(TrackedCharacterKind kind) {
+        if (!isRecording()) return;
+        std::lock_guard lock(mutex);
+        if (!recording.load(std::memory_order_relaxed)) return;
+
+        // Replay clears its slots on reset, so ours need clearing too or rejoining characters would never be recorded.
+        auto& kindSlots = slots[static_cast<size_t>(kind)];
+        std::fill(kindSlots.begin(), kindSlots.end(), SlotRecord{});
+
+        write(static_cast<uint8_t>(TrackerEventType::RESET));
+        write(static_cast<uint8_t>(kind));
+        eventCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void TrackerRecorder::recordRefetch(TrackedCharacterKind kind, size_t slot) {
+        if (!isRecording() || slot >= TRACKER_RECORDING_MAX_SLOTS) return;
+        std::lock_guard lock(mutex);
+        if (!recording.load(std::memory_order_relaxed)) return;
+
+        writeSlotEvent(TrackerEventType::REFETCH, kind, slot);
+    }
+
+    void TrackerRecorder::recordSlot(TrackedCharacterKind kind, size_t slot, const TrackedSlotState& state) {
+        if (!isRecording() || slot >= TRACKER_RECORDING_MAX_SLOTS) return;
+        std::lock_guard lock(mutex);
+        if (!recording.load(std::memory_order_relaxed)) return;
+
+        auto& kindSlots = slots[static_cast<size_t>(kind)];
+        if (slot >= kindSlots.size()) {
+            if (!state.occupied) return;
+            kindSlots.resize(slot + 1);
+        }
+
+        SlotRecord& last = kindSlots[slot];
+        const size_t identity = state.occupied ? slotIdentity(state) : 0;
+
+        if (last.occupied && (!state.occupied || identity != last.identity)) {
+            writeSlotEvent(TrackerEventType::LEAVE, kind, slot);
+            last = SlotRecord{};
+        }
+        if (!state.occupied) return;
+
+        if (!last.occupied) {
+            writeSlotEvent(TrackerEventType::JOIN, kind, slot);
+            write(static_cast<uint8_t>(state.female));
+            writeString(state.id);
+            writeString(state.name);
+
+            last.occupied = true;
+            last.identity = identity;
+            // Force an initial sample.
+            last.visible    = !state.visible;
+        }
+
+        // Slots already fetched when recording started have no running delay, so they're written as fetched without one.
+        const bool applyDelayStarted = state.applyDelayStamp != 0 && state.applyDelayStamp != last.applyDelayStamp;
+        if (applyDelayStarted || (state.fetched && !last.fetched)) {
+            writeSlotEvent(TrackerEventType::FETCHED, kind, slot);
+            write(static_cast<uint8_t>(applyDelayStarted));
+        }
+        last.fetched         = state.fetched;
+        last.applyDelayStamp = state.applyDelayStamp;
+
+        if (state.visible != last.visible || distanceChanged(last.distanceSq, state.distanceSq)) {
+            writeSlotEvent(TrackerEventType::SAMPLE, kind, slot);
+            write(static_cast<uint8_t>(state.visible));
+            write(state.distanceSq);
+
+            last.visible    = state.visible;
+            last.distanceSq = state.distanceSq;
+        }
+    }
+
+    template <typename T>
+    void TrackerRecorder::write(const T& value) {
+        char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+    }
+
+    void TrackerRecorder::writeString(std::string_view str) {
+        const uint16_t length = static_cast<uint16_t>(std::min<size_t>(str.size(), UINT16_MAX));
+        write(length);
+        buffer.insert(buffer.end(), str.data(), str.data() + length);
+    }
+
+    void TrackerRecorder::writeSlotEvent(TrackerEventType type, TrackedCharacterKind kind, size_t slot) {
+        write(static_cast<uint8_t>(type));
+        write(static_cast<uint8_t>(kind));
+        write(static_cast<uint16_t>(slot));
+        eventCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void TrackerRecorder::flush() {
+        if (buffer.empty()) return;
+        file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        file.flush();
+        bytesWritten.fetch_add(buffer.size(), std::memory_order_relaxed);
+        buffer.clear();
+    }
+
+}
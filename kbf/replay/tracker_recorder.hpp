@@ -0,0 +1,86 @@
+#pragma once
+
+#include <kbf/replay/tracker_recording.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace kbf {
+
+    // What the trackers know about one slot at the end of an update - diffed against the last recorded state.
+    struct TrackedSlotState {
+        bool occupied = false;
+        bool female   = false;
+        bool visible  = false;
+        bool fetched  = false; // Persistent info present
+        float distanceSq = 0.0f;
+        int64_t applyDelayStamp = 0; // Deadline of the running apply delay (steady clock ticks), 0 if none
+        std::string_view id;
+        std::string_view name;
+    };
+
+    // Records the inputs that drive the player & NPC trackers (joins / leaves, refetches, hook bursts, resets,
+    //  visibility & camera distance) to a compact binary stream, so a session can be replayed off the game (see TrackerReplay).
+    //  Costs one relaxed load per call while not recording.
+    class TrackerRecorder {
+    public:
+        TrackerRecorder(size_t bufferCapacity) : bufferCapacity{ bufferCapacity } {}
+
+        bool start(const std::filesystem::path& path);
+        void stop();
+
+        bool isRecording() const { return recording.load(std::memory_order_relaxed); }
+
+        // Called once per game frame, before the trackers update.
+        void beginFrame(int maxConcurrentApplications);
+
+        void recordReset(TrackedCharacterKind kind);
+        void recordRefetch(TrackedCharacterKind kind, size_t slot);
+        void recordSlot(TrackedCharacterKind kind, size_t slot, const TrackedSlotState& state);
+
+        const std::filesystem::path& getPath() const { return path; }
+        uint64_t getFrameCount() const { return frameCount.load(std::memory_order_relaxed); }
+        uint64_t getEventCount() const { return eventCount.load(std::memory_order_relaxed); }
+        uint64_t getBytesWritten() const { return bytesWritten.load(std::memory_order_relaxed); }
+
+    private:
+        struct SlotRecord {
+            bool     occupied = false;
+            bool     visible  = false;
+            bool     fetched  = false;
+            float    distanceSq = 0.0f;
+            size_t   identity   = 0;
+            int64_t  applyDelayStamp = 0;
+        };
+
+        template <typename T>
+        void write(const T& value);
+        void writeString(std::string_view str);
+        void writeSlotEvent(TrackerEventType type, TrackedCharacterKind kind, size_t slot);
+        void flush();
+
+        const size_t bufferCapacity;
+
+        std::mutex mutex;
+        std::atomic<bool> recording{ false };
+        std::filesystem::path path;
+        std::ofstream file;
+        std::vector<char> buffer;
+        std::array<std::vector<SlotRecord>, 2> slots;
+        std::chrono::steady_clock::time_point lastFrameTime;
+
+        std::atomic<uint64_t> frameCount{ 0 };
+        std::atomic<uint64_t> eventCount{ 0 };
+        std::atomic<uint64_t> bytesWritten{ 0 };
+    };
+
+    inline TrackerRecorder TRACKER_RECORDER{ 1 << 16 };
+
+}
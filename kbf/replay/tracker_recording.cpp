@@ -0,0 +1,117 @@
+#include <kbf/replay/tracker_recording.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace kbf {
+
+    namespace {
+
+        class RecordingReader {
+        public:
+            RecordingReader(const std::vector<char>& data) : data{ data } {}
+
+            bool atEnd() const { return pos >= data.size(); }
+
+            template <typename T>
+            bool read(T& out) {
+                if (pos + sizeof(T) > data.size()) return false;
+                std::memcpy(&out, data.data() + pos, sizeof(T));
+                pos += sizeof(T);
+                return true;
+            }
+
+            bool readBool(bool& out) {
+                uint8_t value = 0;
+                if (!read(value)) return false;
+                out = value != 0;
+                return true;
+            }
+
+            bool readString(std::string& out) {
+                uint16_t length = 0;
+                if (!read(length) || pos + length > data.size()) return false;
+                out.assign(data.data() + pos, length);
+                pos += length;
+                return true;
+            }
+
+            bool readSlot(TrackerEvent& event) {
+                uint8_t kind = 0;
+                if (!read(kind) || !read(event.slot)) return false;
+                if (kind > static_cast<uint8_t>(TrackedCharacterKind::NPC) || event.slot >= TRACKER_RECORDING_MAX_SLOTS) return false;
+                event.kind = static_cast<TrackedCharacterKind>(kind);
+                return true;
+            }
+
+        private:
+            const std::vector<char>& data;
+            size_t pos = 0;
+        };
+
+        bool readEvent(RecordingReader& reader, TrackerEventType type, TrackerEvent& event) {
+            event.type = type;
+
+            switch (type) {
+            case TrackerEventType::RESET: {
+                uint8_t kind = 0;
+                if (!reader.read(kind) || kind > static_cast<uint8_t>(TrackedCharacterKind::NPC)) return false;
+                event.kind = static_cast<TrackedCharacterKind>(kind);
+                return true;
+            }
+            case TrackerEventType::JOIN:
+                return reader.readSlot(event) && reader.readBool(event.female) && reader.readString(event.id) && reader.readString(event.name);
+            case TrackerEventType::LEAVE:
+            case TrackerEventType::REFETCH:
+                return reader.readSlot(event);
+            case TrackerEventType::FETCHED:
+                return reader.readSlot(event) && reader.readBool(event.applyDelay);
+            case TrackerEventType::SAMPLE:
+                return reader.readSlot(event) && reader.readBool(event.visible) && reader.read(event.distanceSq);
+            default:
+                return false;
+            }
+        }
+
+    }
+
+    bool readTrackerRecording(const std::filesystem::path& path, TrackerRecording& out) {
+        out = TrackerRecording{};
+
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) return false;
+
+        const std::vector<char> data{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+        RecordingReader reader{ data };
+
+        char magic[4]{};
+        uint16_t version = 0;
+        for (char& c : magic) if (!reader.read(c)) return false;
+        if (std::memcmp(magic, TRACKER_RECORDING_MAGIC, sizeof(magic)) != 0) return false;
+        if (!reader.read(version) || version != TRACKER_RECORDING_VERSION) return false;
+
+        while (!reader.atEnd()) {
+            uint8_t type = 0;
+            if (!reader.read(type)) return false;
+
+            if (static_cast<TrackerEventType>(type) == TrackerEventType::FRAME) {
+                TrackerRecordingFrame frame{};
+                if (!reader.read(frame.dtUs) || !reader.read(frame.maxConcurrentApplications)) return false;
+                out.frames.push_back(std::move(frame));
+                continue;
+            }
+
+            // Events before the first frame marker (e.g. the reset at the start of a recording) get a zero-length frame.
+            if (out.frames.empty()) out.frames.emplace_back();
+
+            TrackerEvent event{};
+            if (!readEvent(reader, static_cast<TrackerEventType>(type), event)) return false;
+            out.frames.back().events.push_back(std::move(event));
+            out.eventCount++;
+        }
+
+        return true;
+    }
+
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace kbf {
+
+    // Tracker input recordings (.kbfr), written by TrackerRecorder and read back by TrackerReplay.
+    //  Header: "KBFR" + u16 version, followed by a stream of [u8 event type][payload] records. All values little-endian,
+    //  strings are a u16 byte length + UTF-8 bytes. Samples are only written when they change - replay holds the last value.
+    constexpr char     TRACKER_RECORDING_MAGIC[4]  = { 'K', 'B', 'F', 'R' };
+    constexpr uint16_t TRACKER_RECORDING_VERSION   = 1;
+    constexpr uint16_t TRACKER_RECORDING_MAX_SLOTS = 1024;
+
+    enum class TrackedCharacterKind : uint8_t {
+        PLAYER = 0,
+        NPC    = 1
+    };
+
+    enum class TrackerEventType : uint8_t {
+        FRAME   = 0, // u32 dt (us), u16 max concurrent applications
+        RESET   = 1, // u8 kind                                    - scene / save transition, all slots cleared
+        JOIN    = 2, // u8 kind, u16 slot, u8 female, str id, str name
+        LEAVE   = 3, // u8 kind, u16 slot
+        FETCHED = 4, // u8 kind, u16 slot, u8 apply delay started  - persistent info (re)fetched
+        SAMPLE  = 5, // u8 kind, u16 slot, u8 visible, f32 camera distance sq
+        REFETCH = 6, // u8 kind, u16 slot                          - equip change / warp hooks, onNpcChangeState for NPCs
+    };
+
+    struct TrackerEvent {
+        TrackerEventType     type;
+        TrackedCharacterKind kind = TrackedCharacterKind::PLAYER;
+        uint16_t slot       = 0;
+        bool     female     = false;
+        bool     visible    = false;
+        bool     applyDelay = false;
+        float    distanceSq = 0.0f;
+        std::string id;   // Hunter ID for players, prefab path for NPCs
+        std::string name;
+    };
+
+    struct TrackerRecordingFrame {
+        uint32_t dtUs = 0;
+        uint16_t maxConcurrentApplications = 0;
+        std::vector<TrackerEvent> events;
+    };
+
+    struct TrackerRecording {
+        std::vector<TrackerRecordingFrame> frames;
+        size_t eventCount = 0;
+    };
+
+    // Returns false on a missing file, bad header or truncated record - frames read up to that point are kept,
+    //  so a recording cut short by a crash can still be replayed.
+    bool readTrackerRecording(const std::filesystem::path& path, TrackerRecording& out);
+
+}
@@ -0,0 +1,168 @@
+#include <kbf/replay/tracker_replay.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+namespace kbf {
+
+    namespace {
+
+        constexpr size_t PLAYER = static_cast<size_t>(TrackedCharacterKind::PLAYER);
+        constexpr size_t NPC    = static_cast<size_t>(TrackedCharacterKind::NPC);
+
+    }
+
+    TrackerReplayStats TrackerReplay::run(const TrackerRecording& recording, const FrameCallback& onFrame) {
+        TrackerReplayStats stats{};
+        for (auto& kindSlots : slots) kindSlots.clear();
+        for (ApplyScheduler& scheduler : schedulers) scheduler.resize(TRACKER_RECORDING_MAX_SLOTS);
+
+        // Whole microseconds, so frame times add up exactly & delays expire on the same frame on every run.
+        uint64_t timeUs = 0;
+        double timeSec = 0.0;
+        for (size_t frameIdx = 0; frameIdx < recording.frames.size(); frameIdx++) {
+            const TrackerRecordingFrame& frame = recording.frames[frameIdx];
+            timeUs += frame.dtUs;
+            timeSec = static_cast<double>(timeUs) / 1e6;
+            const auto now = ApplyScheduler::Clock::time_point{} + std::chrono::duration_cast<ApplyScheduler::Clock::duration>(std::chrono::microseconds(timeUs));
+
+            const TrackerReplayStats before = stats;
+            for (const TrackerEvent& event : frame.events) applyEvent(event, now, stats);
+
+            // Same order as the trackers' update - fetch first, then expire apply delays (see updateApplyDelays).
+            for (ApplyScheduler& scheduler : schedulers) scheduler.advance(now);
+
+            const size_t frameJoins     = stats.joins[PLAYER] + stats.joins[NPC] - before.joins[PLAYER] - before.joins[NPC];
+            const size_t frameRefetches = stats.refetches[PLAYER] + stats.refetches[NPC] - before.refetches[PLAYER] - before.refetches[NPC];
+            stats.maxJoinsPerFrame     = std::max(stats.maxJoinsPerFrame, frameJoins);
+            stats.maxRefetchesPerFrame = std::max(stats.maxRefetchesPerFrame, frameRefetches);
+
+            const int maxConcurrentApplications = options.maxConcurrentApplicationsOverride >= 0
+                ? options.maxConcurrentApplicationsOverride
+                : static_cast<int>(frame.maxConcurrentApplications);
+
+            TrackerReplayFrameResult result{};
+            result.frame   = frameIdx;
+            result.timeSec = timeSec;
+
+            const auto planStart = std::chrono::steady_clock::now();
+            planApplications(TrackedCharacterKind::PLAYER, maxConcurrentApplications, result);
+            planApplications(TrackedCharacterKind::NPC,    maxConcurrentApplications, result);
+            const double planUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - planStart).count();
+
+            stats.planningTotalUs += planUs;
+            stats.planningMaxUs    = std::max(stats.planningMaxUs, planUs);
+
+            for (size_t kind : { PLAYER, NPC }) {
+                stats.peakOccupied[kind] = std::max(stats.peakOccupied[kind], result.occupied[kind]);
+                stats.applications[kind] += result.applications[kind];
+                stats.overLimit[kind]    += result.overLimit[kind];
+            }
+            stats.maxApplicationsPerFrame = std::max(stats.maxApplicationsPerFrame, result.applications[PLAYER] + result.applications[NPC]);
+
+            if (onFrame) onFrame(result);
+        }
+
+        stats.frames      = recording.frames.size();
+        stats.events      = recording.eventCount;
+        stats.durationSec = timeSec;
+        return stats;
+    }
+
+    void TrackerReplay::applyEvent(const TrackerEvent& event, ApplyScheduler::Clock::time_point now, TrackerReplayStats& stats) {
+        const size_t kind = static_cast<size_t>(event.kind);
+        auto& kindSlots = slots[kind];
+        ApplyScheduler& scheduler = schedulers[kind];
+
+        if (event.type == TrackerEventType::RESET) {
+            kindSlots.clear();
+            scheduler.cancelAll();
+            stats.resets++;
+            return;
+        }
+
+        if (event.slot >= kindSlots.size()) kindSlots.resize(event.slot + 1);
+        SlotState& slot = kindSlots[event.slot];
+
+        switch (event.type) {
+        case TrackerEventType::JOIN:
+            slot = SlotState{};
+            slot.occupied = true;
+            scheduler.cancelDelay(event.slot);
+            stats.joins[kind]++;
+            break;
+        case TrackerEventType::LEAVE:
+            slot = SlotState{};
+            scheduler.cancelDelay(event.slot);
+            stats.leaves[kind]++;
+            break;
+        case TrackerEventType::FETCHED:
+            slot.fetched = true;
+            if (event.applyDelay) scheduler.startDelay(event.slot, now, options.delayOnEquip);
+            break;
+        case TrackerEventType::SAMPLE:
+            slot.visible    = event.visible;
+            slot.distanceSq = event.distanceSq;
+            break;
+        case TrackerEventType::REFETCH:
+            // Hooks only queue the slot - whatever the refetch changes shows up as LEAVE / JOIN / FETCHED events afterwards.
+            stats.refetches[kind]++;
+            break;
+        default:
+            break;
+        }
+    }
+
+    void TrackerReplay::planApplications(TrackedCharacterKind kind, int maxConcurrentApplications, TrackerReplayFrameResult& result) {
+        const size_t kindIdx = static_cast<size_t>(kind);
+        const auto& kindSlots = slots[kindIdx];
+        ApplyScheduler& scheduler = schedulers[kindIdx];
+
+        auto isReady = [&](size_t i) {
+            const SlotState& slot = kindSlots[i];
+            return slot.visible && slot.fetched && !scheduler.isDelayed(static_cast<uint32_t>(i));
+        };
+
+        // Recorded samples are already range-tested (they're only visible when in range).
+        scheduler.beginSelection();
+        size_t occupied = 0;
+        size_t ready    = 0;
+        for (size_t i = 0; i < kindSlots.size(); i++) {
+            const SlotState& slot = kindSlots[i];
+            if (!slot.occupied) continue;
+
+            occupied++;
+            if (isReady(i)) ready++;
+            scheduler.addCandidate(static_cast<uint32_t>(i), slot.visible, slot.distanceSq);
+        }
+        result.occupied[kindIdx] = occupied;
+
+        const size_t limit = scheduler.select(0.0f, maxConcurrentApplications);
+        size_t applied = 0;
+        for (size_t i = 0; i < limit; i++) {
+            if (isReady(scheduler.selectedId(i))) applied++;
+        }
+
+        result.applications[kindIdx] += applied;
+        result.overLimit[kindIdx]    += ready - applied;
+    }
+
+    std::string TrackerReplayStats::summary() const {
+        const double avgPlanUs = frames > 0 ? planningTotalUs / static_cast<double>(frames) : 0.0;
+        char buffer[512];
+        std::snprintf(buffer, sizeof(buffer),
+            "%zu frames (%.1fs), %zu events, %zu resets\n"
+            "Players: %zu joins, %zu leaves, %zu refetches, peak %zu, %zu applications (%zu over limit)\n"
+            "NPCs:    %zu joins, %zu leaves, %zu refetches, peak %zu, %zu applications (%zu over limit)\n"
+            "Max / frame: %zu joins, %zu refetches, %zu applications\n"
+            "Planning: %.2f us avg, %.2f us max",
+            frames, durationSec, events, resets,
+            joins[PLAYER], leaves[PLAYER], refetches[PLAYER], peakOccupied[PLAYER], applications[PLAYER], overLimit[PLAYER],
+            joins[NPC],    leaves[NPC],    refetches[NPC],    peakOccupied[NPC],    applications[NPC],    overLimit[NPC],
+            maxJoinsPerFrame, maxRefetchesPerFrame, maxApplicationsPerFrame,
+            avgPlanUs, planningMaxUs);
+        return buffer;
+    }
+
+}
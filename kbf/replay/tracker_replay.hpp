@@ -0,0 +1,78 @@
+#pragma once
+
+#include <kbf/replay/tracker_recording.hpp>
+#include <kbf/util/algorithm/apply_scheduler.hpp>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace kbf {
+
+    struct TrackerReplayOptions {
+        float delayOnEquip = 0.0f; // Seconds, as KBFSettings::delayOnEquip
+        int   maxConcurrentApplicationsOverride = -1; // < 0 uses the limit recorded each frame
+    };
+
+    // Per-frame outcome of the replayed apply planning, for callers that want to check decisions frame by frame.
+    struct TrackerReplayFrameResult {
+        size_t frame = 0;
+        double timeSec = 0.0;
+        std::array<size_t, 2> occupied{};      // Indexed by TrackedCharacterKind
+        std::array<size_t, 2> applications{};  // Selected, visible, fetched & past their apply delay
+        std::array<size_t, 2> overLimit{};     // Would have applied, but outside the nearest-N selection
+    };
+
+    struct TrackerReplayStats {
+        size_t frames = 0;
+        size_t events = 0;
+        double durationSec = 0.0;
+
+        std::array<size_t, 2> joins{};
+        std::array<size_t, 2> leaves{};
+        std::array<size_t, 2> refetches{};
+        std::array<size_t, 2> peakOccupied{};
+        std::array<size_t, 2> applications{};
+        std::array<size_t, 2> overLimit{};
+        size_t resets = 0;
+
+        size_t maxJoinsPerFrame      = 0;
+        size_t maxRefetchesPerFrame  = 0; // onNpcChangeState & equip hook bursts
+        size_t maxApplicationsPerFrame = 0;
+
+        double planningTotalUs = 0.0;
+        double planningMaxUs   = 0.0;
+
+        std::string summary() const;
+    };
+
+    // Feeds a recording through the engine-independent half of the trackers - slot occupancy, apply delays &
+    //  the nearest-N selection, through the same ApplyScheduler as PlayerTracker / NpcTracker - using the recorded
+    //  frame times as the clock. Nothing here touches REFramework, so it runs anywhere the recording can be read.
+    class TrackerReplay {
+    public:
+        using FrameCallback = std::function<void(const TrackerReplayFrameResult&)>;
+
+        TrackerReplay(TrackerReplayOptions options) : options{ options } {}
+
+        TrackerReplayStats run(const TrackerRecording& recording, const FrameCallback& onFrame = nullptr);
+
+    private:
+        struct SlotState {
+            bool   occupied  = false;
+            bool   visible   = false;
+            bool   fetched   = false;
+            float  distanceSq = 0.0f;
+        };
+
+        void applyEvent(const TrackerEvent& event, ApplyScheduler::Clock::time_point now, TrackerReplayStats& stats);
+        void planApplications(TrackedCharacterKind kind, int maxConcurrentApplications, TrackerReplayFrameResult& result);
+
+        TrackerReplayOptions options;
+        std::array<std::vector<SlotState>, 2> slots;
+        std::array<ApplyScheduler, 2> schedulers; // Indexed by TrackedCharacterKind
+    };
+
+}
@@ -130,7 +130,7 @@ namespace kbf {
             instance.addCustomSituation(CustomSituation::isInGame);
         }
 
-        DEBUG_STACK.push(std::format("{} Internal Situations Changed:{}", SITUATION_WATCHER_LOG_TAG, instance.currentSituations.empty() ? "EMPTY" : infoSituationStr));
+        DEBUG_STACK.fpush("{} Internal Situations Changed:{}", SITUATION_WATCHER_LOG_TAG, instance.currentSituations.empty() ? "EMPTY" : infoSituationStr);
 
         return REFRAMEWORK_HOOK_CALL_ORIGINAL;
     }
@@ -178,19 +178,19 @@ namespace kbf {
 
         REApi::ManagedObject* cutscenePropsControllerManager = instance.CutScenePropsControllerManager.get();
         if (cutscenePropsControllerManager == nullptr)
-            return DEBUG_STACK.push(std::format("{} Could not fetch CutScenePropsControllerManager singleton in \'cutsceneStartPostStart\'.", SITUATION_WATCHER_LOG_TAG), DebugStack::Color::COL_WARNING);
+            return DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Could not fetch CutScenePropsControllerManager singleton in \'cutsceneStartPostStart\'.", SITUATION_WATCHER_LOG_TAG);
 
         instance.addCustomSituation(CustomSituation::isInCutscene);
         int* cutsceneId = re_memory_ptr<int>(cutscenePropsControllerManager, 0xB0);
 
         instance.currentCutsceneId = cutsceneId ? *cutsceneId : -1;
-        DEBUG_STACK.push(std::format("{} Started Cutscene: [{}]", SITUATION_WATCHER_LOG_TAG, instance.currentCutsceneId));
+        DEBUG_STACK.fpush("{} Started Cutscene: [{}]", SITUATION_WATCHER_LOG_TAG, instance.currentCutsceneId);
     }
 
     int SituationWatcher::cutsceneEndPreStart(int argc, void** argv, REFrameworkTypeDefinitionHandle* arg_tys, unsigned long long ret_addr) {
         SituationWatcher& instance = get();
         
-        DEBUG_STACK.push(std::format("{} Finished Cutscene: [{}]", SITUATION_WATCHER_LOG_TAG, instance.currentCutsceneId));
+        DEBUG_STACK.fpush("{} Finished Cutscene: [{}]", SITUATION_WATCHER_LOG_TAG, instance.currentCutsceneId);
 
         instance.removeCustomSituation(CustomSituation::isInCutscene);
         instance.currentCutsceneId = -1;
@@ -236,11 +236,11 @@ namespace kbf {
         REApi::ManagedObject* saveSelectCtrl = stageController_SaveSelect;
 
         if (guildCardCtrl == nullptr)
-            return DEBUG_STACK.push(std::format("{} Could not fetch guild card cSimpleStageController in \'updateCustomSituations\'.", SITUATION_WATCHER_LOG_TAG), DebugStack::Color::COL_WARNING);
+            return DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Could not fetch guild card cSimpleStageController in \'updateCustomSituations\'.", SITUATION_WATCHER_LOG_TAG);
         if (charaMakeCtrl == nullptr)
-            return DEBUG_STACK.push(std::format("{} Could not fetch chara make cSimpleStageController in \'updateCustomSituations\'.", SITUATION_WATCHER_LOG_TAG), DebugStack::Color::COL_WARNING);
+            return DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Could not fetch chara make cSimpleStageController in \'updateCustomSituations\'.", SITUATION_WATCHER_LOG_TAG);
         if (saveSelectCtrl == nullptr)
-            return DEBUG_STACK.push(std::format("{} Could not fetch save select cSimpleStageController in \'updateCustomSituations\'.", SITUATION_WATCHER_LOG_TAG), DebugStack::Color::COL_WARNING);
+            return DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Could not fetch save select cSimpleStageController in \'updateCustomSituations\'.", SITUATION_WATCHER_LOG_TAG);
 
         const bool guildCardIsActive  = REInvoke<bool>(stageController_GuildCard,  "get_IsActive", {}, InvokeReturnType::BOOL);
         const bool charaMakeIsActive  = REInvoke<bool>(stageController_CharaMake,  "get_IsActive", {}, InvokeReturnType::BOOL);
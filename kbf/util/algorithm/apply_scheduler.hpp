@@ -0,0 +1,66 @@
+#pragma once
+
+#include <kbf/util/algorithm/distance_culler.hpp>
+#include <kbf/util/time/timer_wheel.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+
+namespace kbf {
+
+    // Decides which tracked characters are applied to each frame - the engine-independent half of PlayerTracker /
+    //  NpcTracker::applyPresets, shared with TrackerReplay so a replayed session makes exactly the same decisions.
+    //  Two parts: apply delays (a slot waits out delayOnEquip after being (re)fetched before it's applied to), and the
+    //  nearest-N selection of the candidates in range of the camera. Not thread safe.
+    class ApplyScheduler {
+    public:
+        using Clock = TimerWheel::Clock;
+
+        // Slot ids must be in [0, slotCount). Cancels any running delays.
+        void resize(size_t slotCount) { delays.resize(slotCount); }
+
+        // ---- Apply Delays -------------------------------------------------------------------------------------
+
+        // (Re)starts the slot's delay. Even a 0s delay holds the slot back until the next advance() - the same frame's,
+        //  when fetching comes first.
+        void startDelay(uint32_t slot, Clock::time_point now, float delaySeconds) {
+            const auto delay = std::chrono::duration<float>(std::max(delaySeconds, 0.0f));
+            delays.schedule(slot, now, std::chrono::duration_cast<Clock::duration>(delay));
+        }
+
+        void cancelDelay(uint32_t slot) { delays.cancel(slot); }
+        void cancelAll() { delays.cancelAll(); }
+
+        // Ends every delay that has run out by `now`. Once per frame, after fetching & before selecting.
+        void advance(Clock::time_point now) { delays.advance(now, [](uint32_t) {}); }
+
+        bool isDelayed(uint32_t slot) const { return delays.isPending(slot); }
+        std::optional<Clock::time_point> getDelayDeadline(uint32_t slot) const { return delays.getDeadline(slot); }
+        size_t delayedCount() const { return delays.pendingCount(); }
+
+        // ---- Selection ----------------------------------------------------------------------------------------
+
+        void beginSelection() { culler.clear(); }
+
+        // Invisible candidates are culled outright, so a stale distance can't take a visible character's place.
+        void addCandidate(uint32_t id, bool visible, float distanceSq) {
+            culler.add(id, visible ? distanceSq : std::numeric_limits<float>::infinity());
+        }
+
+        // Keeps the `maxApplications` nearest candidates within `range`, where <= 0 means no limit for either.
+        //  Returns how many were kept; selectedId(i) is then the i'th, in no particular order.
+        size_t select(float range, int maxApplications) { return culler.select(range, std::max(maxApplications, 0)); }
+        uint32_t selectedId(size_t i) const { return culler.selectedId(i); }
+
+        size_t getBytes() const { return delays.getBytes() + culler.getBytes(); }
+
+    private:
+        TimerWheel     delays{};
+        DistanceCuller culler{};
+    };
+
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define KBF_DISTANCE_CULLER_SSE2
+#endif
+
+namespace kbf {
+
+    // Picks which characters to apply to this frame: the `limit` nearest of those within range of the camera.
+    //  Candidates are gathered into contiguous arrays first, so the range test runs four lanes at a time over plain
+    //  floats, and the partial selection shuffles 32-bit indices rather than the callers' (larger) slot entries.
+    //  Keep one around & clear() it each frame - the arrays only ever grow to the largest crowd seen, and are written
+    //  by index up to a count rather than pushed to, so adding a candidate is two stores.
+    //  Crowds of up to SMALL_COUNT skip the SIMD pass & nth_element for a plain loop & an insertion sort, which is
+    //  cheaper at that size.
+    class DistanceCuller {
+    public:
+        static constexpr size_t SMALL_COUNT = 16;
+
+        void clear() {
+            count         = 0;
+            selectedCount = 0;
+        }
+
+        void reserve(size_t capacity) {
+            if (capacity > distancesSq.size()) grow(capacity);
+        }
+
+        // Candidates that can't be ranked (not visible, no info yet) should pass +infinity - they're always culled.
+        void add(uint32_t id, float distanceSq) {
+            if (count == ids.size()) grow(std::max<size_t>(count * 2, SMALL_COUNT));
+            ids[count]         = id;
+            distancesSq[count] = distanceSq;
+            count++;
+        }
+
+        size_t size() const { return count; }
+
+        // Culls everything further than `range` (<= 0 for no range), then keeps the `limit` nearest (<= 0 for no limit).
+        //  Returns how many were kept; selectedId(i) is then the id of the i'th, in no particular order.
+        size_t select(float range, int limit) {
+            const float maxDistanceSq = range > 0.0f ? range * range : std::numeric_limits<float>::max();
+            selectedCount = count <= SMALL_COUNT ? selectSmall(maxDistanceSq, limit) : selectLarge(maxDistanceSq, limit);
+            return selectedCount;
+        }
+
+        uint32_t selectedId(size_t i) const { return ids[selected[i]]; }
+
+        size_t getBytes() const {
+            return distancesSq.capacity() * sizeof(float) + (ids.capacity() + selected.capacity()) * sizeof(uint32_t);
+        }
+
+    private:
+        void grow(size_t capacity) {
+            distancesSq.resize(capacity);
+            ids.resize(capacity);
+            selected.resize(capacity);
+        }
+
+        size_t selectSmall(float maxDistanceSq, int limit) {
+            size_t kept = 0;
+            for (size_t i = 0; i < count; i++) {
+                selected[kept] = static_cast<uint32_t>(i);
+                kept += distancesSq[i] <= maxDistanceSq ? 1 : 0;
+            }
+
+            if (limit <= 0 || kept <= static_cast<size_t>(limit)) return kept;
+
+            for (size_t i = 1; i < kept; i++) {
+                const uint32_t index = selected[i];
+                size_t j = i;
+                for (; j > 0 && distancesSq[selected[j - 1]] > distancesSq[index]; j--) selected[j] = selected[j - 1];
+                selected[j] = index;
+            }
+            return static_cast<size_t>(limit);
+        }
+
+        size_t selectLarge(float maxDistanceSq, int limit) {
+            // Written unconditionally & advanced by the mask, so the compaction doesn't branch per candidate.
+            size_t kept = 0;
+            size_t i = 0;
+
+#ifdef KBF_DISTANCE_CULLER_SSE2
+            const __m128 threshold = _mm_set1_ps(maxDistanceSq);
+            for (; i + 4 <= count; i += 4) {
+                const __m128 distances = _mm_loadu_ps(distancesSq.data() + i);
+                // NaN & infinity both compare false, so they drop out with the out of range ones.
+                unsigned mask = static_cast<unsigned>(_mm_movemask_ps(_mm_cmple_ps(distances, threshold)));
+                while (mask != 0) {
+                    selected[kept++] = static_cast<uint32_t>(i + std::countr_zero(mask));
+                    mask &= mask - 1;
+                }
+            }
+#endif
+            for (; i < count; i++) {
+                selected[kept] = static_cast<uint32_t>(i);
+                kept += distancesSq[i] <= maxDistanceSq ? 1 : 0;
+            }
+
+            if (limit <= 0 || kept <= static_cast<size_t>(limit)) return kept;
+
+            std::nth_element(selected.begin(), selected.begin() + limit, selected.begin() + kept, [&](uint32_t a, uint32_t b) {
+                return distancesSq[a] < distancesSq[b];
+            });
+            return static_cast<size_t>(limit);
+        }
+
+        // Sized to capacity; only the first `count` (`selectedCount`) entries are live.
+        std::vector<float>    distancesSq;
+        std::vector<uint32_t> ids;
+        std::vector<uint32_t> selected; // Indices into the arrays above
+        size_t count         = 0;
+        size_t selectedCount = 0;
+    };
+
+}
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace kbf {
+
+    // Why a character's fetch didn't complete.
+    enum class FetchFailure : uint8_t {
+        NONE,
+        FRAME_BUDGET,       // Out of bone fetches this frame - not a failure, never backed off
+        BASIC_INFO,         // A component in the basic info chain (manage info, context, HunterCharacter, ...) was null
+        MISSING_TRANSFORM,
+        ARMOUR_INFO,
+        ARMOUR_TRANSFORMS,
+        BONES,
+        PARTS,
+        MATERIALS,
+        COUNT
+    };
+
+    constexpr const char* fetchFailureName(FetchFailure failure) {
+        switch (failure) {
+        case FetchFailure::NONE:              return "None";
+        case FetchFailure::FRAME_BUDGET:      return "Frame Budget";
+        case FetchFailure::BASIC_INFO:        return "Basic Info";
+        case FetchFailure::MISSING_TRANSFORM: return "Missing Transform";
+        case FetchFailure::ARMOUR_INFO:       return "Armour Info";
+        case FetchFailure::ARMOUR_TRANSFORMS: return "Armour Transforms";
+        case FetchFailure::BONES:             return "Bones";
+        case FetchFailure::PARTS:             return "Parts";
+        case FetchFailure::MATERIALS:         return "Materials";
+        default:                              return "Unknown";
+        }
+    }
+
+    // Per-slot retry timing for character fetches. Each consecutive failure doubles the wait before the slot is tried
+    //  again (BASE_DELAY up to MAX_DELAY), with jitter so characters that failed together don't all retry on the same
+    //  frame. After GIVE_UP_AFTER consecutive failures the slot isn't tried again until reset - i.e. until it succeeds
+    //  some other way, is cleared, or is explicitly requested again. Basic info failures only ever back off: the slot
+    //  may be taken by a new character, and only the basic fetch would notice.
+    //  Update thread only; the debug tab reads it unsynchronised, like the rest of the tracker state.
+    class FetchRetryScheduler {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr std::chrono::milliseconds BASE_DELAY{ 50 };
+        static constexpr std::chrono::milliseconds MAX_DELAY{ 5000 };
+        static constexpr uint32_t GIVE_UP_AFTER = 16; // ~35s of retrying
+
+        struct SlotState {
+            uint32_t          failures    = 0; // Consecutive
+            FetchFailure      lastFailure = FetchFailure::NONE;
+            bool              givenUp     = false;
+            Clock::time_point nextAttempt{};
+        };
+
+        struct Stats {
+            uint64_t attempts = 0;
+            uint64_t deferred = 0; // Attempts skipped while backing off - fetches saved
+            uint64_t givenUp  = 0;
+            std::array<uint64_t, static_cast<size_t>(FetchFailure::COUNT)> failures{};
+        };
+
+        void resize(size_t slotCount) { slots.resize(slotCount); }
+        size_t size() const { return slots.size(); }
+
+        // Whether slot `i` may be fetched now. Slots that haven't failed are always due.
+        bool isDue(size_t i, Clock::time_point now) {
+            const SlotState& slot = slots[i];
+            if (slot.failures == 0) return true;
+
+            if (slot.givenUp || now < slot.nextAttempt) {
+                stats.deferred++;
+                return false;
+            }
+            return true;
+        }
+
+        // Returns true when this failure made the slot give up, so the caller can report it once.
+        bool recordFailure(size_t i, FetchFailure failure, Clock::time_point now) {
+            stats.attempts++;
+            if (failure == FetchFailure::FRAME_BUDGET) return false;
+
+            stats.failures[static_cast<size_t>(failure)]++;
+
+            SlotState& slot = slots[i];
+            slot.failures++;
+            slot.lastFailure = failure;
+
+            const bool canGiveUp = failure != FetchFailure::BASIC_INFO && failure != FetchFailure::MISSING_TRANSFORM;
+            if (canGiveUp && slot.failures >= GIVE_UP_AFTER) {
+                if (!slot.givenUp) stats.givenUp++;
+                const bool justGaveUp = !slot.givenUp;
+                slot.givenUp = true;
+                return justGaveUp;
+            }
+
+            slot.nextAttempt = now + backoff(slot.failures);
+            return false;
+        }
+
+        void recordSuccess(size_t i) {
+            stats.attempts++;
+            reset(i);
+        }
+
+        void reset(size_t i) { if (i < slots.size()) slots[i] = SlotState{}; }
+        void resetAll() { std::fill(slots.begin(), slots.end(), SlotState{}); }
+
+        const SlotState& getSlot(size_t i) const { return slots[i]; }
+        const Stats& getStats() const { return stats; }
+
+        // Slots currently backing off or given up.
+        size_t countFailing() const {
+            return static_cast<size_t>(std::count_if(slots.begin(), slots.end(), [](const SlotState& slot) { return slot.failures > 0; }));
+        }
+
+    private:
+        // BASE_DELAY * 2^(failures - 1), capped, then scaled by a random factor in [0.5, 1).
+        Clock::duration backoff(uint32_t failures) {
+            const uint32_t shift = std::min<uint32_t>(failures - 1, 16);
+            const auto delay = std::min<Clock::duration>(BASE_DELAY * (int64_t{ 1 } << shift), MAX_DELAY);
+
+            jitterState ^= jitterState << 13;
+            jitterState ^= jitterState >> 17;
+            jitterState ^= jitterState << 5;
+            const double factor = 0.5 + 0.5 * (static_cast<double>(jitterState) / 4294967296.0);
+
+            return std::chrono::duration_cast<Clock::duration>(delay * factor);
+        }
+
+        std::vector<SlotState> slots;
+        Stats stats{};
+        uint32_t jitterState = 0x9E3779B9u;
+    };
+
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace kbf {
+
+    enum class HierarchyVisit {
+        MATCH,    // Stop here & return this node
+        CONTINUE, // Carry on into its children & siblings
+        PRUNE     // Skip everything reached through it - its children & the rest of its sibling chain
+    };
+
+    // Depth & breadth limited search of a first-child / next-sibling hierarchy (e.g. via.Transform), walking each
+    //  sibling chain before descending, as the target is more likely found breadth-wise. Node access goes through the
+    //  callables - visit(node) -> HierarchyVisit, child(node) / next(node) -> first child / next sibling or a null Node
+    //  - so the traversal doesn't depend on the engine.
+    //  The pending stack holds every unvisited child along the current sibling chains, so it's as wide as the hierarchy.
+    //  It's a per-thread vector kept between searches: no size limit, and only a search wider than any before it on the
+    //  thread allocates. Not reentrant - visit() mustn't start another search over the same Node type.
+    template <typename Node, typename VisitFn, typename ChildFn, typename NextFn>
+    Node searchHierarchy(Node root, VisitFn&& visit, ChildFn&& child, NextFn&& next, size_t maxDepth, size_t maxBreadth) {
+        struct Pending {
+            Node     node;
+            uint32_t depth;
+            uint32_t breadth;
+        };
+
+        thread_local std::vector<Pending> pending;
+        pending.clear();
+        pending.push_back(Pending{ root, 0, 0 });
+
+        while (!pending.empty()) {
+            const Pending current = pending.back();
+            pending.pop_back();
+
+            if (current.node == Node{}) continue;
+            if (current.depth > maxDepth || current.breadth > maxBreadth) continue;
+
+            const HierarchyVisit result = visit(current.node);
+            if (result == HierarchyVisit::MATCH) {
+                pending.clear();
+                return current.node;
+            }
+
+            if (result == HierarchyVisit::PRUNE) continue;
+
+            // Children are pushed first, so the sibling chain is popped (& searched) before them.
+            pending.push_back(Pending{ child(current.node), current.depth + 1, 0 });
+            pending.push_back(Pending{ next(current.node), current.depth, current.breadth + 1 });
+        }
+
+        return Node{};
+    }
+
+}
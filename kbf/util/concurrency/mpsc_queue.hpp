@@ -0,0 +1,107 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace kbf {
+
+    // Bounded multi-producer / single-consumer queue. Producers (engine hook threads) claim a cell with one CAS on the
+    //  tail & never wait on each other or the consumer; the consumer (frame update) drains everything published so far
+    //  in one go. Each cell carries a sequence number saying whose turn it is, so a producer that claimed a cell but
+    //  hasn't finished writing it simply ends the drain there - the rest is picked up next time.
+    //  Pushing to a full queue fails rather than blocking. T should be small & trivially copyable.
+    template <typename T>
+    class MpscQueue {
+    public:
+        MpscQueue() = default;
+        explicit MpscQueue(size_t minCapacity) { reset(minCapacity); }
+
+        MpscQueue(const MpscQueue&) = delete;
+        MpscQueue& operator=(const MpscQueue&) = delete;
+
+        // (Re)allocates for at least `minCapacity` entries, dropping anything queued. Not thread safe - only call while
+        //  no producer can be pushing (e.g. before the hooks that push are able to reach this queue).
+        void reset(size_t minCapacity) {
+            capacity = std::bit_ceil(std::max<size_t>(minCapacity, 2));
+            cells    = std::make_unique<Cell[]>(capacity);
+            for (size_t i = 0; i < capacity; i++) cells[i].sequence.store(i, std::memory_order_relaxed);
+
+            tail.store(0, std::memory_order_relaxed);
+            head = 0;
+            rejected.store(0, std::memory_order_relaxed);
+        }
+
+        // Any thread. Returns false if the queue is full (or was never allocated).
+        bool tryPush(const T& value) {
+            if (capacity == 0) return false;
+
+            uint64_t pos = tail.load(std::memory_order_relaxed);
+            for (;;) {
+                Cell& cell = cells[pos & (capacity - 1)];
+                const uint64_t sequence = cell.sequence.load(std::memory_order_acquire);
+                const int64_t  lag      = static_cast<int64_t>(sequence - pos);
+
+                if (lag == 0) {
+                    // Free cell for this position - claim it. On failure pos is reloaded & we try the next one.
+                    if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        cell.value = value;
+                        cell.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (lag < 0) {
+                    // The consumer hasn't freed this cell from the previous lap yet.
+                    rejected.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+                else {
+                    pos = tail.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // Consumer thread only. Calls fn(value) for every entry published so far, oldest first, and returns how many.
+        template <typename Fn>
+        size_t drain(Fn&& fn) {
+            if (capacity == 0) return 0;
+
+            size_t count = 0;
+            for (;;) {
+                Cell& cell = cells[head & (capacity - 1)];
+                if (cell.sequence.load(std::memory_order_acquire) != head + 1) break;
+
+                const T value = cell.value;
+                cell.sequence.store(head + capacity, std::memory_order_release);
+                head++;
+
+                fn(value);
+                count++;
+            }
+            return count;
+        }
+
+        size_t   getCapacity() const { return capacity; }
+        uint64_t getPushed()   const { return tail.load(std::memory_order_relaxed); }
+        uint64_t getRejected() const { return rejected.load(std::memory_order_relaxed); }
+        size_t   getBytes()    const { return capacity * sizeof(Cell); }
+
+    private:
+        struct Cell {
+            std::atomic<uint64_t> sequence{ 0 };
+            T value{};
+        };
+
+        size_t capacity = 0;
+        std::unique_ptr<Cell[]> cells;
+
+        // Producers hammer the tail, so keep it off the consumer's line.
+        alignas(64) std::atomic<uint64_t> tail{ 0 };
+        alignas(64) uint64_t head = 0;
+        std::atomic<uint64_t> rejected{ 0 };
+    };
+
+}
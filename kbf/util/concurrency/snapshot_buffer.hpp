@@ -0,0 +1,50 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace kbf {
+
+    // Triple buffer for handing a per-frame copy of some state from one writer thread to one reader thread without
+    //  either ever waiting. The writer fills the back buffer & publishes it; the reader picks up the newest published
+    //  buffer whenever it reads. The three buffers rotate through one atomic index, so the writer never touches what
+    //  the reader holds, and a slow reader just skips snapshots rather than holding the writer up.
+    //  Buffers are reused, not rebuilt - assigning into the previous contents keeps their capacity.
+    template <typename T>
+    class SnapshotBuffer {
+    public:
+        // Writer thread. The buffer to fill for the next publish - it holds an older snapshot, overwrite all of it.
+        T& back() { return buffers[backIndex]; }
+
+        // Writer thread. Makes back() the newest snapshot & hands the writer a free buffer.
+        void publish() {
+            const uint8_t previous = middle.exchange(static_cast<uint8_t>(backIndex | FRESH), std::memory_order_acq_rel);
+            backIndex = previous & INDEX_MASK;
+            published.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Reader thread. The newest published snapshot (default constructed before the first publish). The reference
+        //  stays valid & unchanged until this reader's next read().
+        const T& read() {
+            if (middle.load(std::memory_order_relaxed) & FRESH) {
+                const uint8_t previous = middle.exchange(frontIndex, std::memory_order_acq_rel);
+                frontIndex = previous & INDEX_MASK;
+            }
+            return buffers[frontIndex];
+        }
+
+        uint64_t getPublished() const { return published.load(std::memory_order_relaxed); }
+
+    private:
+        static constexpr uint8_t INDEX_MASK = 0b011;
+        static constexpr uint8_t FRESH      = 0b100; // Middle holds a snapshot the reader hasn't taken yet
+
+        std::array<T, 3> buffers{};
+        uint8_t backIndex  = 0;                     // Writer's
+        uint8_t frontIndex = 2;                     // Reader's
+        alignas(64) std::atomic<uint8_t> middle{ 1 };
+        std::atomic<uint64_t> published{ 0 };
+    };
+
+}
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace kbf {
+
+    // Small fixed pool for fork-join work on the update thread: parallelFor hands out indices to the workers & the
+    //  calling thread, and returns once every index is done. Workers sleep on a condition variable between jobs and
+    //  are only started on the first job that's actually spread out, so an idle pool costs nothing. stop() joins them
+    //  again & the next spread out job starts a fresh set - owners living in a dll must stop() before it unloads, since
+    //  the destructor would otherwise join from DllMain under the loader lock, which the exiting workers also need.
+    //  One job at a time - parallelFor & stop must only be called from one thread (the update thread). Jobs must not
+    //  throw, & run on whichever thread picks them up - thread_local state (e.g. NoAllocScope) doesn't carry over.
+    class WorkerPool {
+    public:
+        // Workers on top of the calling thread. 0 runs everything inline.
+        explicit WorkerPool(size_t workerCount) : workerCount{ workerCount } {}
+        ~WorkerPool() { stop(); }
+
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        // One fewer than the hardware threads (the caller works too), capped - the game wants the rest.
+        static size_t defaultWorkerCount(size_t maxWorkers) {
+            const size_t hardware = std::thread::hardware_concurrency();
+            return std::min(hardware > 1 ? hardware - 1 : 0, maxWorkers);
+        }
+
+        // Calls fn(i) for every i in [0, count). Jobs smaller than `minParallel` run inline, where waking the
+        //  workers would cost more than it saves.
+        template <typename Fn>
+        void parallelFor(size_t count, size_t minParallel, Fn&& fn) {
+            if (count == 0) return;
+            if (workerCount == 0 || count < std::max<size_t>(minParallel, 2)) {
+                for (size_t i = 0; i < count; i++) fn(i);
+                inlineJobs++;
+                return;
+            }
+            if (workers.empty()) start();
+
+            using FnT = std::remove_reference_t<Fn>;
+            {
+                std::lock_guard<std::mutex> lock(mux);
+                job.context = const_cast<void*>(static_cast<const void*>(std::addressof(fn)));
+                job.invoke  = [](void* context, size_t i) { (*static_cast<FnT*>(context))(i); };
+                job.count   = count;
+                next.store(0, std::memory_order_relaxed);
+                jobActive = true;
+                generation++;
+            }
+            wake.notify_all();
+
+            runJob(job.invoke, job.context, count);
+
+            // Indices claimed by a worker are only done once that worker has left the job, & `fn` lives on this
+            //  stack - so wait for every worker that joined, then close the job so none can join late.
+            std::unique_lock<std::mutex> lock(mux);
+            done.wait(lock, [this]() { return inFlight == 0; });
+            jobActive = false;
+            parallelJobs++;
+        }
+
+        // Joins the workers. Safe to call when they never started; the pool stays usable & restarts lazily.
+        void stop() {
+            if (workers.empty()) return;
+            {
+                std::lock_guard<std::mutex> lock(mux);
+                stopRequested = true;
+            }
+            wake.notify_all();
+
+            for (std::thread& worker : workers) {
+                if (worker.joinable()) worker.join();
+            }
+            workers.clear();
+            stops++;
+        }
+
+        size_t getWorkerCount() const { return workerCount; }
+        bool isStarted() const { return !workers.empty(); }
+        uint64_t getParallelJobs() const { return parallelJobs; }
+        uint64_t getInlineJobs() const { return inlineJobs; }
+        uint64_t getStops() const { return stops; }
+
+    private:
+        using InvokeFn = void(*)(void*, size_t);
+
+        struct Job {
+            InvokeFn invoke  = nullptr;
+            void*    context = nullptr;
+            size_t   count   = 0;
+        };
+
+        void start() {
+            {
+                std::lock_guard<std::mutex> lock(mux);
+                stopRequested = false;
+            }
+            // Workers from a restart begin at the current generation, so they don't wake for a job that's long gone.
+            workers.reserve(workerCount);
+            for (size_t i = 0; i < workerCount; i++) workers.emplace_back([this, startGeneration = generation]() { run(startGeneration); });
+        }
+
+        void runJob(InvokeFn invoke, void* context, size_t count) {
+            for (size_t i = next.fetch_add(1, std::memory_order_relaxed); i < count; i = next.fetch_add(1, std::memory_order_relaxed)) {
+                invoke(context, i);
+            }
+        }
+
+        void run(uint64_t seenGeneration) {
+            std::unique_lock<std::mutex> lock(mux);
+            for (;;) {
+                wake.wait(lock, [&]() { return stopRequested || generation != seenGeneration; });
+                if (stopRequested) return;
+
+                seenGeneration = generation;
+                if (!jobActive) continue; // Woke after the caller already finished it
+
+                const Job current = job;
+                inFlight++;
+                lock.unlock();
+
+                runJob(current.invoke, current.context, current.count);
+
+                lock.lock();
+                if (--inFlight == 0) done.notify_one();
+            }
+        }
+
+        const size_t workerCount;
+        std::vector<std::thread> workers;
+
+        std::mutex              mux;
+        std::condition_variable wake;
+        std::condition_variable done;
+        Job      job{};
+        uint64_t generation    = 0;
+        size_t   inFlight      = 0;
+        bool     jobActive     = false;
+        bool     stopRequested = false;
+
+        alignas(64) std::atomic<size_t> next{ 0 };
+
+        uint64_t parallelJobs = 0;
+        uint64_t inlineJobs   = 0;
+        uint64_t stops        = 0;
+    };
+
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <string_view>
+#include <vector>
+
+namespace kbf {
+
+	// Maps a fixed set of string keys onto [0, n) with no collisions, for tables built once & only read afterwards.
+	//  Keys are hashed once (64-bit), split into buckets, and each bucket stores the displacement that lands
+	//  all its keys in free slots (hash & displace). A lookup is one string hash plus two array reads - no probing,
+	//  no string compares. Keys outside the set are rejected by a stored fingerprint (full hash & length), so a
+	//  false match needs a 64-bit hash collision with a known key of the same length.
+	class MinimalPerfectHash {
+	public:
+		static constexpr size_t npos = static_cast<size_t>(-1);
+
+		// Returns false if the keys can't be placed (duplicates, or a pathological key set).
+		bool build(const std::vector<std::string_view>& keys) {
+			clear();
+			const size_t n = keys.size();
+			if (n == 0) return true;
+
+			std::vector<uint64_t> hashes(n);
+			for (size_t i = 0; i < n; i++) hashes[i] = hash(keys[i]);
+
+			const size_t bucketCount = std::max<size_t>(n / KEYS_PER_BUCKET, 1);
+			std::vector<std::vector<uint32_t>> buckets(bucketCount);
+			for (uint32_t i = 0; i < n; i++) buckets[reduce(hashes[i], bucketCount)].push_back(i);
+
+			// Place the fullest buckets first, while there's the most room.
+			std::vector<uint32_t> order(bucketCount);
+			std::iota(order.begin(), order.end(), 0u);
+			std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return buckets[a].size() > buckets[b].size(); });
+
+			displacements.assign(bucketCount, 0);
+			fingerprints.assign(n, Fingerprint{});
+			std::vector<bool>     taken(n, false);
+			std::vector<uint32_t> slots;
+
+			for (uint32_t b : order) {
+				const std::vector<uint32_t>& bucket = buckets[b];
+				if (bucket.empty()) break;
+
+				bool placed = false;
+				for (uint32_t d = 0; d < MAX_DISPLACEMENT && !placed; d++) {
+					slots.clear();
+					placed = true;
+					for (uint32_t key : bucket) {
+						const uint32_t slot = static_cast<uint32_t>(slotOf(hashes[key], d, n));
+						if (taken[slot] || std::find(slots.begin(), slots.end(), slot) != slots.end()) { placed = false; break; }
+						slots.push_back(slot);
+					}
+
+					if (placed) {
+						displacements[b] = d;
+						for (size_t k = 0; k < bucket.size(); k++) {
+							taken[slots[k]] = true;
+							fingerprints[slots[k]] = Fingerprint{ hashes[bucket[k]], static_cast<uint32_t>(keys[bucket[k]].size()) };
+						}
+					}
+				}
+
+				if (!placed) {
+					clear();
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		// Slot of `key`, or npos if it isn't one of the keys built with.
+		size_t find(std::string_view key) const {
+			if (fingerprints.empty()) return npos;
+
+			const uint64_t h    = hash(key);
+			const size_t   slot = slotOf(h, displacements[reduce(h, displacements.size())], fingerprints.size());
+			const Fingerprint& fingerprint = fingerprints[slot];
+			return (fingerprint.hash == h && fingerprint.length == key.size()) ? slot : npos;
+		}
+
+		size_t size() const { return fingerprints.size(); }
+		size_t getBytes() const { return displacements.capacity() * sizeof(uint32_t) + fingerprints.capacity() * sizeof(Fingerprint); }
+
+		void clear() {
+			displacements.clear();
+			fingerprints.clear();
+		}
+
+		// 8 bytes per step - prefab paths are long enough that hashing dominates the lookup.
+		static uint64_t hash(std::string_view key) {
+			uint64_t h = 0xcbf29ce484222325ull ^ (key.size() * 0x9e3779b97f4a7c15ull);
+			size_t i = 0;
+			for (; i + 8 <= key.size(); i += 8) {
+				uint64_t word;
+				std::memcpy(&word, key.data() + i, sizeof(word));
+				h = mix(h ^ word);
+			}
+			if (i < key.size()) {
+				uint64_t tail = 0;
+				std::memcpy(&tail, key.data() + i, key.size() - i);
+				h = mix(h ^ tail);
+			}
+			return mix(h);
+		}
+
+	private:
+		static constexpr size_t   KEYS_PER_BUCKET  = 4;
+		static constexpr uint32_t MAX_DISPLACEMENT = 1u << 20;
+
+		struct Fingerprint {
+			uint64_t hash   = 0;
+			uint32_t length = 0;
+		};
+
+		static constexpr uint64_t mix(uint64_t x) {
+			x *= 0xff51afd7ed558ccdull;
+			return x ^ (x >> 32);
+		}
+
+		static size_t slotOf(uint64_t h, uint32_t displacement, size_t n) {
+			// Remix so the slot doesn't correlate with the bucket (both come from the same hash).
+			uint64_t x = h ^ (static_cast<uint64_t>(displacement) * 0x9e3779b97f4a7c15ull);
+			x ^= x >> 33;
+			x *= 0xff51afd7ed558ccdull;
+			x ^= x >> 33;
+			return reduce(x, n);
+		}
+
+		// Maps the hash's high 32 bits onto [0, n) with a multiply instead of a divide. Fine for n < 2^32.
+		static size_t reduce(uint64_t h, size_t n) {
+			return static_cast<size_t>(((h >> 32) * static_cast<uint64_t>(n)) >> 32);
+		}
+
+		std::vector<uint32_t>    displacements;
+		std::vector<Fingerprint> fingerprints;
+	};
+
+}
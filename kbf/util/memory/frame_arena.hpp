@@ -0,0 +1,212 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+namespace kbf {
+
+    // Bump allocator for data that only lives for one frame - apply-time lookup tables, candidate lists & the like.
+    //  Memory is handed out of large chunks and never freed piecemeal; the arena rewinds in one go on its first use in
+    //  the next frame. Once the chunks have grown to fit a frame's worth of temporaries, allocating is a pointer bump
+    //  and the heap is never touched. It's a std::pmr::memory_resource, so pmr containers can sit on it directly.
+    //
+    //  One arena per thread (local()), so the planner pool needs no coordination - memory must be released on the
+    //  thread that allocated it. Anything still holding arena memory when its arena rewinds has escaped its frame:
+    //  that's counted, and the chunks are set aside until it's released rather than being handed out again.
+    class FrameArena : public std::pmr::memory_resource {
+    public:
+        static constexpr size_t DEFAULT_CHUNK_BYTES = 64 * 1024;
+        static constexpr uint8_t POISON_BYTE = 0xCD;
+
+        // This thread's arena, rewound if a frame has started since it was last used.
+        static FrameArena& local() {
+            thread_local FrameArena arena{};
+            const uint64_t frame = currentFrame.load(std::memory_order_relaxed);
+            if (arena.frame != frame) {
+                arena.rewind();
+                arena.frame = frame;
+            }
+            return arena;
+        }
+
+        // Called once per game frame, ahead of any per-frame work.
+        static void beginFrame() { currentFrame.fetch_add(1, std::memory_order_relaxed); }
+
+        // Fill rewound memory with POISON_BYTE, so anything reading arena memory from a past frame through a raw
+        //  pointer (which the escape count can't see) reads obvious garbage.
+        static bool isPoisoning() { return poisoning.load(std::memory_order_relaxed); }
+        static void setPoisoning(bool enable) { poisoning.store(enable, std::memory_order_relaxed); }
+
+        FrameArena() {
+            std::lock_guard<std::mutex> lock(registryMux);
+            registry.push_back(this);
+        }
+        ~FrameArena() override {
+            std::lock_guard<std::mutex> lock(registryMux);
+            registry.erase(std::remove(registry.begin(), registry.end(), this), registry.end());
+        }
+
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        // Counters are written by the owning thread & may be read from any.
+        struct Stats {
+            uint64_t lastFrameAllocations = 0;
+            uint64_t lastFrameBytes       = 0;
+            uint64_t highWaterBytes       = 0; // Most requested in a single frame
+            uint64_t capacityBytes        = 0; // Live chunks, including any set aside after an escape
+            uint64_t chunkAllocations     = 0; // Heap allocations the arena itself has made, ever
+            uint64_t escapes              = 0; // Frames that ended with arena memory still in use
+        };
+
+        Stats getStats() const {
+            return Stats{
+                .lastFrameAllocations = lastFrameAllocations.load(std::memory_order_relaxed),
+                .lastFrameBytes       = lastFrameBytes.load(std::memory_order_relaxed),
+                .highWaterBytes       = highWaterBytes.load(std::memory_order_relaxed),
+                .capacityBytes        = capacityBytes.load(std::memory_order_relaxed),
+                .chunkAllocations     = chunkAllocations.load(std::memory_order_relaxed),
+                .escapes              = escapes.load(std::memory_order_relaxed)
+            };
+        }
+
+        // Calls fn(const FrameArena&) for every thread's arena. Holds the registry lock throughout, so keep fn short.
+        template <typename Fn>
+        static void forEach(Fn&& fn) {
+            std::lock_guard<std::mutex> lock(registryMux);
+            for (const FrameArena* arena : registry) fn(*arena);
+        }
+
+    private:
+        struct Chunk {
+            std::unique_ptr<std::byte[]> data;
+            size_t size = 0;
+        };
+
+        void* do_allocate(size_t bytes, size_t alignment) override {
+            if (bytes == 0) bytes = 1;
+
+            uintptr_t aligned = alignUp(cursor, alignment);
+            if (cursor == 0 || aligned + bytes > chunkEnd) aligned = nextChunk(bytes, alignment);
+
+            cursor = aligned + bytes;
+            live++;
+            frameAllocations++;
+            frameBytes += bytes;
+            return reinterpret_cast<void*>(aligned);
+        }
+
+        void do_deallocate(void* ptr, size_t bytes, size_t /*alignment*/) override {
+            live--;
+
+            // Handing back the newest allocation (a vector outgrowing itself, a map rehashing) rewinds to reuse it.
+            const uintptr_t address = reinterpret_cast<uintptr_t>(ptr);
+            if (address >= chunkBegin && address + std::max<size_t>(bytes, 1) == cursor) cursor = address;
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+        static uintptr_t alignUp(uintptr_t address, size_t alignment) {
+            return (address + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+        }
+
+        // Moves on to the next chunk with room, allocating one if none is left. Returns the aligned start.
+        uintptr_t nextChunk(size_t bytes, size_t alignment) {
+            for (size_t i = currentChunk + (cursor == 0 ? 0 : 1); i < chunks.size(); i++) {
+                const uintptr_t begin   = reinterpret_cast<uintptr_t>(chunks[i].data.get());
+                const uintptr_t aligned = alignUp(begin, alignment);
+                if (aligned + bytes <= begin + chunks[i].size) {
+                    useChunk(i);
+                    return aligned;
+                }
+            }
+
+            addChunk(std::max(DEFAULT_CHUNK_BYTES, bytes + alignment));
+            useChunk(chunks.size() - 1);
+            return alignUp(chunkBegin, alignment);
+        }
+
+        void useChunk(size_t index) {
+            currentChunk = index;
+            chunkBegin   = reinterpret_cast<uintptr_t>(chunks[index].data.get());
+            chunkEnd     = chunkBegin + chunks[index].size;
+            cursor       = chunkBegin;
+        }
+
+        void addChunk(size_t size) {
+            chunks.push_back(Chunk{ std::make_unique_for_overwrite<std::byte[]>(size), size });
+            chunkAllocations.fetch_add(1, std::memory_order_relaxed);
+            capacityBytes.fetch_add(size, std::memory_order_relaxed);
+        }
+
+        void rewind() {
+            lastFrameAllocations.store(frameAllocations, std::memory_order_relaxed);
+            lastFrameBytes.store(frameBytes, std::memory_order_relaxed);
+            if (frameBytes > highWaterBytes.load(std::memory_order_relaxed)) highWaterBytes.store(frameBytes, std::memory_order_relaxed);
+            frameAllocations = 0;
+            frameBytes       = 0;
+
+            if (live != 0) {
+                // Escaped - whatever's still alive may be anywhere in the current chunks, so none of them can be reused.
+                escapes.fetch_add(1, std::memory_order_relaxed);
+                for (Chunk& chunk : chunks) retired.push_back(std::move(chunk));
+                chunks.clear();
+            }
+            else if (!retired.empty()) {
+                for (const Chunk& chunk : retired) capacityBytes.fetch_sub(chunk.size, std::memory_order_relaxed);
+                retired.clear();
+            }
+
+            // A frame that spilled over several chunks gets them merged into one, so the next fits in a single chunk.
+            if (chunks.size() > 1) {
+                size_t total = 0;
+                for (const Chunk& chunk : chunks) total += chunk.size;
+                capacityBytes.fetch_sub(total, std::memory_order_relaxed);
+                chunks.clear();
+                addChunk(total);
+            }
+
+            if (isPoisoning()) {
+                for (Chunk& chunk : chunks) std::memset(chunk.data.get(), POISON_BYTE, chunk.size);
+            }
+
+            currentChunk = 0;
+            chunkBegin   = 0;
+            chunkEnd     = 0;
+            cursor       = 0;
+        }
+
+        std::vector<Chunk> chunks;
+        std::vector<Chunk> retired; // Chunks that held memory which escaped its frame
+        size_t    currentChunk = 0;
+        uintptr_t chunkBegin   = 0;
+        uintptr_t chunkEnd     = 0;
+        uintptr_t cursor       = 0; // 0 until the first allocation of a frame
+
+        uint64_t frame            = 0;
+        int64_t  live             = 0; // Allocations not yet handed back, across frames
+        uint64_t frameAllocations = 0;
+        uint64_t frameBytes       = 0;
+
+        std::atomic<uint64_t> lastFrameAllocations{ 0 };
+        std::atomic<uint64_t> lastFrameBytes{ 0 };
+        std::atomic<uint64_t> highWaterBytes{ 0 };
+        std::atomic<uint64_t> capacityBytes{ 0 };
+        std::atomic<uint64_t> chunkAllocations{ 0 };
+        std::atomic<uint64_t> escapes{ 0 };
+
+        static inline std::atomic<uint64_t> currentFrame{ 1 };
+        static inline std::atomic<bool>     poisoning{ false };
+
+        static inline std::mutex               registryMux;
+        static inline std::vector<FrameArena*> registry;
+    };
+
+}
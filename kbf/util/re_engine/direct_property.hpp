@@ -0,0 +1,266 @@
+#pragma once
+
+#include <kbf/util/re_engine/reinvoke.hpp>
+#include <kbf/profiling/engine_call_stats.hpp>
+
+#include <reframework/API.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace kbf {
+
+    struct DirectPropertyStat {
+        std::string typeName;
+        std::string getterName;
+        std::string fieldName;
+        const char* state = "";
+        uint32_t    offset = 0;
+        uint64_t    directReadsLastFrame = 0;
+        uint64_t    directReads = 0; // Getter calls avoided
+        uint64_t    getterCalls = 0;
+        uint64_t    mismatches  = 0;
+    };
+
+    class iDirectProperty {
+    public:
+        virtual void resolve() = 0;
+        virtual void beginFrame() = 0;
+        virtual DirectPropertyStat stat() const = 0;
+    };
+
+    // Every DirectProperty registers itself here, so they can be resolved up front & reported on together.
+    class DirectPropertyRegistry {
+    public:
+        static void add(iDirectProperty* property) { all().push_back(property); }
+
+        static void resolveAll() { for (iDirectProperty* property : all()) property->resolve(); }
+        static void beginFrame() { for (iDirectProperty* property : all()) property->beginFrame(); }
+
+        static std::vector<DirectPropertyStat> snapshot() {
+            std::vector<DirectPropertyStat> stats;
+            stats.reserve(all().size());
+            for (const iDirectProperty* property : all()) stats.push_back(property->stat());
+            return stats;
+        }
+
+    private:
+        static std::vector<iDirectProperty*>& all() {
+            static std::vector<iDirectProperty*> properties{};
+            return properties;
+        }
+    };
+
+    // A reflective getter that's backed by a plain field. The field is found through the type database, checked
+    //  against the getter on the first reads of live objects, and from then on read straight from memory. Matching reads
+    //  only count as evidence once they've seen the value change (both values, for a bool), or come from several objects
+    //  over several frames - a field that merely sits at the getter's usual value can't pass on one object's reads. Every
+    //  REVALIDATE_INTERVAL'th read is checked against the getter again, so a game update that moves or repurposes the
+    //  field drops the property back to the getter for the rest of the session instead of returning garbage.
+    //  Native (via.*) types have no reflected fields, so those simply always use the getter.
+    template <typename T>
+    class DirectProperty : public iDirectProperty {
+    public:
+        static constexpr uint32_t VALIDATION_SAMPLES  = 16;
+        static constexpr uint32_t VALIDATION_FRAMES   = 8;  // Distinct frames & objects needed when the value never changed
+        static constexpr uint32_t VALIDATION_OBJECTS  = 2;
+        static constexpr uint32_t REVALIDATE_INTERVAL = 1024; // Power of two
+
+        // `fieldNames` overrides the backing field names tried for the getter's property (see candidateFieldNames).
+        DirectProperty(const char* typeName, const char* getterName, InvokeReturnType returnType, std::initializer_list<const char*> fieldNames = {})
+            : typeName{ typeName }, getterName{ getterName }, returnType{ returnType }, fieldNames{ fieldNames } {
+            DirectPropertyRegistry::add(this);
+        }
+
+        T read(reframework::API::ManagedObject* obj) {
+            State current = state.load(std::memory_order_acquire);
+            if (current == State::UNRESOLVED) {
+                resolve();
+                current = state.load(std::memory_order_acquire);
+            }
+
+            if ((current == State::VALIDATING || current == State::DIRECT) && isResolvedType(obj)) {
+                const T direct = *reinterpret_cast<const T*>(reinterpret_cast<uintptr_t>(obj) + offset);
+
+                if (current == State::DIRECT && (++readsSinceCheck & (REVALIDATE_INTERVAL - 1)) != 0) {
+                    if (ENGINE_CALL_STATS.isEnabled()) {
+                        directReads.fetch_add(1, std::memory_order_relaxed);
+                        directReadsThisFrame.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    return direct;
+                }
+
+                const T expected = callGetter(obj);
+                if (direct == expected) {
+                    if (current == State::VALIDATING && recordValidatedSample(obj, expected)) state.store(State::DIRECT, std::memory_order_release);
+                }
+                else {
+                    mismatches.fetch_add(1, std::memory_order_relaxed);
+                    state.store(State::MISMATCH, std::memory_order_release);
+                    DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{}::{} no longer matches field {} at +0x{:x}, falling back to the getter.",
+                        typeName, getterName, resolvedFieldName, offset);
+                }
+                return expected;
+            }
+
+            return callGetter(obj);
+        }
+
+        void resolve() override {
+            State expected = State::UNRESOLVED;
+            if (!state.compare_exchange_strong(expected, State::RESOLVING, std::memory_order_acq_rel)) return;
+
+            reframework::API::TypeDefinition* type = reframework::API::get()->tdb()->find_type(typeName);
+            if (type != nullptr) {
+                for (const std::string& name : candidateFieldNames()) {
+                    reframework::API::Field* field = type->find_field(name);
+                    if (field == nullptr || field->is_static()) continue;
+
+                    reframework::API::TypeDefinition* fieldType = field->get_type();
+                    if (fieldType == nullptr || !fieldType->is_valuetype() || fieldType->get_valuetype_size() != sizeof(T)) continue;
+
+                    const uint32_t fieldOffset = field->get_offset_from_base();
+                    if (fieldOffset + sizeof(T) > type->get_size()) continue;
+
+                    offset            = fieldOffset;
+                    resolvedType      = type;
+                    resolvedFieldName = name;
+                    state.store(State::VALIDATING, std::memory_order_release);
+                    return;
+                }
+            }
+
+            DEBUG_STACK.fpush(DebugStack::Color::COL_DEBUG, "No backing field found for {}::{}, it will be read through the getter.", typeName, getterName);
+            state.store(State::NO_FIELD, std::memory_order_release);
+        }
+
+        void beginFrame() override {
+            frame++;
+            directReadsLastFrame.store(directReadsThisFrame.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+
+        DirectPropertyStat stat() const override {
+            // The field name is only written before leaving RESOLVING, so it's safe to copy once we're past that.
+            const State current = state.load(std::memory_order_acquire);
+
+            DirectPropertyStat out{};
+            out.typeName             = typeName;
+            out.getterName           = getterName;
+            out.fieldName            = (current == State::VALIDATING || current == State::DIRECT || current == State::MISMATCH) ? resolvedFieldName : "";
+            out.state                = stateName(current);
+            out.offset               = offset;
+            out.directReadsLastFrame = directReadsLastFrame.load(std::memory_order_relaxed);
+            out.directReads          = directReads.load(std::memory_order_relaxed);
+            out.getterCalls          = getterCalls.load(std::memory_order_relaxed);
+            out.mismatches           = mismatches.load(std::memory_order_relaxed);
+            return out;
+        }
+
+    private:
+        enum class State : uint8_t {
+            UNRESOLVED,
+            RESOLVING,
+            VALIDATING,
+            DIRECT,
+            NO_FIELD,
+            MISMATCH
+        };
+
+        static const char* stateName(State state) {
+            switch (state) {
+            case State::UNRESOLVED: return "Unresolved";
+            case State::RESOLVING:  return "Resolving";
+            case State::VALIDATING: return "Validating";
+            case State::DIRECT:     return "Direct";
+            case State::NO_FIELD:   return "Getter (No Field)";
+            case State::MISMATCH:   return "Getter (Mismatch)";
+            }
+            return "Unknown";
+        }
+
+        // get_Foo -> <Foo>k__BackingField, _Foo, Foo, _foo, foo
+        std::vector<std::string> candidateFieldNames() const {
+            if (!fieldNames.empty()) return std::vector<std::string>(fieldNames.begin(), fieldNames.end());
+
+            std::string property = getterName;
+            if (property.starts_with("get_")) property.erase(0, 4);
+            if (property.empty()) return {};
+
+            std::string lowerProperty = property;
+            if (lowerProperty[0] >= 'A' && lowerProperty[0] <= 'Z') lowerProperty[0] = static_cast<char>(lowerProperty[0] - 'A' + 'a');
+
+            return { "<" + property + ">k__BackingField", "_" + property, property, "_" + lowerProperty, lowerProperty };
+        }
+
+        // Counts a matching read during validation; true once there's enough evidence to switch to reading directly.
+        bool recordValidatedSample(reframework::API::ManagedObject* obj, const T& value) {
+            validatedSamples++;
+
+            if (validatedSamples == 1) firstValue = value;
+            else if (!(value == firstValue)) valueChanged = true;
+
+            if (frame != lastSampleFrame) {
+                lastSampleFrame = frame;
+                sampledFrames++;
+            }
+
+            const auto objectsEnd = sampledObjects.begin() + sampledObjectCount;
+            if (sampledObjectCount < sampledObjects.size() && std::find(sampledObjects.begin(), objectsEnd, obj) == objectsEnd) {
+                sampledObjects[sampledObjectCount++] = obj;
+            }
+
+            if (validatedSamples < VALIDATION_SAMPLES) return false;
+            return valueChanged || (sampledFrames >= VALIDATION_FRAMES && sampledObjectCount >= VALIDATION_OBJECTS);
+        }
+
+        bool isResolvedType(reframework::API::ManagedObject* obj) {
+            reframework::API::TypeDefinition* type = obj->get_type_definition();
+            if (type == resolvedType || type == lastDerivedType) return true;
+            if (type == nullptr || !type->is_a(resolvedType)) return false;
+
+            // Base class fields keep their offsets in derived types.
+            lastDerivedType = type;
+            return true;
+        }
+
+        T callGetter(reframework::API::ManagedObject* obj) {
+            if (ENGINE_CALL_STATS.isEnabled()) getterCalls.fetch_add(1, std::memory_order_relaxed);
+            return REInvoke<T>(obj, getterName, {}, returnType);
+        }
+
+        const char* const typeName;
+        const char* const getterName;
+        const InvokeReturnType returnType;
+        const std::vector<const char*> fieldNames;
+
+        std::atomic<State> state{ State::UNRESOLVED };
+        uint32_t offset = 0;
+        std::string resolvedFieldName{};
+        reframework::API::TypeDefinition* resolvedType    = nullptr;
+        reframework::API::TypeDefinition* lastDerivedType = nullptr;
+
+        uint32_t validatedSamples = 0;
+        uint32_t readsSinceCheck  = 0;
+
+        // Validation evidence. Object pointers are only compared, never dereferenced.
+        T        firstValue{};
+        bool     valueChanged    = false;
+        uint64_t frame           = 0;
+        uint64_t lastSampleFrame = UINT64_MAX;
+        uint32_t sampledFrames   = 0;
+        std::array<reframework::API::ManagedObject*, VALIDATION_OBJECTS> sampledObjects{};
+        size_t   sampledObjectCount = 0;
+
+        std::atomic<uint64_t> directReads{ 0 };
+        std::atomic<uint64_t> directReadsThisFrame{ 0 };
+        std::atomic<uint64_t> directReadsLastFrame{ 0 };
+        std::atomic<uint64_t> getterCalls{ 0 };
+        std::atomic<uint64_t> mismatches{ 0 };
+    };
+
+}
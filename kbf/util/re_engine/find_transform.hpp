@@ -1,50 +1,45 @@
 #pragma once
 
 #include <kbf/util/re_engine/reinvoke.hpp>
+#include <kbf/util/re_engine/transform_path_cache.hpp>
+#include <kbf/util/algorithm/hierarchy_search.hpp>
 
 #include <reframework/API.hpp>
 
+#include <string_view>
+
 using REApi = reframework::API;
 
 namespace kbf {
 
-	// Recursive helper if find(System.String) fails
-	static inline REApi::ManagedObject* searchTransforms(
-		REApi::ManagedObject* node,
-		const std::string& targetName,
-		size_t depth, size_t maxDepth,
-		size_t breadth, size_t maxBreadth
+	inline bool transformNameEquals(REApi::ManagedObject* transform, std::string_view name) {
+		REApi::ManagedObject* gameObject = REInvokePtr<REApi::ManagedObject>(transform, "get_GameObject", {});
+		if (gameObject == nullptr) return false;
+
+		return REInvokeStrView(gameObject, "get_Name", {}) == name;
+	}
+
+	// Full hierarchy search by name, for when find(System.String) fails - see searchHierarchy for the visit order.
+	inline REApi::ManagedObject* searchTransforms(
+		REApi::ManagedObject* root,
+		std::string_view targetName,
+		size_t maxDepth = 20, size_t maxBreadth = 100
 	) {
-		if (!node) return nullptr;
-		if (depth > maxDepth) return nullptr;
-		if (breadth > maxBreadth) return nullptr;
-
-		// Add this node's name
-		REApi::ManagedObject* gameObject = REInvokePtr<REApi::ManagedObject>(node, "get_GameObject", {});
-		if (gameObject == nullptr) return nullptr;
-
-		std::string name = REInvokeStr(gameObject, "get_Name", {});
-		DEBUG_STACK.push(std::format("Searching Transforms: {} | [{}]-[{}] | {}", targetName, depth, breadth, name), DebugStack::Color::COL_DEBUG);
-		if (name == targetName) return node;
-
-		// Recurse into siblings (More likely to find it breadth-wise first)
-		REApi::ManagedObject* siblingRet = searchTransforms(
-			REInvokePtr<REApi::ManagedObject>(node, "get_Next", {}), 
-			targetName, 
-			depth, maxDepth, 
-			breadth + 1, maxBreadth);
-		if (siblingRet != nullptr) return siblingRet;
-
-		// Recurse into children
-		return searchTransforms(
-			REInvokePtr<REApi::ManagedObject>(node, "get_Child", {}),
-			targetName, 
-			depth + 1, maxDepth,
-			0, maxBreadth);
+		return searchHierarchy(
+			root,
+			[&](REApi::ManagedObject* node) {
+				REApi::ManagedObject* gameObject = REInvokePtr<REApi::ManagedObject>(node, "get_GameObject", {});
+				if (gameObject == nullptr) return HierarchyVisit::PRUNE;
+				return REInvokeStrView(gameObject, "get_Name", {}) == targetName ? HierarchyVisit::MATCH : HierarchyVisit::CONTINUE;
+			},
+			[](REApi::ManagedObject* node) { return REInvokePtr<REApi::ManagedObject>(node, "get_Child", {}); },
+			[](REApi::ManagedObject* node) { return REInvokePtr<REApi::ManagedObject>(node, "get_Next", {}); },
+			maxDepth, maxBreadth
+		);
 	}
 
 	inline REApi::ManagedObject* findTransform(
-		REApi::ManagedObject* rootTransform, 
+		REApi::ManagedObject* rootTransform,
 		const std::string& name
 	) {
 		if (rootTransform == nullptr) return nullptr;
@@ -61,6 +56,44 @@ namespace kbf {
 		return ptr;
 	}
 
+	// As above, but memoizes where `name` sits under roots sharing `structureKey` (a prefab path, armour, etc.), so later
+	//  lookups are a short walk down the remembered child indices & a name check, instead of a managed string + find.
+	//  Paths that measure slower to walk than a find are left to the find (see TransformPathCache).
+	inline REApi::ManagedObject* findTransform(
+		REApi::ManagedObject* rootTransform,
+		std::string_view name,
+		std::string_view structureKey
+	) {
+		if (rootTransform == nullptr) return nullptr;
+
+		const uint64_t key = TransformPathCache::makeKey(structureKey, name);
+		TransformPath path{};
+		const bool known   = TRANSFORM_PATH_CACHE.get(key, path);
+		const bool skipped = known && !TRANSFORM_PATH_CACHE.worthWalking(path);
+		if (known && !skipped) {
+			const auto walkStart = TransformPathCache::Clock::now();
+			REApi::ManagedObject* cached = TransformPathCache::walk(rootTransform, path);
+			if (cached != nullptr && transformNameEquals(cached, name)) {
+				// Only full walks are timed - a stale one may have stopped short.
+				TRANSFORM_PATH_CACHE.recordWalk(path, TransformPathCache::Clock::now() - walkStart);
+				TRANSFORM_PATH_CACHE.recordHit();
+				return cached;
+			}
+			TRANSFORM_PATH_CACHE.recordStale();
+		}
+		else if (skipped) {
+			TRANSFORM_PATH_CACHE.recordSkip();
+		}
+
+		const auto findStart = TransformPathCache::Clock::now();
+		REApi::ManagedObject* found = findTransform(rootTransform, std::string(name));
+		TRANSFORM_PATH_CACHE.recordFind(TransformPathCache::Clock::now() - findStart);
+
+		// A skipped path was still good - no need to walk the hierarchy back up to rebuild it.
+		if (found != nullptr && !skipped && TransformPathCache::buildPath(rootTransform, found, path)) TRANSFORM_PATH_CACHE.set(key, path);
+		return found;
+	}
+
 	inline std::vector<REApi::ManagedObject*> getAllTransformComponents(
 		REApi::ManagedObject* gameobject
 	) {
@@ -79,10 +112,10 @@ namespace kbf {
 		for (size_t i = 0; i < length; i++) {
 			REApi::ManagedObject* t = REInvokePtr<REApi::ManagedObject>(compArr, "GetValue(System.Int32)", { (void*)i });
 			if (t != nullptr) transforms.push_back(t);
-			if (t != nullptr) DEBUG_STACK.fpush("Transform: {}", REInvokeStr(t, "ToString()", {}));
+			if (t != nullptr) DEBUG_STACK_LOG(DebugStack::Color::COL_DEBUG, "Transform: {}", REInvokeStr(t, "ToString()", {}));
 		}
 
 		return transforms;
 	}
 
-}
\ No newline at end of file
+}
@@ -24,17 +24,17 @@ namespace kbf {
     ) {
         #if defined(ENABLE_REINVOKE_LOGGING) && defined(REINVOKE_LOGGING_LEVEL_NULL) && defined(REINVOKE_LOGGING_LEVEL_ERROR)
         if (caller->get_type_definition() == nullptr) {
-            DEBUG_STACK.push(std::format("Failed to fetch function type definition for method {}", methodName), DebugStack::Color::COL_ERROR);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_ERROR, "Failed to fetch function type definition for method {}", methodName);
         }
         else if (caller->get_type_definition()->find_method(methodName) == nullptr) {
-            DEBUG_STACK.push(std::format("Failed to find method {}. Caller object has the following fields and methods:\n{}", methodName, reObjectPropertiesToString(caller)), DebugStack::Color::COL_ERROR);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_ERROR, "Failed to find method {}. Caller object has the following fields and methods:\n{}", methodName, reObjectPropertiesToString(caller));
         }
         #endif
 
         reframework::InvokeRet ret = caller->invoke(methodName, args);
 
         if (ret.exception_thrown) {
-            DEBUG_STACK.push(std::format("{} REInvokeGuid: {} threw an exception!", REINVOKE_LOG_TAG, methodName), DebugStack::Color::COL_DEBUG);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_DEBUG, "{} REInvokeGuid: {} threw an exception!", REINVOKE_LOG_TAG, methodName);
         }
 
         Guid guid;
@@ -56,7 +56,7 @@ namespace kbf {
         reframework::API::TypeDefinition* callerType = reframework::API::get()->tdb()->find_type(callerTypeName);
         #if defined(ENABLE_REINVOKE_LOGGING) && defined(REINVOKE_LOGGING_LEVEL_NULL) && defined(REINVOKE_LOGGING_LEVEL_ERROR)
         if (callerType == nullptr) {
-            DEBUG_STACK.push(std::format("Failed to fetch caller type definition: {}", callerTypeName), DebugStack::Color::COL_ERROR);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_ERROR, "Failed to fetch caller type definition: {}", callerTypeName);
         }
         #endif
         if (callerType == nullptr) return "ERR: Null caller type!";
@@ -64,7 +64,7 @@ namespace kbf {
         reframework::API::Method* callerMethod = callerType->find_method(methodName);
         #if defined(ENABLE_REINVOKE_LOGGING) && defined(REINVOKE_LOGGING_LEVEL_NULL) && defined(REINVOKE_LOGGING_LEVEL_ERROR)
         if (callerMethod == nullptr) {
-            DEBUG_STACK.push(std::format("Failed to find method {}. {} has the following properties:\n{}", methodName, callerTypeName, reTypePropertiesToString(callerType)), DebugStack::Color::COL_ERROR);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_ERROR, "Failed to find method {}. {} has the following properties:\n{}", methodName, callerTypeName, reTypePropertiesToString(callerType));
         }
         #endif
 		if (callerMethod == nullptr) return "ERR: Null caller method!";
@@ -72,7 +72,7 @@ namespace kbf {
         reframework::InvokeRet ret = callerMethod->invoke(nullptr, args);
 
         if (ret.exception_thrown) {
-            DEBUG_STACK.push(std::format("{} REInvokeGuidStatic: {} threw an exception!", REINVOKE_LOG_TAG, methodName), DebugStack::Color::COL_DEBUG);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_DEBUG, "{} REInvokeGuidStatic: {} threw an exception!", REINVOKE_LOG_TAG, methodName);
         }
 
         Guid guid;
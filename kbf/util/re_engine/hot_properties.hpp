@@ -0,0 +1,17 @@
+#pragma once
+
+#include <kbf/util/re_engine/direct_property.hpp>
+
+namespace kbf {
+
+    // Getters read for every tracked character, every frame. Resolved to direct field reads where possible (see DirectProperty).
+
+    inline DirectProperty<bool>     HUNTER_CHARACTER_IS_SET_UP       { "app.HunterCharacter", "get_IsSetUp",        InvokeReturnType::BOOL  };
+    inline DirectProperty<bool>     HUNTER_CHARACTER_IS_WEAPON_ON    { "app.HunterCharacter", "get_IsWeaponOn",     InvokeReturnType::BOOL  };
+    inline DirectProperty<bool>     HUNTER_CHARACTER_IS_COMBAT       { "app.HunterCharacter", "get_IsCombat",       InvokeReturnType::BOOL  };
+    inline DirectProperty<bool>     HUNTER_CHARACTER_IS_IN_ALL_TENT  { "app.HunterCharacter", "get_IsInAllTent",    InvokeReturnType::BOOL  };
+    inline DirectProperty<bool>     HUNTER_CHARACTER_IS_PORTER_RIDING{ "app.HunterCharacter", "get_IsPorterRiding", InvokeReturnType::BOOL  };
+    inline DirectProperty<uint32_t> HUNTER_CHARACTER_USED_ITEM_ID    { "app.HunterCharacter", "get_UsedItemID",     InvokeReturnType::DWORD };
+    inline DirectProperty<bool>     MOTION_SKIP_UPDATE               { "via.motion.Motion",   "get_SkipUpdate",     InvokeReturnType::BOOL  };
+
+}
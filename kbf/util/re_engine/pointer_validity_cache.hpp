@@ -0,0 +1,99 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace kbf {
+
+    // Remembers which characters' engine pointer sets (see areSetPointersValid) were checked, so they're only re-checked
+    //  when something could have changed them. A slot is checked again when:
+    //   - it's invalidated (new persistent info, slot cleared, basic info refetched onto a different transform),
+    //   - its root pointer (the character's Transform) isn't the one the last check ran against - compared every frame,
+    //   - the epoch moves on (invalidateAll - scene changes, equips, warps), or
+    //   - its periodic sweep comes round, every `sweepInterval` frames. Sweeps are phase-shifted per slot so a full
+    //     lobby spreads its re-checks over the interval instead of doing them all on one frame.
+    //  invalidateAll may be called from any thread (hooks); everything else is update thread only.
+    class PointerValidityCache {
+    public:
+        struct Stats {
+            uint64_t checks           = 0;
+            uint64_t skipped          = 0; // Checks avoided
+            uint64_t failed           = 0;
+            uint64_t checksLastFrame  = 0;
+            uint64_t skippedLastFrame = 0;
+        };
+
+        explicit PointerValidityCache(size_t pointersPerCheck) : pointersPerCheck{ pointersPerCheck } {}
+
+        void resize(size_t slotCount) { slots.resize(slotCount); }
+        size_t size() const { return slots.size(); }
+
+        // Call once per frame, before any needsCheck. An interval of 0 re-checks every slot every frame.
+        void beginFrame(int sweepInterval) {
+            frame++;
+            interval = static_cast<uint64_t>(std::max(sweepInterval, 0));
+            stats.checksLastFrame  = checksThisFrame;
+            stats.skippedLastFrame = skippedThisFrame;
+            checksThisFrame  = 0;
+            skippedThisFrame = 0;
+        }
+
+        bool needsCheck(size_t i, const void* root) {
+            const SlotState& slot = slots[i];
+            const bool due = interval == 0
+                || slot.root != root
+                || slot.validEpoch != epoch.load(std::memory_order_acquire)
+                || frame >= slot.nextSweep;
+
+            if (due) { stats.checks++;  checksThisFrame++;  }
+            else     { stats.skipped++; skippedThisFrame++; }
+            return due;
+        }
+
+        // Record the result of a check needsCheck asked for, made against the pointer set hanging off `root`.
+        void recordCheck(size_t i, bool valid, const void* root) {
+            SlotState& slot = slots[i];
+            if (!valid) {
+                stats.failed++;
+                slot = SlotState{};
+                return;
+            }
+
+            // Next frame where (frame + phase) lands on a multiple of the interval - at most one interval away.
+            slot.validEpoch = epoch.load(std::memory_order_acquire);
+            slot.root       = root;
+            if (interval > 0) {
+                const uint64_t phase = (static_cast<uint64_t>(i) * 0x9E3779B1u) % interval;
+                slot.nextSweep = frame + interval - ((frame + phase) % interval);
+            }
+        }
+
+        void invalidate(size_t i) { if (i < slots.size()) slots[i] = SlotState{}; }
+        void invalidateAll() { epoch.fetch_add(1, std::memory_order_acq_rel); }
+
+        const Stats& getStats() const { return stats; }
+        size_t getPointersPerCheck() const { return pointersPerCheck; }
+        uint32_t getEpoch() const { return epoch.load(std::memory_order_relaxed); }
+
+    private:
+        struct SlotState {
+            uint32_t validEpoch = 0; // 0 = never checked, the live epoch starts at 1
+            uint64_t nextSweep  = 0;
+            const void* root    = nullptr;
+        };
+
+        const size_t pointersPerCheck;
+        std::vector<SlotState> slots;
+        std::atomic<uint32_t> epoch{ 1 };
+        uint64_t frame    = 0;
+        uint64_t interval = 0;
+
+        Stats stats{};
+        uint64_t checksThisFrame  = 0;
+        uint64_t skippedThisFrame = 0;
+    };
+
+}
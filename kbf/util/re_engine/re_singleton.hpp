@@ -48,10 +48,10 @@ namespace kbf {
                 if (m_instance == nullptr) return false;
 
                 if (!checkREPtrValidity(m_instance, m_typedef)) {
-                    DEBUG_STACK.push(std::format(
+                    DEBUG_STACK.fpush(
                         "{} Failed to get singleton instance for {}",
                         RE_SINGLETON_LOG_TAG, m_name
-                    ));
+                    );
 
                     m_instance = nullptr;
                     return false;
@@ -83,10 +83,10 @@ namespace kbf {
                 m_instance = reframework::API::get()->get_native_singleton(m_name.c_str());
 
                 if (m_instance == nullptr) {
-                    DEBUG_STACK.push(std::format(
+                    DEBUG_STACK.fpush(
                         "{} Failed to get native singleton instance for {}",
                         RE_NATIVE_SINGLETON_LOG_TAG, m_name
-                    ));
+                    );
                     return false;
                 }
             }
@@ -3,12 +3,16 @@
 #include <reframework/API.hpp>
 
 #include <kbf/debug/debug_stack.hpp>
+#include <kbf/profiling/engine_call_stats.hpp>
 #include <kbf/util/re_engine/string_types.hpp>
 #include <kbf/util/re_engine/re_object_properties_to_string.hpp>
 #include <kbf/util/string/cvt_utf16_utf8.hpp>
+#include <kbf/util/string/utf16_to_utf8.hpp>
 #include <kbf/util/string/ptr_to_hex_string.hpp>
 
 #include <string_view>
+#include <initializer_list>
+#include <vector>
 #include <cstdint>
 
 #define REINVOKE_LOG_TAG "[REInvoke]"
@@ -41,32 +45,41 @@ namespace kbf {
         std::string methodName,
         std::vector<void*> args
     ) {
+        EngineCallTimer callTimer{};
+
         reframework::API::TypeDefinition* callerType = reframework::API::get()->tdb()->find_type(callerTypeName);
         #if defined(ENABLE_REINVOKE_LOGGING) && defined(REINVOKE_LOGGING_LEVEL_NULL) && defined(REINVOKE_LOGGING_LEVEL_ERROR)
         if (callerType == nullptr) {
-            DEBUG_STACK.push(std::format("Failed to fetch caller type definition: {}", callerTypeName), DebugStack::Color::COL_ERROR);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_ERROR, "Failed to fetch caller type definition: {}", callerTypeName);
         }
         #endif
-        if (callerType == nullptr) return nullptr;
+        if (callerType == nullptr) {
+            callTimer.finish(nullptr, methodName, true);
+            return nullptr;
+        }
 
         reframework::API::Method* callerMethod = callerType->find_method(methodName);
         #if defined(ENABLE_REINVOKE_LOGGING) && defined(REINVOKE_LOGGING_LEVEL_NULL) && defined(REINVOKE_LOGGING_LEVEL_ERROR)
         if (callerMethod == nullptr) {
-            DEBUG_STACK.push(std::format("Failed to find method {}. {} has the following properties:\n{}", methodName, callerTypeName, reTypePropertiesToString(callerType)), DebugStack::Color::COL_ERROR);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_ERROR, "Failed to find method {}. {} has the following properties:\n{}", methodName, callerTypeName, reTypePropertiesToString(callerType));
         }
         #endif
-		if (callerMethod == nullptr) return nullptr;
+		if (callerMethod == nullptr) {
+            callTimer.finish(callerType, methodName, true);
+            return nullptr;
+        }
         
         reframework::InvokeRet ret = callerMethod->invoke(nullptr, args);
+        callTimer.finish(callerType, methodName, ret.exception_thrown);
 
         #if defined(ENABLE_REINVOKE_LOGGING) && defined(REINVOKE_LOGGING_LEVEL_NULL) && defined(REINVOKE_LOGGING_LEVEL_WARNING)
         if (ret.ptr == nullptr) {
-            DEBUG_STACK.push(std::format("{} REInvokePtr: {} returned nullptr", REINVOKE_LOG_TAG, methodName), DebugStack::Color::WARNING);
+            DEBUG_STACK.fpush(DebugStack::Color::WARNING, "{} REInvokePtr: {} returned nullptr", REINVOKE_LOG_TAG, methodName);
         }
         #endif
 
         if (ret.exception_thrown) {
-            DEBUG_STACK.push(std::format("{} REInvokePtr: {} threw an exception!", REINVOKE_LOG_TAG, methodName), DebugStack::Color::COL_DEBUG);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_DEBUG, "{} REInvokePtr: {} threw an exception!", REINVOKE_LOG_TAG, methodName);
         }
 
         return (castType*)(ret.ptr); // I *think* this is ok, but may need (castType*)&ret? ??
@@ -79,26 +92,35 @@ namespace kbf {
         std::vector<void*> args,
         InvokeReturnType returnType
     ) {
+        EngineCallTimer callTimer{};
+
         reframework::API::TypeDefinition* callerType = reframework::API::get()->tdb()->find_type(callerTypeName);
         #if defined(ENABLE_REINVOKE_LOGGING) && defined(REINVOKE_LOGGING_LEVEL_NULL) && defined(REINVOKE_LOGGING_LEVEL_ERROR)
         if (callerType == nullptr) {
-            DEBUG_STACK.push(std::format("Failed to fetch caller type definition: {}", callerTypeName), DebugStack::Color::COL_ERROR);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_ERROR, "Failed to fetch caller type definition: {}", callerTypeName);
         }
         #endif
-        if (callerType == nullptr) return castType{};
+        if (callerType == nullptr) {
+            callTimer.finish(nullptr, methodName, true);
+            return castType{};
+        }
 
         reframework::API::Method* callerMethod = callerType->find_method(methodName);
         #if defined(ENABLE_REINVOKE_LOGGING) && defined(REINVOKE_LOGGING_LEVEL_NULL) && defined(REINVOKE_LOGGING_LEVEL_ERROR)
         if (callerMethod == nullptr) {
-            DEBUG_STACK.push(std::format("Failed to find method {}. {} has the following properties:\n{}", methodName, callerTypeName, reTypePropertiesToString(callerType)), DebugStack::Color::COL_ERROR);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_ERROR, "Failed to find method {}. {} has the following properties:\n{}", methodName, callerTypeName, reTypePropertiesToString(callerType));
         }
         #endif
-        if (callerMethod == nullptr) return castType{};
+        if (callerMethod == nullptr) {
+            callTimer.finish(callerType, methodName, true);
+            return castType{};
+        }
         
         reframework::InvokeRet ret = callerMethod->invoke(nullptr, args);
+        callTimer.finish(callerType, methodName, ret.exception_thrown);
 
         if (ret.exception_thrown) {
-            DEBUG_STACK.push(std::format("{} REInvokeStatic: {} threw an exception!", REINVOKE_LOG_TAG, methodName), DebugStack::Color::COL_DEBUG);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_DEBUG, "{} REInvokeStatic: {} threw an exception!", REINVOKE_LOG_TAG, methodName);
         }
 
         switch (returnType) {
@@ -130,7 +152,7 @@ namespace kbf {
     ) {
         REApi::TypeDefinition* callerTypeDef = caller->get_type_definition();
         if (callerTypeDef == nullptr) {
-            DEBUG_STACK.push(std::format("Failed to fetch caller type definition for field {}", fieldName), DebugStack::Color::COL_ERROR);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_ERROR, "Failed to fetch caller type definition for field {}", fieldName);
             return nullptr;
         }
 
@@ -139,13 +161,13 @@ namespace kbf {
 
 		REApi::Field* field = callerTypeDef->find_field(fieldName);
         if (field == nullptr) {
-            DEBUG_STACK.push(std::format("Failed to find field {}. Caller object has the following fields and methods:\n{}", fieldName, reObjectPropertiesToString(caller)), DebugStack::Color::COL_ERROR);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_ERROR, "Failed to find field {}. Caller object has the following fields and methods:\n{}", fieldName, reObjectPropertiesToString(caller));
             return nullptr;
         }
 
 		REApi::TypeDefinition* fieldTypeDef = field->get_type();
 		if (fieldTypeDef == nullptr) {
-            DEBUG_STACK.push(std::format("Failed to fetch field type definition for field {}", fieldName), DebugStack::Color::COL_ERROR);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_ERROR, "Failed to fetch field type definition for field {}", fieldName);
             return nullptr;
         }
 
@@ -194,17 +216,19 @@ namespace kbf {
     ) {
         #if defined(ENABLE_REINVOKE_LOGGING) && defined(REINVOKE_LOGGING_LEVEL_NULL) && defined(REINVOKE_LOGGING_LEVEL_ERROR)
         if (caller->get_type_definition() == nullptr) {
-            DEBUG_STACK.push(std::format("Failed to fetch function type definition for method {}", methodName), DebugStack::Color::COL_ERROR);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_ERROR, "Failed to fetch function type definition for method {}", methodName);
         }
         else if (caller->get_type_definition()->find_method(methodName) == nullptr) {
-            DEBUG_STACK.push(std::format("Failed to find method {}. Caller object has the following fields and methods:\n{}", methodName, reObjectPropertiesToString(caller)), DebugStack::Color::COL_ERROR);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_ERROR, "Failed to find method {}. Caller object has the following fields and methods:\n{}", methodName, reObjectPropertiesToString(caller));
         }
         #endif
 
+        EngineCallTimer callTimer{};
         reframework::InvokeRet ret = caller->invoke(methodName, args);
+        if (callTimer.active()) callTimer.finish(caller->get_type_definition(), methodName, ret.exception_thrown);
 
         if (ret.exception_thrown) {
-            DEBUG_STACK.push(std::format("{} REInvoke: {} threw an exception!", REINVOKE_LOG_TAG, methodName), DebugStack::Color::COL_DEBUG);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_DEBUG, "{} REInvoke: {} threw an exception!", REINVOKE_LOG_TAG, methodName);
         }
 
         switch (returnType) {
@@ -237,28 +261,50 @@ namespace kbf {
     ) {
         #if defined(ENABLE_REINVOKE_LOGGING) && defined(REINVOKE_LOGGING_LEVEL_NULL) && defined(REINVOKE_LOGGING_LEVEL_ERROR)
         if (caller->get_type_definition() == nullptr) {
-            DEBUG_STACK.push(std::format("Failed to fetch function type definition for method {}", methodName), DebugStack::Color::COL_ERROR);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_ERROR, "Failed to fetch function type definition for method {}", methodName);
         }
         else if (caller->get_type_definition()->find_method(methodName) == nullptr) {
-            DEBUG_STACK.push(std::format("Failed to find method {}. Caller object has the following fields and methods:\n{}", methodName, reObjectPropertiesToString(caller)), DebugStack::Color::COL_ERROR);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_ERROR, "Failed to find method {}. Caller object has the following fields and methods:\n{}", methodName, reObjectPropertiesToString(caller));
         }
         #endif
 
+        EngineCallTimer callTimer{};
         reframework::InvokeRet ret = caller->invoke(methodName, args);
+        if (callTimer.active()) callTimer.finish(caller->get_type_definition(), methodName, ret.exception_thrown);
 
         #if defined(ENABLE_REINVOKE_LOGGING) && defined(REINVOKE_LOGGING_LEVEL_NULL) && defined(REINVOKE_LOGGING_LEVEL_WARNING)
         if (ret.ptr == nullptr) {
-            DEBUG_STACK.push(std::format("{} REInvokePtr: {} returned nullptr", REINVOKE_LOG_TAG, methodName), DebugStack::Color::COL_WARNING);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} REInvokePtr: {} returned nullptr", REINVOKE_LOG_TAG, methodName);
         }
         #endif
 
         if (ret.exception_thrown) {
-            DEBUG_STACK.push(std::format("{} REInvokePtr: {} threw an exception!", REINVOKE_LOG_TAG, methodName), DebugStack::Color::COL_DEBUG);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_DEBUG, "{} REInvokePtr: {} threw an exception!", REINVOKE_LOG_TAG, methodName);
         }
 
         return (castType*)(ret.ptr); // I *think* this is ok, but may need (castType*)&ret? ??
 	}
 
+    /*
+    Note that the layout of a managed string in Il2Cpp is as follows (I think):
+
+        [0x00] Il2CppClass* klass
+        [0x08] MonitorData* monitor
+        [0x10] int32_t m_stringLength
+        [0x14] char16_t m_firstChar
+               char16_t char[1..256]
+
+    */
+    inline bool getManagedStringChars(reframework::API::ManagedObject* managedStr, const char16_t*& outChars, size_t& outLength) {
+        int32_t length = *(int32_t*)((uint8_t*)managedStr + /*offset to m_stringLength*/ 0x10);
+        const char16_t* chars = (const char16_t*)((uint8_t*)managedStr + /*offset to firstChar*/ 0x14);
+        if (!chars || length <= 0) return false;
+
+        outChars  = chars;
+        outLength = static_cast<size_t>(length);
+        return true;
+    }
+
     // Unwrap ManagedObject* to std::string
     inline std::string REInvokeStr(
         reframework::API::ManagedObject* caller,
@@ -268,24 +314,29 @@ namespace kbf {
 		reframework::API::ManagedObject* ret = REInvokePtr<reframework::API::ManagedObject>(caller, methodName, args);
 		if (ret == nullptr) return "ERROR: REInvokeStr Returned NULLPTR!";
 
-        /*
-		Note that the layout of a managed string in Il2Cpp is as follows (I think):
+        const char16_t* chars = nullptr;
+        size_t length = 0;
+        if (!getManagedStringChars(ret, chars, length)) return {};
 
-            [0x00] Il2CppClass* klass
-            [0x08] MonitorData* monitor
-            [0x10] int32_t m_stringLength
-            [0x14] char16_t m_firstChar
-                   char16_t char[1..256]
+        // Convert UTF-16 -> UTF-8 directly from the managed string's storage
+		return cvt_utf16_to_utf8(chars, length);
+    }
 
-        */
+    // As REInvokeStr, but transcodes into a per-thread scratch buffer rather than allocating.
+    // The view is invalidated by the next REInvokeStrView call on this thread - copy it if it needs to outlive that.
+    inline std::string_view REInvokeStrView(
+        reframework::API::ManagedObject* caller,
+        std::string methodName,
+        std::vector<void*> args
+    ) {
+        reframework::API::ManagedObject* ret = REInvokePtr<reframework::API::ManagedObject>(caller, methodName, args);
+        if (ret == nullptr) return "ERROR: REInvokeStrView Returned NULLPTR!";
 
-        int32_t length = *(int32_t*)((uint8_t*)ret + /*offset to m_stringLength*/ 0x10);
-        const char16_t* chars = (const char16_t*)((uint8_t*)ret + /*offset to firstChar*/ 0x14);
-        if (!chars || length <= 0) return {};
+        const char16_t* chars = nullptr;
+        size_t length = 0;
+        if (!getManagedStringChars(ret, chars, length)) return {};
 
-        // Convert UTF-16 -> UTF-8
-        std::u16string utf16(chars, chars + length);
-		return cvt_utf16_to_utf8(utf16);
+        return utf16ToUtf8Scratch(chars, length);
     }
 
     inline std::string REInvokeStaticStr(
@@ -293,47 +344,60 @@ namespace kbf {
         std::string methodName,
         std::vector<void*> args
     ) {
+        // Resolved up front so the lookup isn't counted against the call itself.
+        REApi::TypeDefinition* statsType = ENGINE_CALL_STATS.isEnabled() ? REApi::get()->tdb()->find_type(callerTypeName) : nullptr;
+        EngineCallTimer callTimer{};
+
         REApi::Method* fn = REApi::get()->tdb()->find_method(callerTypeName, methodName);
         if (fn == nullptr) {
-            DEBUG_STACK.push(std::format("{} REInvokeStaticStr: Failed to find method {}::{}", REINVOKE_LOG_TAG, callerTypeName, methodName), DebugStack::Color::COL_ERROR);
+            callTimer.finish(statsType, methodName, true);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_ERROR, "{} REInvokeStaticStr: Failed to find method {}::{}", REINVOKE_LOG_TAG, callerTypeName, methodName);
 			return "ERR: Null Method!";
         }
 
         reframework::InvokeRet ret = fn->invoke(nullptr, args);
+        callTimer.finish(statsType, methodName, ret.exception_thrown);
 
         REApi::ManagedObject* managedStr = (REApi::ManagedObject*)ret.ptr;
         if (managedStr == nullptr) {
-            DEBUG_STACK.push(std::format("{} Return value was nullptr for call: {}::{}", REINVOKE_LOG_TAG, callerTypeName, methodName), DebugStack::Color::COL_WARNING);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "{} Return value was nullptr for call: {}::{}", REINVOKE_LOG_TAG, callerTypeName, methodName);
             return "ERR: Null ManagedStr!";
         }
 
-        int32_t length = *(int32_t*)((uint8_t*)managedStr + /*offset to m_stringLength*/ 0x10);
-        const char16_t* chars = (const char16_t*)((uint8_t*)managedStr + /*offset to firstChar*/ 0x14);
-        if (!chars || length <= 0) return {};
+        const char16_t* chars = nullptr;
+        size_t length = 0;
+        if (!getManagedStringChars(managedStr, chars, length)) return {};
 
         // Convert UTF-16 -> UTF-8
-        std::u16string utf16(chars, chars + length);
-        return cvt_utf16_to_utf8(utf16);
+        return cvt_utf16_to_utf8(chars, length);
     }
 
+    // Called for every part / material / visibility write, every frame - so unlike the other REInvoke calls it takes
+    //  the method name as a view (names must be null terminated, e.g. literals) and copies the arguments into a
+    //  per-thread buffer that keeps its capacity, instead of building a fresh std::string & std::vector per call.
     inline void REInvokeVoid(
         reframework::API::ManagedObject* caller,
-        std::string methodName,
-        std::vector<void*> args
+        std::string_view methodName,
+        std::initializer_list<void*> argList
     ) {
+        thread_local std::vector<void*> args;
+        args.assign(argList);
+
         #if defined(ENABLE_REINVOKE_LOGGING) && defined(REINVOKE_LOGGING_LEVEL_NULL) && defined(REINVOKE_LOGGING_LEVEL_ERROR)
         if (caller->get_type_definition() == nullptr) {
-            DEBUG_STACK.push(std::format("Failed to fetch function type definition for method {}", methodName), DebugStack::Color::COL_ERROR);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_ERROR, "Failed to fetch function type definition for method {}", methodName);
         }
         else if (caller->get_type_definition()->find_method(methodName) == nullptr) {
-            DEBUG_STACK.push(std::format("Failed to find method {}. Caller object has the following fields and methods:\n{}", methodName, reObjectPropertiesToString(caller)), DebugStack::Color::COL_ERROR);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_ERROR, "Failed to find method {}. Caller object has the following fields and methods:\n{}", methodName, reObjectPropertiesToString(caller));
         }
         #endif
 
+        EngineCallTimer callTimer{};
         reframework::InvokeRet ret = caller->invoke(methodName, args);
+        if (callTimer.active()) callTimer.finish(caller->get_type_definition(), methodName, ret.exception_thrown);
 
         if (ret.exception_thrown) {
-            DEBUG_STACK.push(std::format("{} REInvokeVoid: {} threw an exception!", REINVOKE_LOG_TAG, methodName), DebugStack::Color::COL_DEBUG);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_DEBUG, "{} REInvokeVoid: {} threw an exception!", REINVOKE_LOG_TAG, methodName);
         }
 	}
 
@@ -343,21 +407,21 @@ namespace kbf {
         bool& success
     ) {
         if (typeDef == nullptr) {
-            DEBUG_STACK.push(std::format("Recieved null type definition for enum value @ {}", name), DebugStack::Color::COL_ERROR);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_ERROR, "Recieved null type definition for enum value @ {}", name);
             success = false;
             return 0;
         }
 
         bool isEnumType = typeDef->is_enum();
         if (!isEnumType) {
-            DEBUG_STACK.push(std::format("Attempted to fetch enum {} from {}, but the type is not an enum", name, typeDef->get_full_name()), DebugStack::Color::COL_ERROR);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_ERROR, "Attempted to fetch enum {} from {}, but the type is not an enum", name, typeDef->get_full_name());
             success = false;
             return 0;
 		}
 
         REApi::Field* field = typeDef->find_field(name);
         if (field == nullptr) {
-            DEBUG_STACK.push(std::format("Failed to find enum value {} for enum {}", name, typeDef->get_full_name()), DebugStack::Color::COL_ERROR);
+            DEBUG_STACK.fpush(DebugStack::Color::COL_ERROR, "Failed to find enum value {} for enum {}", name, typeDef->get_full_name());
             success = false;
             return 0;
         }
@@ -370,7 +434,7 @@ namespace kbf {
         case 2: { castData = static_cast<int>(*(int16_t*)data); break; }
         case 4: { castData = static_cast<int>(*(int32_t*)data); break; }
         case 8: { castData = static_cast<int>(*(int64_t*)data); break; }
-        default: DEBUG_STACK.push(std::format("Enum value {} of {} has unsupported underlying data size, it will be read as 0.", name, typeDef->get_full_name()), DebugStack::Color::COL_WARNING);
+        default: DEBUG_STACK.fpush(DebugStack::Color::COL_WARNING, "Enum value {} of {} has unsupported underlying data size, it will be read as 0.", name, typeDef->get_full_name());
         }
 
         success = true;
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <kbf/debug/memory_footprint.hpp>
+#include <kbf/util/hash/hash_combine.hpp>
+#include <kbf/util/re_engine/reinvoke.hpp>
+
+#include <reframework/API.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+namespace kbf {
+
+    // Where a transform sits under its root: at each level, how many get_Next hops from the first child.
+    struct TransformPath {
+        static constexpr size_t MAX_DEPTH   = 16;
+        static constexpr size_t MAX_BREADTH = UINT16_MAX;
+
+        uint8_t length = 0;
+        std::array<uint16_t, MAX_DEPTH> siblingIndices{};
+
+        // Managed calls a walk makes: a get_Child per level, a get_Next per sibling skipped, & the two for the name check.
+        size_t calls() const {
+            size_t total = 2;
+            for (uint8_t level = 0; level < length; level++) total += size_t{ 1 } + siblingIndices[level];
+            return total;
+        }
+    };
+
+    // Memoized transform paths, keyed by (structure, name). Prefab hierarchies are identical across every character
+    //  using them, so one resolve serves them all. Paths are always verified by name on use, so a stale or colliding
+    //  entry only costs a re-resolve.
+    //
+    //  A walk is one managed call per hop, so a transform far along a wide sibling chain can cost more than letting the
+    //  engine find it. Both are timed as they happen, and a path is only walked while its call count times the measured
+    //  per-call cost beats the measured find - paths past MAX_WALK_CALLS aren't stored at all.
+    class TransformPathCache : public iMemoryReporter {
+    public:
+        static constexpr size_t MAX_WALK_CALLS = 64;
+
+        using Clock = std::chrono::steady_clock;
+
+        static uint64_t makeKey(std::string_view structureKey, std::string_view name) {
+            size_t key = std::hash<std::string_view>{}(structureKey);
+            hashCombine(key, std::hash<std::string_view>{}(name));
+            return static_cast<uint64_t>(key);
+        }
+
+        bool get(uint64_t key, TransformPath& out) const {
+            std::lock_guard<std::mutex> lock(mux);
+            auto it = paths.find(key);
+            if (it == paths.end()) return false;
+            out = it->second;
+            return true;
+        }
+
+        // Paths too long to ever beat a find are dropped (along with any older entry for the key).
+        void set(uint64_t key, const TransformPath& path) {
+            std::lock_guard<std::mutex> lock(mux);
+            if (path.calls() > MAX_WALK_CALLS) paths.erase(key);
+            else                               paths[key] = path;
+        }
+
+        // Whether walking `path` is expected to be cheaper than a find. Walks until both costs have been measured.
+        bool worthWalking(const TransformPath& path) const {
+            const double perCall = walkNsPerCall.load(std::memory_order_relaxed);
+            const double find    = findNs.load(std::memory_order_relaxed);
+            if (perCall <= 0.0 || find <= 0.0) return true;
+            return perCall * static_cast<double>(path.calls()) < find;
+        }
+
+        void recordWalk(const TransformPath& path, Clock::duration elapsed) {
+            updateAverage(walkNsPerCall, toNs(elapsed) / static_cast<double>(path.calls()));
+        }
+        void recordFind(Clock::duration elapsed) { updateAverage(findNs, toNs(elapsed)); }
+
+        void clear() {
+            std::lock_guard<std::mutex> lock(mux);
+            paths.clear();
+        }
+
+        void recordHit()   { hits.fetch_add(1, std::memory_order_relaxed); }
+        void recordStale() { stale.fetch_add(1, std::memory_order_relaxed); }
+        void recordSkip()  { skipped.fetch_add(1, std::memory_order_relaxed); }
+        uint64_t getHits()    const { return hits.load(std::memory_order_relaxed); }
+        uint64_t getStale()   const { return stale.load(std::memory_order_relaxed); }
+        uint64_t getSkipped() const { return skipped.load(std::memory_order_relaxed); } // Paths left unwalked as too costly
+        double getWalkNsPerCall() const { return walkNsPerCall.load(std::memory_order_relaxed); }
+        double getFindNs()        const { return findNs.load(std::memory_order_relaxed); }
+
+        MemoryFootprint getMemoryFootprint() const override {
+            std::lock_guard<std::mutex> lock(mux);
+            return MemoryFootprint{ "Transform Path Cache", paths.size(), sizeof(*this) + footprint::hashContainerBytes(paths) };
+        }
+
+        // Follows `path` down from root. Returns nullptr if the hierarchy is shorter than the path expects.
+        static reframework::API::ManagedObject* walk(reframework::API::ManagedObject* root, const TransformPath& path) {
+            reframework::API::ManagedObject* node = root;
+            for (uint8_t level = 0; level < path.length && node != nullptr; level++) {
+                node = REInvokePtr<reframework::API::ManagedObject>(node, "get_Child", {});
+                for (uint16_t i = 0; i < path.siblingIndices[level] && node != nullptr; i++) {
+                    node = REInvokePtr<reframework::API::ManagedObject>(node, "get_Next", {});
+                }
+            }
+            return node;
+        }
+
+        // Works up from `node` to root via get_Parent. Fails if node isn't under root, or is too deep / wide to store.
+        static bool buildPath(reframework::API::ManagedObject* root, reframework::API::ManagedObject* node, TransformPath& out) {
+            out = TransformPath{};
+
+            reframework::API::ManagedObject* current = node;
+            while (current != root) {
+                if (out.length == TransformPath::MAX_DEPTH) return false;
+
+                reframework::API::ManagedObject* parent = REInvokePtr<reframework::API::ManagedObject>(current, "get_Parent", {});
+                if (parent == nullptr) return false;
+
+                size_t index = 0;
+                reframework::API::ManagedObject* sibling = REInvokePtr<reframework::API::ManagedObject>(parent, "get_Child", {});
+                while (sibling != nullptr && sibling != current && index < TransformPath::MAX_BREADTH) {
+                    sibling = REInvokePtr<reframework::API::ManagedObject>(sibling, "get_Next", {});
+                    index++;
+                }
+                if (sibling != current) return false;
+
+                out.siblingIndices[out.length++] = static_cast<uint16_t>(index);
+                current = parent;
+            }
+
+            // Collected leaf first.
+            std::reverse(out.siblingIndices.begin(), out.siblingIndices.begin() + out.length);
+            return true;
+        }
+
+    private:
+        static double toNs(Clock::duration elapsed) { return std::chrono::duration<double, std::nano>(elapsed).count(); }
+
+        // Exponential moving average, seeded by the first sample. Racing updates just lose a sample.
+        static void updateAverage(std::atomic<double>& average, double sample) {
+            constexpr double WEIGHT = 0.1;
+            const double current = average.load(std::memory_order_relaxed);
+            average.store(current <= 0.0 ? sample : current + (sample - current) * WEIGHT, std::memory_order_relaxed);
+        }
+
+        mutable std::mutex mux;
+        std::unordered_map<uint64_t, TransformPath> paths{};
+
+        std::atomic<uint64_t> hits{ 0 };
+        std::atomic<uint64_t> stale{ 0 };
+        std::atomic<uint64_t> skipped{ 0 };
+        std::atomic<double>   walkNsPerCall{ 0.0 };
+        std::atomic<double>   findNs{ 0.0 };
+    };
+
+    inline TransformPathCache TRANSFORM_PATH_CACHE{};
+
+}
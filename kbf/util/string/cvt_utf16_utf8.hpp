@@ -1,5 +1,7 @@
 #pragma once
 
+#include <kbf/util/string/utf16_to_utf8.hpp>
+
 #include <string>
 #include <Windows.h>
 
@@ -29,77 +31,18 @@ namespace kbf {
     }
 
 
-    inline std::string cvt_utf16_to_utf8(const std::u16string& input) {
-        if (input.empty()) return {};
-
-        // WideCharToMultiByte wants wchar_t* on Windows (UTF-16)
-        auto* utf16 = reinterpret_cast<LPCWCH>(input.data());
-
-        // First call: figure out required size in UTF-8 bytes
-        int utf8Len = WideCharToMultiByte(
-            CP_UTF8,
-            0,
-            utf16,
-            static_cast<int>(input.size()),
-            nullptr,
-            0,
-            nullptr,
-            nullptr
-        );
-
-        if (utf8Len <= 0) {
-            return {};
-        }
-
-        // Second call: actually convert
-        std::string utf8(utf8Len, '\0');
-        WideCharToMultiByte(
-            CP_UTF8,
-            0,
-            utf16,
-            static_cast<int>(input.size()),
-            utf8.data(),
-            utf8Len,
-            nullptr,
-            nullptr
-        );
-
-        return utf8;
+    inline std::string cvt_utf16_to_utf8(const char16_t* input, size_t length) {
+        if (input == nullptr || length == 0) return {};
+        return utf16ToUtf8(input, length);
     }
 
-    inline std::string cvt_utf16_to_utf8(const std::wstring & input) {
-        if (input.empty()) return {};
-
-        // First call: get required UTF-8 buffer size
-        int utf8Len = WideCharToMultiByte(
-            CP_UTF8,
-            0,
-            input.data(),
-            static_cast<int>(input.size()),
-            nullptr,
-            0,
-            nullptr,
-            nullptr
-        );
-
-        if (utf8Len <= 0) {
-            return {};
-        }
-
-        // Second call: actually convert
-        std::string utf8(utf8Len, '\0');
-        WideCharToMultiByte(
-            CP_UTF8,
-            0,
-            input.data(),
-            static_cast<int>(input.size()),
-            utf8.data(),
-            utf8Len,
-            nullptr,
-            nullptr
-        );
+    inline std::string cvt_utf16_to_utf8(const std::u16string& input) {
+        return cvt_utf16_to_utf8(input.data(), input.size());
+    }
 
-        return utf8;
+    inline std::string cvt_utf16_to_utf8(const std::wstring& input) {
+        static_assert(sizeof(wchar_t) == sizeof(char16_t), "cvt_utf16_to_utf8 expects 16-bit wchar_t");
+        return cvt_utf16_to_utf8(reinterpret_cast<const char16_t*>(input.data()), input.size());
 	}
 
     inline std::wstring cvt_utf8_to_utf16(const std::string& input) {
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+
+// KBF_UTF16_TO_UTF8_SCALAR_ONLY compiles the vector loops out - for the tests, which check each path on its own.
+#if (defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)) && !defined(KBF_UTF16_TO_UTF8_SCALAR_ONLY)
+#include <immintrin.h>
+#define KBF_UTF16_TO_UTF8_SSE2
+#if defined(__AVX2__)
+#define KBF_UTF16_TO_UTF8_AVX2
+#endif
+#endif
+
+namespace kbf {
+
+    // Worst case output size. A lone BMP code unit can expand to 3 bytes, and surrogate pairs produce 4 bytes from 2 units.
+    constexpr size_t utf16ToUtf8MaxBytes(size_t utf16Len) { return utf16Len * 3; }
+
+    namespace detail {
+
+        // Encodes the code point starting at src[i], returning how many code units it used (1, or 2 for a pair).
+        inline size_t utf16ToUtf8Scalar(const char16_t* src, size_t len, size_t i, char*& out) noexcept {
+            uint32_t cp = src[i];
+            if (cp < 0x80) {
+                *out++ = static_cast<char>(cp);
+                return 1;
+            }
+
+            if (cp < 0x800) {
+                *out++ = static_cast<char>(0xC0 | (cp >> 6));
+                *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+                return 1;
+            }
+
+            if (cp >= 0xD800 && cp <= 0xDFFF) {
+                const bool isHighSurrogate = cp <= 0xDBFF;
+                const bool hasLowSurrogate = i + 1 < len && src[i + 1] >= 0xDC00 && src[i + 1] <= 0xDFFF;
+
+                if (isHighSurrogate && hasLowSurrogate) {
+                    cp = 0x10000 + ((cp - 0xD800) << 10) + (static_cast<uint32_t>(src[i + 1]) - 0xDC00);
+                    *out++ = static_cast<char>(0xF0 | (cp >> 18));
+                    *out++ = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+                    *out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                    *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+                    return 2;
+                }
+
+                cp = 0xFFFD; // Unpaired surrogate
+            }
+
+            *out++ = static_cast<char>(0xE0 | (cp >> 12));
+            *out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+            return 1;
+        }
+
+        // The whole string one code point at a time - what the vector loops must always agree with.
+        inline size_t utf16ToUtf8ScalarOnly(const char16_t* src, size_t len, char* dst) noexcept {
+            char* out = dst;
+            for (size_t i = 0; i < len;) i += utf16ToUtf8Scalar(src, len, i, out);
+            return static_cast<size_t>(out - dst);
+        }
+
+        // Uninitialized output space that only ever grows, so transcoding into it never zero-fills anything.
+        struct Utf8Buffer {
+            std::unique_ptr<char[]> data;
+            size_t size = 0;
+
+            char* reserve(size_t bytes) {
+                if (size < bytes) {
+                    size = std::max<size_t>(bytes, 256);
+                    data = std::make_unique_for_overwrite<char[]>(size);
+                }
+                return data.get();
+            }
+        };
+
+    }
+
+    // Transcode UTF-16 -> UTF-8 into dst, which must have room for utf16ToUtf8MaxBytes(len) bytes.
+    // Returns the number of bytes written. Unpaired surrogates are replaced with U+FFFD, as WideCharToMultiByte does.
+    // Engine strings (joint, part, material & game object names, prefab paths) are almost always pure ASCII,
+    //  so runs of ASCII are narrowed 16 (AVX2) or 8 (SSE2) code units at a time before falling back to scalar.
+    inline size_t utf16ToUtf8(const char16_t* src, size_t len, char* dst) noexcept {
+        char* out = dst;
+        size_t i = 0;
+
+        while (i < len) {
+#if defined(KBF_UTF16_TO_UTF8_AVX2)
+            const __m256i nonAsciiMask256 = _mm256_set1_epi16(static_cast<short>(0xFF80));
+            while (i + 16 <= len) {
+                __m256i units = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                if (!_mm256_testz_si256(units, nonAsciiMask256)) break;
+
+                // packus works per 128-bit lane, so gather the two low qwords back together before storing
+                __m256i packed = _mm256_packus_epi16(units, units);
+                packed = _mm256_permute4x64_epi64(packed, 0b11011000);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm256_castsi256_si128(packed));
+
+                out += 16;
+                i   += 16;
+            }
+#endif
+#if defined(KBF_UTF16_TO_UTF8_SSE2)
+            const __m128i nonAsciiMask128 = _mm_set1_epi16(static_cast<short>(0xFF80));
+            const __m128i zero = _mm_setzero_si128();
+            while (i + 8 <= len) {
+                __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                __m128i high  = _mm_and_si128(units, nonAsciiMask128);
+                const unsigned asciiMask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi16(high, zero)));
+
+                // Stored even when the block isn't all ASCII - there's room (8 units left means at least 8 bytes left),
+                //  and anything past the ASCII prefix is overwritten by the scalar path.
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(units, units));
+
+                if (asciiMask == 0xFFFF) {
+                    out += 8;
+                    i   += 8;
+                    continue;
+                }
+
+                // Keep the ASCII units ahead of the first non-ASCII one (2 mask bits per unit)
+                const size_t asciiPrefix = static_cast<size_t>(std::countr_one(asciiMask)) / 2;
+                out += asciiPrefix;
+                i   += asciiPrefix;
+                break;
+            }
+#endif
+            if (i >= len) break;
+
+            // Encode the whole run of non-ASCII here - going back to the vector loops after every unit makes BMP &
+            //  emoji text slower than not vectorizing at all.
+            do {
+                i += detail::utf16ToUtf8Scalar(src, len, i, out);
+            } while (i < len && src[i] >= 0x80);
+        }
+
+        return static_cast<size_t>(out - dst);
+    }
+
+    // Transcode into a caller owned string, re-using its existing capacity. Sizing the string for the worst case up
+    //  front would zero-fill 3x the input on every call, so the output is written without initializing it first:
+    //  straight into the string where resize_and_overwrite exists, otherwise into a per-thread buffer that's then
+    //  copied over - one pass over the bytes actually written.
+    inline void utf16ToUtf8(const char16_t* src, size_t len, std::string& out) {
+#if defined(__cpp_lib_string_resize_and_overwrite)
+        out.resize_and_overwrite(utf16ToUtf8MaxBytes(len), [src, len](char* dst, size_t) noexcept {
+            return utf16ToUtf8(src, len, dst);
+        });
+#else
+        thread_local detail::Utf8Buffer buffer;
+        char* dst = buffer.reserve(utf16ToUtf8MaxBytes(len));
+        out.assign(dst, utf16ToUtf8(src, len, dst));
+#endif
+    }
+
+    inline std::string utf16ToUtf8(const char16_t* src, size_t len) {
+        std::string out;
+        utf16ToUtf8(src, len, out);
+        return out;
+    }
+
+    // Transcode into a per-thread scratch buffer. The returned view is only valid until the next call on the same thread,
+    //  so use this for compare-and-discard reads (e.g. matching game object names) and copy out anything that is kept.
+    inline std::string_view utf16ToUtf8Scratch(const char16_t* src, size_t len) {
+        thread_local detail::Utf8Buffer scratch;
+        char* dst = scratch.reserve(utf16ToUtf8MaxBytes(len));
+        return std::string_view(dst, utf16ToUtf8(src, len, dst));
+    }
+
+}
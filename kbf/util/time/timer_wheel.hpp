@@ -0,0 +1,210 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+namespace kbf {
+
+    // Hierarchical timer wheel for one-shot timers keyed by a dense id (e.g. a tracker slot index), at most one
+    //  pending timer per id. Scheduling, cancelling & expiring a timer are all O(1): timers sit in intrusive lists
+    //  bucketed by deadline, LEVELS wheels of SLOTS buckets each, every level SLOTS times coarser than the one below.
+    //  Far timers are moved down a level as the wheel below them wraps, and advancing skips straight over empty
+    //  buckets, so a long gap between frames costs a handful of steps rather than one per tick.
+    //  Timers fire no earlier than their deadline, at most one TICK late. Not thread safe.
+    class TimerWheel {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr std::chrono::milliseconds TICK{ 1 };
+        static constexpr size_t   SLOT_BITS = 6;
+        static constexpr size_t   SLOTS     = size_t{ 1 } << SLOT_BITS;
+        static constexpr size_t   LEVELS    = 4; // 64^4 ticks = ~4.6h max delay, longer ones are clamped
+        static constexpr uint32_t NONE      = std::numeric_limits<uint32_t>::max();
+
+        TimerWheel() { heads.fill(NONE); }
+
+        // Ids must be in [0, idCount). Cancels anything pending.
+        void resize(size_t idCount) {
+            nodes.assign(idCount, Node{});
+            cancelAll();
+        }
+
+        size_t size() const { return nodes.size(); }
+
+        // (Re)starts id's timer to fire once `delay` has passed since `now`.
+        void schedule(uint32_t id, Clock::time_point now, Clock::duration delay) {
+            if (id >= nodes.size()) return;
+            start(now);
+            if (nodes[id].bucket != NONE) unlink(id);
+            else                          pending++;
+
+            // Round up so it never fires early, & at least a tick out - the current tick has already been processed.
+            const uint64_t deadline = ticksAt(now + delay, true);
+            nodes[id].deadline = std::max(deadline, currentTick + 1);
+            insert(id);
+        }
+
+        bool cancel(uint32_t id) {
+            if (id >= nodes.size() || nodes[id].bucket == NONE) return false;
+            unlink(id);
+            pending--;
+            return true;
+        }
+
+        // Also restarts the wheel's clock from the next call, so a caller whose time starts over (a replay) can reuse it.
+        void cancelAll() {
+            heads.fill(NONE);
+            occupied.fill(0);
+            for (Node& node : nodes) node = Node{};
+            pending = 0;
+            started = false;
+        }
+
+        bool isPending(uint32_t id) const { return id < nodes.size() && nodes[id].bucket != NONE; }
+
+        std::optional<Clock::time_point> getDeadline(uint32_t id) const {
+            if (!isPending(id)) return std::nullopt;
+            return Clock::time_point{ std::chrono::duration_cast<Clock::duration>(TICK * nodes[id].deadline) };
+        }
+
+        // Fires every timer whose deadline is at or before `now`, calling onExpired(id) for each, & returns how many.
+        //  A timer's id is free to be rescheduled from inside the callback.
+        template <typename Fn>
+        size_t advance(Clock::time_point now, Fn&& onExpired) {
+            start(now);
+            const uint64_t target = ticksAt(now, false);
+
+            size_t fired = 0;
+            while (currentTick < target) {
+                if (pending == 0) {
+                    currentTick = target;
+                    break;
+                }
+
+                // Jump to whichever comes first: the next occupied bottom bucket, or the bottom wheel wrapping.
+                const uint64_t slot    = currentTick & (SLOTS - 1);
+                const uint64_t ahead   = slot + 1 < SLOTS ? occupied[0] >> (slot + 1) : 0;
+                const uint64_t toWrap  = SLOTS - slot;
+                const uint64_t step    = ahead != 0 ? std::min<uint64_t>(std::countr_zero(ahead) + 1, toWrap) : toWrap;
+                currentTick = std::min(currentTick + step, target);
+
+                if ((currentTick & (SLOTS - 1)) == 0) cascade();
+                fired += fire(currentTick & (SLOTS - 1), onExpired);
+            }
+            return fired;
+        }
+
+        size_t pendingCount() const { return pending; }
+        size_t getBytes() const { return nodes.capacity() * sizeof(Node); }
+
+    private:
+        struct Node {
+            uint64_t deadline = 0; // Ticks
+            uint32_t prev     = NONE;
+            uint32_t next     = NONE;
+            uint32_t bucket   = NONE; // level * SLOTS + slot, NONE when not pending
+        };
+
+        static uint64_t ticksAt(Clock::time_point time, bool roundUp) {
+            const auto sinceEpoch = time.time_since_epoch();
+            if (sinceEpoch.count() <= 0) return 0;
+
+            const uint64_t ticks = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(sinceEpoch) / TICK);
+            return (roundUp && Clock::duration{ TICK * ticks } < sinceEpoch) ? ticks + 1 : ticks;
+        }
+
+        void start(Clock::time_point now) {
+            if (started) return;
+            currentTick = ticksAt(now, false);
+            started     = true;
+        }
+
+        // Picks the lowest level whose span covers the deadline, so each timer moves down at most LEVELS - 1 times.
+        void insert(uint32_t id) {
+            Node& node = nodes[id];
+            const uint64_t maxDelta = (uint64_t{ 1 } << (SLOT_BITS * LEVELS)) - 1;
+            node.deadline = std::min(node.deadline, currentTick + maxDelta);
+
+            const uint64_t delta = node.deadline - currentTick;
+            size_t level = 0;
+            while (level + 1 < LEVELS && delta >= (uint64_t{ 1 } << (SLOT_BITS * (level + 1)))) level++;
+
+            const size_t slot   = (node.deadline >> (SLOT_BITS * level)) & (SLOTS - 1);
+            const size_t bucket = level * SLOTS + slot;
+
+            node.bucket = static_cast<uint32_t>(bucket);
+            node.prev   = NONE;
+            node.next   = heads[bucket];
+            if (node.next != NONE) nodes[node.next].prev = id;
+            heads[bucket] = id;
+            occupied[level] |= uint64_t{ 1 } << slot;
+        }
+
+        void unlink(uint32_t id) {
+            Node& node = nodes[id];
+            const size_t bucket = node.bucket;
+
+            if (node.prev != NONE) nodes[node.prev].next = node.next;
+            else                   heads[bucket]         = node.next;
+            if (node.next != NONE) nodes[node.next].prev = node.prev;
+
+            if (heads[bucket] == NONE) occupied[bucket / SLOTS] &= ~(uint64_t{ 1 } << (bucket % SLOTS));
+            node = Node{};
+        }
+
+        // The bottom wheel just wrapped - pull the next bucket of each level above down, stopping at the first level
+        //  that didn't wrap as well.
+        void cascade() {
+            for (size_t level = 1; level < LEVELS; level++) {
+                const size_t slot = (currentTick >> (SLOT_BITS * level)) & (SLOTS - 1);
+                const size_t bucket = level * SLOTS + slot;
+
+                uint32_t id = heads[bucket];
+                heads[bucket] = NONE;
+                occupied[level] &= ~(uint64_t{ 1 } << slot);
+
+                while (id != NONE) {
+                    const uint32_t next = nodes[id].next;
+                    insert(id);
+                    id = next;
+                }
+
+                if (slot != 0) break;
+            }
+        }
+
+        template <typename Fn>
+        size_t fire(size_t slot, Fn& onExpired) {
+            // Detach the whole bucket first so callbacks can reschedule into it safely.
+            uint32_t id = heads[slot];
+            heads[slot] = NONE;
+            occupied[0] &= ~(uint64_t{ 1 } << slot);
+
+            size_t fired = 0;
+            while (id != NONE) {
+                const uint32_t next = nodes[id].next;
+                nodes[id] = Node{};
+                pending--;
+                fired++;
+                onExpired(id);
+                id = next;
+            }
+            return fired;
+        }
+
+        std::vector<Node> nodes;
+        std::array<uint32_t, LEVELS * SLOTS> heads{};
+        std::array<uint64_t, LEVELS> occupied{};
+        uint64_t currentTick = 0;
+        size_t   pending     = 0;
+        bool     started     = false;
+    };
+
+}
@@ -2,6 +2,7 @@
 
 #include <kbf/hook/hook_manager.hpp>
 #include <kbf/debug/log_string.hpp>
+#include <kbf/debug/persistent_log.hpp>
 
 #include <Windows.h>
 
@@ -15,7 +16,13 @@ extern "C" {
     HOT_RELOAD_EXPORT void kbf_on_pre_update_motion() { kbf::onPreUpdateMotion(); }
     HOT_RELOAD_EXPORT void kbf_on_post_update_motion() { kbf::onPostUpdateMotion(); }
 	HOT_RELOAD_EXPORT void kbf_on_post_late_update_behavior() { kbf::onPostLateUpdateBehavior(); }
-    HOT_RELOAD_EXPORT void kbf_on_unload() { kbf::HookManager::remove_all(); }
+    HOT_RELOAD_EXPORT void kbf_on_unload() {
+        kbf::HookManager::remove_all();
+        // Join KBF's threads (the log sink, the apply planners) before the dll goes away, rather than from their
+        //  destructors under the loader lock.
+        kbf::onUnload();
+        kbf::PERSISTENT_LOG.stop();
+    }
     HOT_RELOAD_EXPORT void kbf_force_initialize_reframework(const REFrameworkPluginInitializeParam* param) {
         kbf::forceInitializeReframework(param);
 	}
@@ -15,4 +15,5 @@ namespace kbf {
 	inline void onPostUpdateMotion() { kbf::KBF::onPostUpdateMotion(); }
 	inline void onPostLateUpdateBehavior() { kbf::KBF::onPostLateUpdateBehavior(); }
 	inline void onDrawUi() { kbf::KBF::drawInstanceUI(); }
+	inline void onUnload() { kbf::KBF::onUnload(); }
 }
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include "kbf_bench.hpp"
+
+#include <kbf/profiling/cpu_profiler.hpp>
+#include <kbf/profiling/alloc_tracker.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace kbf;
+
+// Cost of the profiling macros - what every BEGIN / END pair in the trackers pays. The disabled figure is what release
+//  builds pay with enableProfiling off, so it's the one to watch. CpuProfiler::measureOverhead() (shown in the debug
+//  tab) should land close to the single-threaded figures.
+// An enabled pair, histograms included, is budgeted at under 100 ns - the run fails if it isn't. Two of the clock reads
+//  are unavoidable, so that cost is printed alongside for machines where the clock alone eats the budget.
+
+namespace {
+    constexpr double PAIR_BUDGET_NS = 100.0;
+}
+
+int main() {
+    auto profiler = CpuProfiler::Builder()
+        .addBlock("Bench")
+        .addBlock("Bench - Nested")
+        .build();
+    CpuProfiler* p = profiler.get();
+
+    const double clockNs = bench::run("steady_clock::now()", [] {
+        bench::doNotOptimize(std::chrono::steady_clock::now());
+    });
+
+    CpuProfiler::setEnabled(true);
+    const double pairNs = bench::run("enabled, begin + end", [&] {
+        BEGIN_CPU_PROFILING_BLOCK(p, "Bench");
+        END_CPU_PROFILING_BLOCK(p, "Bench");
+    });
+    bench::run("enabled, nested begin + end", [&] {
+        BEGIN_CPU_PROFILING_BLOCK(p, "Bench");
+        BEGIN_CPU_PROFILING_BLOCK(p, "Bench - Nested");
+        END_CPU_PROFILING_BLOCK(p, "Bench - Nested");
+        END_CPU_PROFILING_BLOCK(p, "Bench");
+    });
+
+    AllocTracker::setEnabled(true);
+    bench::run("enabled + alloc tracking, begin + end", [&] {
+        BEGIN_CPU_PROFILING_BLOCK(p, "Bench");
+        END_CPU_PROFILING_BLOCK(p, "Bench");
+    });
+    AllocTracker::setEnabled(false);
+
+    // Several threads timing the same block, as the planner pool does
+    const size_t threadCount = std::max(2u, std::min(4u, std::thread::hardware_concurrency()));
+    {
+        constexpr size_t pairsPerThread = 200000;
+        std::atomic<bool> go{ false };
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < threadCount; t++) {
+            threads.emplace_back([&] {
+                while (!go.load(std::memory_order_acquire)) {}
+                for (size_t i = 0; i < pairsPerThread; i++) {
+                    BEGIN_CPU_PROFILING_BLOCK(p, "Bench");
+                    END_CPU_PROFILING_BLOCK(p, "Bench");
+                }
+            });
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        go.store(true, std::memory_order_release);
+        for (std::thread& thread : threads) thread.join();
+        const auto end = std::chrono::steady_clock::now();
+
+        const double ns = std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(pairsPerThread);
+        std::printf("%-48s %10.1f ns\n", ("enabled, " + std::to_string(threadCount) + " threads, same block (per pair)").c_str(), ns);
+    }
+
+    CpuProfiler::setEnabled(false);
+    bench::run("disabled, begin + end", [&] {
+        BEGIN_CPU_PROFILING_BLOCK(p, "Bench");
+        END_CPU_PROFILING_BLOCK(p, "Bench");
+    });
+
+    const CpuProfiler::Overhead overhead = CpuProfiler::measureOverhead();
+    std::printf("%-48s %10.1f ns\n", "CpuProfiler::measureOverhead(), enabled",  overhead.enabledNs);
+    std::printf("%-48s %10.1f ns\n", "CpuProfiler::measureOverhead(), disabled", overhead.disabledNs);
+
+    const auto measureStart = std::chrono::steady_clock::now();
+    bench::doNotOptimize(CpuProfiler::measureOverhead());
+    const auto measureEnd = std::chrono::steady_clock::now();
+    std::printf("%-48s %10.3f ms\n", "CpuProfiler::measureOverhead() itself", std::chrono::duration<double, std::milli>(measureEnd - measureStart).count());
+
+    const bool withinBudget = pairNs < PAIR_BUDGET_NS;
+    std::printf("\nenabled pair %.1f ns (%.1f ns of it the two clock reads), budget %.0f ns: %s\n",
+        pairNs, clockNs * 2.0, PAIR_BUDGET_NS, withinBudget ? "ok" : "OVER BUDGET");
+
+    return withinBudget ? 0 : 1;
+}
@@ -0,0 +1,96 @@
+#include "kbf_bench.hpp"
+
+#include <kbf/util/algorithm/distance_culler.hpp>
+
+#include <limits>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace kbf;
+
+// DistanceCuller against what applyPresets did before it: an nth_element over the tracker's own slot entries, looking
+//  each candidate's distance up through its optional info. Crowd sizes from a quiet hub to a busy one, 8 applications
+//  a frame within 30m - roughly 1 in 8 out of view, about half out of range.
+
+namespace {
+
+    struct Info {
+        std::string name;
+        float distanceFromCameraSq = 0.0f;
+        bool  visible = false;
+        char  padding[64]{}; // Stand-in for the rest of PlayerInfo, so lookups cost what they do in the tracker
+    };
+
+    struct SlotEntry {
+        const void* data;
+        size_t      index;
+    };
+
+    constexpr float RANGE = 30.0f;
+    constexpr int   LIMIT = 8;
+
+    size_t nthElementBaseline(const std::vector<std::optional<Info>>& infos, std::vector<SlotEntry>& entries) {
+        entries.clear();
+        for (size_t i = 0; i < infos.size(); i++) entries.push_back(SlotEntry{ &infos[i], i });
+
+        auto distanceOf = [&](const SlotEntry& entry) {
+            const std::optional<Info>& info = infos[entry.index];
+            return info && info->visible ? info->distanceFromCameraSq : std::numeric_limits<float>::infinity();
+        };
+
+        size_t kept = entries.size();
+        if (kept > static_cast<size_t>(LIMIT)) {
+            std::nth_element(entries.begin(), entries.begin() + LIMIT, entries.end(), [&](const SlotEntry& a, const SlotEntry& b) {
+                return distanceOf(a) < distanceOf(b);
+            });
+            kept = LIMIT;
+        }
+
+        size_t sum = 0;
+        for (size_t i = 0; i < kept; i++) {
+            const std::optional<Info>& info = infos[entries[i].index];
+            if (info->visible && info->distanceFromCameraSq <= RANGE * RANGE) sum += entries[i].index;
+        }
+        return sum;
+    }
+
+    size_t distanceCuller(const std::vector<std::optional<Info>>& infos, DistanceCuller& culler) {
+        culler.clear();
+        for (uint32_t i = 0; i < infos.size(); i++) {
+            const std::optional<Info>& info = infos[i];
+            culler.add(i, info && info->visible ? info->distanceFromCameraSq : std::numeric_limits<float>::infinity());
+        }
+
+        size_t sum = 0;
+        const size_t kept = culler.select(RANGE, LIMIT);
+        for (size_t i = 0; i < kept; i++) sum += culler.selectedId(i);
+        return sum;
+    }
+
+}
+
+int main() {
+    std::mt19937 rng{ 42 };
+    std::uniform_real_distribution<float> coordinate(0.0f, 60.0f);
+
+    for (size_t count : { 4, 8, 16, 32, 64, 128, 256 }) {
+        std::vector<std::optional<Info>> infos(count);
+        for (std::optional<Info>& info : infos) {
+            const float x = coordinate(rng);
+            const float z = coordinate(rng);
+            info = Info{ .name = {}, .distanceFromCameraSq = x * x + z * z, .visible = rng() % 8 != 0, .padding = {} };
+        }
+
+        std::vector<SlotEntry> entries;
+        entries.reserve(count);
+        DistanceCuller culler;
+        culler.reserve(count);
+
+        std::printf("-- %zu characters\n", count);
+        bench::run("  nth_element over slot entries", [&] { bench::doNotOptimize(nthElementBaseline(infos, entries)); });
+        bench::run("  DistanceCuller",                [&] { bench::doNotOptimize(distanceCuller(infos, culler)); });
+    }
+    return 0;
+}
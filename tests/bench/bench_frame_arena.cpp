@@ -0,0 +1,150 @@
+#include "kbf_bench.hpp"
+
+#include <kbf/profiling/alloc_tracker.hpp>
+#include <kbf/util/memory/frame_arena.hpp>
+
+#include <cstdint>
+#include <memory_resource>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace kbf;
+
+// The two per-frame temporaries moved onto FrameArena, before & after, counted through AllocTracker (alloc_tracker.cpp
+//  is linked, so its operator new sees every heap allocation here, as in the plugin):
+//  - MaterialManager::planPreset's override lookup table, rebuilt twice per piece per character (set-wide & active
+//    preset) - 5 pieces, 12 overrides each, looked up from 24 mesh materials.
+//  - NpcTracker::applyPresets' candidate list, copied from the slot table once a frame - 40 NPCs.
+//  One frame is all of that for every character. Frames are warmed up first, so the arena has settled on its chunk.
+
+namespace {
+
+    // Stand-ins for OverrideMaterial / MeshMaterial - only the name is looked up.
+    struct OverrideMaterial {
+        std::string name;
+        bool shown = true;
+        bool operator<(const OverrideMaterial& other) const { return name < other.name; }
+    };
+
+    constexpr size_t PIECES         = 5;
+    constexpr size_t OVERRIDES      = 12;
+    constexpr size_t MESH_MATERIALS = 24;
+    constexpr size_t NPCS           = 40;
+
+    struct Scene {
+        std::set<OverrideMaterial> overrides;
+        std::vector<std::string> meshMaterials;
+        std::unordered_set<size_t> npcSlotTable;
+
+        Scene() {
+            for (size_t i = 0; i < MESH_MATERIALS; i++) meshMaterials.push_back("ch03_000_0000_mat_" + std::to_string(i));
+            for (size_t i = 0; i < OVERRIDES; i++) overrides.insert(OverrideMaterial{ meshMaterials[i * 2], i % 3 != 0 });
+            for (size_t i = 0; i < NPCS; i++) npcSlotTable.insert(i * 7);
+        }
+    };
+
+    // material_manager.cpp before FrameArena: a heap unordered_map built through a lambda.
+    size_t planPieceHeap(const Scene& scene) {
+        const std::unordered_map<std::string_view, const OverrideMaterial*> lut = [&]() {
+            std::unordered_map<std::string_view, const OverrideMaterial*> lut;
+            for (const auto& mat : scene.overrides) lut[mat.name] = &mat;
+            return lut;
+        }();
+
+        size_t shown = 0;
+        for (const std::string& name : scene.meshMaterials) {
+            const auto it = lut.find(name);
+            if (it != lut.end()) shown += it->second->shown;
+        }
+        return shown;
+    }
+
+    // ...& after: the same table as a pmr map on this thread's frame arena.
+    size_t planPieceArena(const Scene& scene) {
+        std::pmr::unordered_map<std::string_view, const OverrideMaterial*> lut{ &FrameArena::local() };
+        lut.reserve(scene.overrides.size());
+        for (const auto& mat : scene.overrides) lut[mat.name] = &mat;
+
+        size_t shown = 0;
+        for (const std::string& name : scene.meshMaterials) {
+            const auto it = lut.find(name);
+            if (it != lut.end()) shown += it->second->shown;
+        }
+        return shown;
+    }
+
+    // npc_tracker.cpp before FrameArena...
+    size_t npcCandidatesHeap(const Scene& scene) {
+        std::vector<size_t> npcs;
+        npcs.reserve(scene.npcSlotTable.size());
+        for (size_t idx : scene.npcSlotTable) npcs.emplace_back(idx);
+        return npcs.size();
+    }
+
+    // ...& after.
+    size_t npcCandidatesArena(const Scene& scene) {
+        std::pmr::vector<size_t> npcs{ &FrameArena::local() };
+        npcs.reserve(scene.npcSlotTable.size());
+        for (size_t idx : scene.npcSlotTable) npcs.emplace_back(idx);
+        return npcs.size();
+    }
+
+    template <typename PlanPiece, typename NpcCandidates>
+    size_t frame(const Scene& scene, size_t characters, PlanPiece&& planPiece, NpcCandidates&& npcCandidates) {
+        FrameArena::beginFrame();
+
+        size_t sum = npcCandidates(scene);
+        for (size_t c = 0; c < characters; c++) {
+            for (size_t piece = 0; piece < PIECES; piece++) {
+                sum += planPiece(scene); // Set-wide material overrides
+                sum += planPiece(scene); // Active preset
+            }
+        }
+        return sum;
+    }
+
+    struct FrameAllocations {
+        uint64_t allocations = 0;
+        uint64_t bytes       = 0;
+    };
+
+    template <typename Fn>
+    FrameAllocations countFrame(Fn&& fn) {
+        for (size_t i = 0; i < 8; i++) bench::doNotOptimize(fn()); // Warm up
+
+        const AllocCounters before = AllocTracker::threadCounters();
+        bench::doNotOptimize(fn());
+        const AllocCounters after = AllocTracker::threadCounters();
+        return FrameAllocations{ after.allocations - before.allocations, after.bytes - before.bytes };
+    }
+
+}
+
+int main() {
+    AllocTracker::setEnabled(true);
+
+    const Scene scene;
+    for (size_t characters : { 4, 16, 64 }) {
+        auto heapFrame  = [&] { return frame(scene, characters, planPieceHeap,  npcCandidatesHeap); };
+        auto arenaFrame = [&] { return frame(scene, characters, planPieceArena, npcCandidatesArena); };
+
+        const FrameAllocations heap  = countFrame(heapFrame);
+        const FrameAllocations arena = countFrame(arenaFrame);
+        const FrameArena::Stats arenaStats = FrameArena::local().getStats();
+
+        std::printf("-- %zu characters, %zu NPC candidates\n", characters, NPCS);
+        std::printf("  heap allocations per frame:  before %6llu (%7llu bytes)   after %6llu (%7llu bytes)\n",
+            static_cast<unsigned long long>(heap.allocations), static_cast<unsigned long long>(heap.bytes),
+            static_cast<unsigned long long>(arena.allocations), static_cast<unsigned long long>(arena.bytes));
+        std::printf("  served by the arena instead: %6llu (%7llu bytes)\n",
+            static_cast<unsigned long long>(arenaStats.lastFrameAllocations), static_cast<unsigned long long>(arenaStats.lastFrameBytes));
+
+        bench::run("  heap temporaries, per frame",  [&] { bench::doNotOptimize(heapFrame()); },  200, 25);
+        bench::run("  arena temporaries, per frame", [&] { bench::doNotOptimize(arenaFrame()); }, 200, 25);
+    }
+    return 0;
+}
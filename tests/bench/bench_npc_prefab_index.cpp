@@ -0,0 +1,76 @@
+#include "kbf_bench.hpp"
+
+#include <kbf/util/hash/minimal_perfect_hash.hpp>
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+using namespace kbf;
+
+// ArmourDataManager::getArmourSetFromNpcPrefab's lookup: the perfect hash + dense array it uses, against the
+//  unordered_map it falls back to (which needs a std::string built from the engine's string_view) and the same map
+//  probed with a key that's already a std::string. ~600 prefab paths, a quarter of the queries for prefabs it doesn't know.
+
+namespace {
+
+    struct NpcPrefabData {
+        std::string name;
+        bool femaleCanUse = true;
+        bool maleCanUse   = true;
+    };
+
+}
+
+int main() {
+    std::mt19937 rng{ 1 };
+
+    std::vector<std::string> keys;
+    for (int i = 0; i < 600; i++) {
+        keys.push_back("GameDesign/NPC/Prefab/ch0" + std::to_string(rng() % 100000) + "/npc_ch" + std::to_string(i) + "_body_00.pfb");
+    }
+
+    std::unordered_map<std::string, NpcPrefabData> map;
+    for (const std::string& key : keys) map[key] = NpcPrefabData{ "[NPC] Outfit " + key.substr(30) };
+
+    std::vector<std::string_view> indexKeys;
+    std::vector<const NpcPrefabData*> indexData;
+    for (const auto& [key, data] : map) {
+        indexKeys.push_back(key);
+        indexData.push_back(&data);
+    }
+
+    MinimalPerfectHash index;
+    if (!index.build(indexKeys)) {
+        std::printf("index failed to build\n");
+        return 1;
+    }
+    std::vector<const NpcPrefabData*> dense(indexKeys.size());
+    for (size_t i = 0; i < indexKeys.size(); i++) dense[index.find(indexKeys[i])] = indexData[i];
+
+    std::vector<std::string> queries;
+    for (int i = 0; i < 1000; i++) {
+        queries.push_back(i % 4 == 3 ? "GameDesign/NPC/Prefab/unknown/npc_ch" + std::to_string(i) + "_body_00.pfb" : keys[rng() % keys.size()]);
+    }
+    std::vector<std::string_view> queryViews(queries.begin(), queries.end());
+
+    size_t q = 0;
+    auto next = [&]() -> size_t { q = q + 1 == queries.size() ? 0 : q + 1; return q; };
+
+    std::printf("-- %zu prefabs, index %zu bytes\n", map.size(), index.getBytes());
+    bench::run("  MinimalPerfectHash + dense array", [&] {
+        const size_t slot = index.find(queryViews[next()]);
+        bench::doNotOptimize(slot != MinimalPerfectHash::npos ? dense[slot]->name.size() : 0);
+    }, 100000);
+    bench::run("  unordered_map, std::string from string_view", [&] {
+        const auto it = map.find(std::string(queryViews[next()]));
+        bench::doNotOptimize(it != map.end() ? it->second.name.size() : 0);
+    }, 100000);
+    bench::run("  unordered_map, std::string key", [&] {
+        const auto it = map.find(queries[next()]);
+        bench::doNotOptimize(it != map.end() ? it->second.name.size() : 0);
+    }, 100000);
+    return 0;
+}
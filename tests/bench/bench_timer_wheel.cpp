@@ -0,0 +1,113 @@
+#include "kbf_bench.hpp"
+
+#include <kbf/util/time/timer_wheel.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+using namespace kbf;
+
+// TimerWheel against what the trackers did before it: a map of delay start times, every entry scanned each frame to
+//  find the ones that have expired. One call is one 60fps frame - about 1 in 64 timers restarted (an equip somewhere),
+//  then everything due expired. Delays are 0.5 - 4s, so most timers are pending at any time.
+
+namespace {
+
+    using Clock = TimerWheel::Clock;
+
+    constexpr Clock::duration FRAME = std::chrono::microseconds{ 16667 };
+
+    struct Rng {
+        uint32_t state;
+        uint32_t next() {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return state;
+        }
+    };
+
+    std::vector<Clock::duration> makeDelays(size_t count) {
+        Rng rng{ 42 };
+        std::vector<Clock::duration> delays(count);
+        for (Clock::duration& delay : delays) delay = std::chrono::milliseconds{ 500 + rng.next() % 3500 };
+        return delays;
+    }
+
+    class MapScanBaseline {
+    public:
+        MapScanBaseline(const std::vector<Clock::duration>& delays) : delays{ delays } {
+            for (uint32_t id = 0; id < delays.size(); id++) starts[id] = now;
+        }
+
+        size_t frame() {
+            now += FRAME;
+            const size_t restarts = delays.size() / 64 + 1;
+            for (size_t i = 0; i < restarts; i++) starts[rng.next() % delays.size()] = now;
+
+            size_t fired = 0;
+            for (auto& [id, start] : starts) {
+                if (!start.has_value() || now - *start < delays[id]) continue;
+                start.reset();
+                fired++;
+            }
+            return fired;
+        }
+
+        size_t pendingCount() const {
+            size_t pending = 0;
+            for (const auto& [id, start] : starts) pending += start.has_value();
+            return pending;
+        }
+
+    private:
+        const std::vector<Clock::duration>& delays;
+        std::unordered_map<uint32_t, std::optional<Clock::time_point>> starts;
+        Clock::time_point now{ std::chrono::hours{ 1 } };
+        Rng rng{ 7 };
+    };
+
+    class TimerWheelFrames {
+    public:
+        TimerWheelFrames(const std::vector<Clock::duration>& delays) : delays{ delays } {
+            wheel.resize(delays.size());
+            for (uint32_t id = 0; id < delays.size(); id++) wheel.schedule(id, now, delays[id]);
+        }
+
+        size_t frame() {
+            now += FRAME;
+            const size_t restarts = delays.size() / 64 + 1;
+            for (size_t i = 0; i < restarts; i++) {
+                const uint32_t id = rng.next() % static_cast<uint32_t>(delays.size());
+                wheel.schedule(id, now, delays[id]);
+            }
+            return wheel.advance(now, [](uint32_t) {});
+        }
+
+        size_t pendingCount() const { return wheel.pendingCount(); }
+
+    private:
+        const std::vector<Clock::duration>& delays;
+        TimerWheel wheel;
+        Clock::time_point now{ std::chrono::hours{ 1 } };
+        Rng rng{ 7 };
+    };
+
+}
+
+int main() {
+    for (size_t count : { 64, 1024, 4096, 16384 }) {
+        const std::vector<Clock::duration> delays = makeDelays(count);
+        MapScanBaseline  baseline{ delays };
+        TimerWheelFrames wheel{ delays };
+
+        std::printf("-- %zu timers\n", count);
+        bench::run("  map scan, per frame",   [&] { bench::doNotOptimize(baseline.frame()); }, 2000, 25);
+        bench::run("  TimerWheel, per frame", [&] { bench::doNotOptimize(wheel.frame()); },    2000, 25);
+        std::printf("  pending after the run: map %zu, wheel %zu\n", baseline.pendingCount(), wheel.pendingCount());
+    }
+    return 0;
+}
@@ -0,0 +1,98 @@
+#include "kbf_bench.hpp"
+
+#include <kbf/util/string/utf16_to_utf8.hpp>
+
+#include <string>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#endif
+
+using namespace kbf;
+
+// utf16ToUtf8 on the shapes of string the engine hands back - short & long ASCII names, Japanese (BMP) text, emoji
+//  (surrogate pairs) & broken surrogates - against a plain one-unit-at-a-time loop, and WideCharToMultiByte (what
+//  managed string reads went through before) where it's available.
+
+namespace {
+
+    struct Case {
+        const char*    name;
+        std::u16string text;
+    };
+
+    std::u16string repeat(const std::u16string& unit, size_t times) {
+        std::u16string out;
+        for (size_t i = 0; i < times; i++) out += unit;
+        return out;
+    }
+
+    size_t scalarUtf16ToUtf8(const char16_t* src, size_t len, char* dst) {
+        char* out = dst;
+        for (size_t i = 0; i < len; i++) {
+            uint32_t cp = src[i];
+            if (cp >= 0xD800 && cp <= 0xDBFF && i + 1 < len && src[i + 1] >= 0xDC00 && src[i + 1] <= 0xDFFF) {
+                cp = 0x10000 + ((cp - 0xD800) << 10) + (static_cast<uint32_t>(src[i + 1]) - 0xDC00);
+                i++;
+            }
+            else if (cp >= 0xD800 && cp <= 0xDFFF) {
+                cp = 0xFFFD;
+            }
+
+            if (cp < 0x80) {
+                *out++ = static_cast<char>(cp);
+            }
+            else if (cp < 0x800) {
+                *out++ = static_cast<char>(0xC0 | (cp >> 6));
+                *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+            }
+            else if (cp < 0x10000) {
+                *out++ = static_cast<char>(0xE0 | (cp >> 12));
+                *out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+            }
+            else {
+                *out++ = static_cast<char>(0xF0 | (cp >> 18));
+                *out++ = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+                *out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+            }
+        }
+        return static_cast<size_t>(out - dst);
+    }
+
+}
+
+int main() {
+    const Case cases[] = {
+        { "ascii, 12 units",          u"Bip001 Spine" },
+        { "ascii, 64 units",          repeat(u"ch02_001_0002_Body_", 4).substr(0, 64) },
+        { "bmp (japanese), 16 units", repeat(u"ハンター", 4) },
+        { "surrogate pairs, 8 emoji", repeat(u"\U0001F600", 8) },
+        { "mixed ascii + pairs, 35",  repeat(u"Hunter\U0001F525", 5) },
+        { "unpaired surrogates, 16",  std::u16string(16, char16_t(0xD83D)) },
+    };
+
+    std::string out;
+    for (const Case& c : cases) {
+        std::printf("-- %s\n", c.name);
+        out.resize(utf16ToUtf8MaxBytes(c.text.size()));
+
+        bench::run("  utf16ToUtf8", [&] {
+            bench::doNotOptimize(utf16ToUtf8(c.text.data(), c.text.size(), out.data()));
+        });
+        bench::run("  utf16ToUtf8Scratch", [&] {
+            bench::doNotOptimize(utf16ToUtf8Scratch(c.text.data(), c.text.size()));
+        });
+        bench::run("  scalar loop", [&] {
+            bench::doNotOptimize(scalarUtf16ToUtf8(c.text.data(), c.text.size(), out.data()));
+        });
+#if defined(_WIN32)
+        bench::run("  WideCharToMultiByte", [&] {
+            const wchar_t* wide = reinterpret_cast<const wchar_t*>(c.text.data());
+            bench::doNotOptimize(WideCharToMultiByte(CP_UTF8, 0, wide, static_cast<int>(c.text.size()), out.data(), static_cast<int>(out.size()), nullptr, nullptr));
+        });
+#endif
+    }
+    return 0;
+}
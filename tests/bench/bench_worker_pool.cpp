@@ -0,0 +1,75 @@
+#include "kbf_bench.hpp"
+
+#include <kbf/util/concurrency/worker_pool.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace kbf;
+
+// Player apply split the way applyPresets does it: plan every player's writes (bone name lookups into a per-player
+//  command buffer), then commit the buffers one after another on the calling thread. Planning serially against
+//  planning on the pool, from a lone player up to a full lobby & beyond. The commit stays serial either way, so it
+//  bounds what the pool can win.
+
+namespace {
+
+    struct Write {
+        int   bone;
+        float value;
+    };
+
+    struct Workload {
+        std::unordered_map<std::string, int> bones;     // Stand-in for a player's bone name -> bone lookup
+        std::vector<std::string>             modifiers; // Stand-in for the active preset's bone modifiers
+        std::vector<std::vector<Write>>      plans;
+    };
+
+    Workload makeWorkload(size_t players) {
+        Workload w{};
+        for (int i = 0; i < 300; i++) w.bones.emplace("bone_" + std::to_string(i), i);
+        for (int i = 0; i < 120; i++) w.modifiers.push_back("bone_" + std::to_string(i * 2 + (i % 7 == 0 ? 1000 : 0)));
+        w.plans.resize(players);
+        for (std::vector<Write>& plan : w.plans) plan.reserve(w.modifiers.size());
+        return w;
+    }
+
+    void plan(Workload& w, size_t player) {
+        std::vector<Write>& out = w.plans[player];
+        out.clear();
+        for (const std::string& modifier : w.modifiers) {
+            const auto it = w.bones.find(modifier);
+            if (it != w.bones.end()) out.push_back(Write{ it->second, static_cast<float>(player) * 0.01f });
+        }
+    }
+
+    float commit(const Workload& w) {
+        float sum = 0.0f;
+        for (const std::vector<Write>& plan : w.plans) {
+            for (const Write& write : plan) sum += write.value * static_cast<float>(write.bone);
+        }
+        return sum;
+    }
+
+}
+
+int main() {
+    WorkerPool pool{ WorkerPool::defaultWorkerCount(3) };
+    std::printf("-- %zu planner threads + the caller\n", pool.getWorkerCount());
+
+    for (size_t players : { 1, 4, 8, 16, 32, 64, 100 }) {
+        Workload w = makeWorkload(players);
+
+        std::printf("-- %zu players\n", players);
+        bench::run("  plan serially, commit", [&] {
+            for (size_t p = 0; p < players; p++) plan(w, p);
+            bench::doNotOptimize(commit(w));
+        }, 200);
+        bench::run("  plan on the pool, commit", [&] {
+            pool.parallelFor(players, 4, [&](size_t p) { plan(w, p); });
+            bench::doNotOptimize(commit(w));
+        }, 200);
+    }
+    return 0;
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+// Tiny benchmark helper - runs fn in batches & reports the fastest batch's time per call, which is the least noisy
+//  figure on a machine that's doing anything else.
+
+namespace kbf::bench {
+
+    // Keeps the compiler from optimizing away a result that's otherwise unused.
+    template <typename T>
+    inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static const void* volatile sink;
+        sink = &value;
+#endif
+    }
+
+    template <typename Fn>
+    double measureNs(Fn&& fn, size_t callsPerBatch = 10000, size_t batches = 25) {
+        for (size_t i = 0; i < callsPerBatch; i++) fn(); // Warm up
+
+        double best = 0.0;
+        for (size_t b = 0; b < batches; b++) {
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < callsPerBatch; i++) fn();
+            const auto end = std::chrono::steady_clock::now();
+
+            const double ns = std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(callsPerBatch);
+            best = b == 0 ? ns : std::min(best, ns);
+        }
+        return best;
+    }
+
+    template <typename Fn>
+    double run(const char* name, Fn&& fn, size_t callsPerBatch = 10000, size_t batches = 25) {
+        const double ns = measureNs(fn, callsPerBatch, batches);
+        std::printf("%-48s %10.1f ns\n", name, ns);
+        return ns;
+    }
+
+}
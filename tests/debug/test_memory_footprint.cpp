@@ -0,0 +1,127 @@
+#include <kbf_test.hpp>
+
+#include <kbf/debug/memory_footprint.hpp>
+
+// The data type helpers pull in the armour headers, which need <format> & the REFramework headers.
+#if __has_include(<format>) && __has_include(<reframework/API.hpp>)
+#include <kbf/data/data_footprint.hpp>
+#define KBF_TEST_HAVE_DATA_FOOTPRINT
+#endif
+
+#include <deque>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace kbf;
+
+namespace {
+
+    const std::string LONG_STRING = "long enough to never fit in the small string buffer";
+
+}
+
+KBF_TEST(add_rolls_children_into_the_parent) {
+    MemoryFootprint report{ "Root", 1, 100 };
+    report.add(MemoryFootprint{ "A", 2, 20 });
+    report.add(MemoryFootprint{ "B", 3, 30 });
+
+    KBF_CHECK_EQ(report.elements, size_t{ 6 });
+    KBF_CHECK_EQ(report.bytes, size_t{ 150 });
+    KBF_REQUIRE(report.children.size() == 2);
+    KBF_CHECK_EQ(report.children[0].name, std::string("A"));
+    KBF_CHECK_EQ(report.children[1].bytes, size_t{ 30 });
+}
+
+KBF_TEST(nested_reports_total_bottom_up) {
+    // Children are folded in when added, so a subtree is built before it's attached - as the trackers do.
+    MemoryFootprint tracker{ "Tracker", 0, 64 };
+    tracker.add(MemoryFootprint{ "Infos", 4, 400 });
+    tracker.add(MemoryFootprint{ "Caches", 2, 200 });
+
+    MemoryFootprint report{ "KBF" };
+    report.add(MemoryFootprint{ "Data Manager", 10, 1000 });
+    const MemoryFootprint& added = report.add(tracker);
+
+    KBF_CHECK_EQ(added.bytes, size_t{ 664 });
+    KBF_CHECK_EQ(report.elements, size_t{ 16 });
+    KBF_CHECK_EQ(report.bytes, size_t{ 1664 });
+    KBF_CHECK_EQ(report.children[1].children.size(), size_t{ 2 });
+
+    // The parent is a sum taken at add time, not a live view.
+    size_t childBytes = 0;
+    for (const MemoryFootprint& child : report.children) childBytes += child.bytes;
+    KBF_CHECK_EQ(report.bytes, childBytes);
+}
+
+KBF_TEST(string_bytes_ignore_the_small_string_buffer) {
+    KBF_CHECK_EQ(footprint::stringBytes(std::string{}), size_t{ 0 });
+    KBF_CHECK_EQ(footprint::stringBytes(std::string("short")), size_t{ 0 });
+
+    const std::string heap = LONG_STRING;
+    KBF_CHECK_EQ(footprint::stringBytes(heap), heap.capacity() + 1);
+}
+
+KBF_TEST(vector_bytes_count_capacity) {
+    std::vector<uint64_t> values;
+    values.reserve(32);
+    values.push_back(1);
+    KBF_CHECK_EQ(footprint::vectorBytes(values), size_t{ 32 * sizeof(uint64_t) });
+
+    std::vector<bool> bits;
+    bits.reserve(1024);
+    KBF_CHECK_EQ(footprint::vectorBytes(bits), bits.capacity() / 8);
+
+    std::vector<std::string> strings{ "a", LONG_STRING };
+    const size_t expected = strings.capacity() * sizeof(std::string) + footprint::stringBytes(strings[1]);
+    KBF_CHECK_EQ(footprint::vectorBytes(strings, [](const std::string& str) { return footprint::stringBytes(str); }), expected);
+}
+
+KBF_TEST(hash_container_bytes_count_buckets_and_nodes) {
+    std::unordered_map<uint32_t, std::string> map;
+    for (uint32_t i = 0; i < 20; i++) map.emplace(i, i == 7 ? LONG_STRING : "x");
+
+    const size_t base = map.bucket_count() * 2 * sizeof(void*)
+        + map.size() * (sizeof(std::unordered_map<uint32_t, std::string>::value_type) + footprint::LIST_NODE_OVERHEAD);
+    KBF_CHECK_EQ(footprint::hashContainerBytes(map), base);
+
+    const size_t withEntries = footprint::hashContainerBytes(map, [](const auto& entry) { return footprint::stringBytes(entry.second); });
+    KBF_CHECK_EQ(withEntries, base + footprint::stringBytes(map.at(7)));
+}
+
+KBF_TEST(tree_and_deque_bytes_count_nodes) {
+    std::map<int, int> tree{ { 1, 1 }, { 2, 2 }, { 3, 3 } };
+    KBF_CHECK_EQ(footprint::treeContainerBytes(tree), 3 * (sizeof(std::map<int, int>::value_type) + footprint::TREE_NODE_OVERHEAD));
+    KBF_CHECK_EQ(footprint::treeContainerBytes(tree, [](const auto&) { return size_t{ 5 }; }), footprint::treeContainerBytes(tree) + 15);
+
+    std::deque<std::string> deq{ "a", LONG_STRING };
+    const size_t expected = 2 * (sizeof(std::string) + sizeof(void*)) + footprint::stringBytes(deq[1]);
+    KBF_CHECK_EQ(footprint::dequeBytes(deq, [](const std::string& str) { return footprint::stringBytes(str); }), expected);
+}
+
+#ifdef KBF_TEST_HAVE_DATA_FOOTPRINT
+
+KBF_TEST(data_footprint_sums_owned_strings) {
+    PlayerData player{};
+    player.name     = LONG_STRING;
+    player.hunterId = "ABC123";
+    KBF_CHECK_EQ(footprint::playerDataBytes(player),
+        footprint::stringBytes(player.name) + footprint::stringBytes(player.hunterId) + footprint::metadataBytes(player.metadata));
+
+    ArmourInfo info{};
+    KBF_CHECK_EQ(footprint::armourInfoBytes(info), size_t{ 0 });
+    info.body = ArmourSet{ LONG_STRING, true };
+    info.legs = ArmourSet{ "short", true };
+    KBF_CHECK_EQ(footprint::armourInfoBytes(info), footprint::stringBytes(info.body->name));
+
+    MeshMaterial material{};
+    material.name = LONG_STRING;
+    material.params.emplace(LONG_STRING, MeshMaterialParam{ "p", MAT_TYPE_FLOAT, 0 });
+    KBF_CHECK_EQ(footprint::meshMaterialBytes(material),
+        footprint::stringBytes(material.name)
+        + footprint::hashContainerBytes(material.params)
+        + footprint::stringBytes(material.params.begin()->first));
+}
+
+#endif
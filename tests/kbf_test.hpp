@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Minimal test harness - no external dependencies, so the tests build wherever the plugin's own sources do.
+//
+//  KBF_TEST(name) { ... }     defines a test case, registered automatically.
+//  KBF_CHECK(cond)            records a failure & carries on.
+//  KBF_CHECK_EQ(a, b)         as above, printing both values when they're printable.
+//  KBF_REQUIRE(cond)          records a failure & ends the current test case.
+
+namespace kbf::test {
+
+    struct TestCase {
+        const char* name;
+        std::function<void()> fn;
+    };
+
+    inline std::vector<TestCase>& registry() {
+        static std::vector<TestCase> tests;
+        return tests;
+    }
+
+    inline int& failureCount() {
+        static int failures = 0;
+        return failures;
+    }
+
+    struct Registrar {
+        Registrar(const char* name, std::function<void()> fn) { registry().push_back(TestCase{ name, std::move(fn) }); }
+    };
+
+    struct RequireFailed {};
+
+    inline void reportFailure(const char* file, int line, const std::string& what) {
+        failureCount()++;
+        std::fprintf(stderr, "%s:%d: FAILED: %s\n", file, line, what.c_str());
+    }
+
+    template <typename T>
+    std::string describe(const T& value) {
+        if constexpr (std::is_same_v<T, bool>)                               return value ? "true" : "false";
+        else if constexpr (std::is_arithmetic_v<T>)                          return std::to_string(value);
+        else if constexpr (std::is_convertible_v<const T&, std::string>)     return "\"" + std::string(value) + "\"";
+        else                                                                 return "<?>";
+    }
+
+    template <typename A, typename B>
+    bool checkEqual(const A& a, const B& b, const char* aExpr, const char* bExpr, const char* file, int line) {
+        if (a == b) return true;
+        reportFailure(file, line, std::string(aExpr) + " == " + bExpr + " (" + describe(a) + " vs " + describe(b) + ")");
+        return false;
+    }
+
+    int runAll();
+
+}
+
+#define KBF_TEST_CONCAT_INNER(a, b) a##b
+#define KBF_TEST_CONCAT(a, b) KBF_TEST_CONCAT_INNER(a, b)
+
+#define KBF_TEST(name)                                                                              \
+    static void KBF_TEST_CONCAT(kbfTest_, name)();                                                  \
+    static const ::kbf::test::Registrar KBF_TEST_CONCAT(kbfTestRegistrar_, name){ #name, &KBF_TEST_CONCAT(kbfTest_, name) }; \
+    static void KBF_TEST_CONCAT(kbfTest_, name)()
+
+#define KBF_CHECK(cond) \
+    do { if (!(cond)) ::kbf::test::reportFailure(__FILE__, __LINE__, #cond); } while (0)
+
+#define KBF_CHECK_EQ(a, b) \
+    do { ::kbf::test::checkEqual((a), (b), #a, #b, __FILE__, __LINE__); } while (0)
+
+#define KBF_REQUIRE(cond) \
+    do { if (!(cond)) { ::kbf::test::reportFailure(__FILE__, __LINE__, #cond); throw ::kbf::test::RequireFailed{}; } } while (0)
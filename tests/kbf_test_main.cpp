@@ -0,0 +1,32 @@
+#include <kbf_test.hpp>
+
+#include <exception>
+
+namespace kbf::test {
+
+    int runAll() {
+        int failedCases = 0;
+        for (const TestCase& test : registry()) {
+            const int failuresBefore = failureCount();
+            try {
+                test.fn();
+            }
+            catch (const RequireFailed&) {}
+            catch (const std::exception& e) {
+                reportFailure(__FILE__, __LINE__, std::string("uncaught exception: ") + e.what());
+            }
+
+            const bool passed = failureCount() == failuresBefore;
+            if (!passed) failedCases++;
+            std::printf("[%s] %s\n", passed ? " OK " : "FAIL", test.name);
+        }
+
+        std::printf("%zu test(s), %d failed\n", registry().size(), failedCases);
+        return failedCases == 0 ? 0 : 1;
+    }
+
+}
+
+int main() {
+    return kbf::test::runAll();
+}
@@ -0,0 +1,264 @@
+#include <kbf_test.hpp>
+
+#include <kbf/mesh/part_visibility_mask.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace kbf;
+
+namespace {
+
+    constexpr int PIECES = 6;
+
+    // Stand-in for a preset's piece settings - the editor bumps `generation` from one counter on every edit.
+    struct Overrides {
+        std::set<OverrideMeshPart> parts;
+        uint64_t generation = 0;
+    };
+
+    uint64_t nextGeneration = 1;
+    void markEdited(Overrides& overrides) { overrides.generation = nextGeneration++; }
+
+    std::vector<MeshPart> makeParts(size_t count, std::mt19937& rng) {
+        std::vector<uint64_t> indices(256);
+        for (uint64_t i = 0; i < indices.size(); i++) indices[i] = i;
+        std::shuffle(indices.begin(), indices.end(), rng);
+
+        std::vector<MeshPart> parts;
+        for (size_t i = 0; i < count; i++) parts.push_back(MeshPart{ "Part Group " + std::to_string(i), indices[i] });
+        return parts;
+    }
+
+    // PartManager's plan / finishPlan flow, on the real mask cache.
+    struct PlannedParts {
+        std::array<const std::vector<MeshPart>*, PIECES> parts{};
+        CompiledPartMaskCache compiled;
+        std::array<PartVisibilityMask, PIECES> planned;
+        std::array<PartVisibilityMask, PIECES> committed;
+        uint64_t plansFinished = 0;
+        uint32_t resyncInterval = 30;
+
+        void init() {
+            for (int i = 0; i < PIECES; i++) {
+                planned[i].reset(parts[i]->size());
+                committed[i].reset(parts[i]->size());
+            }
+        }
+
+        void plan(const Overrides* overrides, int piece) {
+            if (overrides == nullptr) return;
+            const PartVisibilityMask* mask = compiled.find(overrides, piece, overrides->generation, plansFinished);
+            if (mask == nullptr) mask = &compiled.compile(overrides, piece, overrides->generation, plansFinished, overrides->parts, *parts[piece]);
+            planned[piece].layer(*mask);
+        }
+
+        template <typename Fn>
+        void finish(Fn&& write) {
+            if (++plansFinished % resyncInterval == 0) {
+                for (PartVisibilityMask& mask : committed) std::fill(mask.overridden.begin(), mask.overridden.end(), 0);
+            }
+            for (int i = 0; i < PIECES; i++) {
+                if (!planned[i].any()) continue;
+                PartVisibilityMask::diff(planned[i], committed[i], [&](size_t partIdx, bool shown) { write(i, (*parts[i])[partIdx].index, shown); });
+                std::fill(planned[i].overridden.begin(), planned[i].overridden.end(), 0);
+                std::fill(planned[i].shown.begin(), planned[i].shown.end(), 0);
+            }
+        }
+    };
+
+}
+
+KBF_TEST(compile_sets_only_overridden_parts) {
+    const std::vector<MeshPart> parts = { { "a", 10 }, { "b", 11 }, { "c", 12 } };
+    const std::set<OverrideMeshPart> overrides = { { parts[0], true }, { parts[2], false }, { MeshPart{ "not on mesh", 1 }, true } };
+
+    PartVisibilityMask mask;
+    PartVisibilityMask::compile(overrides, parts, mask);
+    KBF_REQUIRE(mask.overridden.size() == 1);
+    KBF_CHECK_EQ(mask.overridden[0], uint64_t{ 0b101 });
+    KBF_CHECK_EQ(mask.shown[0], uint64_t{ 0b001 });
+}
+
+KBF_TEST(layer_lets_the_top_mask_win) {
+    PartVisibilityMask bottom, top;
+    bottom.reset(70);
+    top.reset(70);
+    bottom.overridden = { 0b0011, 1 }; bottom.shown = { 0b0001, 1 };
+    top.overridden    = { 0b0110, 0 }; top.shown    = { 0b0100, 0 };
+
+    bottom.layer(top);
+    KBF_CHECK_EQ(bottom.overridden[0], uint64_t{ 0b0111 });
+    KBF_CHECK_EQ(bottom.shown[0],      uint64_t{ 0b0101 });
+    KBF_CHECK_EQ(bottom.shown[1],      uint64_t{ 1 }); // Untouched where top doesn't override
+}
+
+KBF_TEST(diff_emits_only_changes) {
+    PartVisibilityMask desired, committed;
+    desired.reset(3);
+    committed.reset(3);
+    desired.overridden = { 0b011 }; desired.shown = { 0b001 };
+
+    std::vector<std::pair<size_t, bool>> writes;
+    auto collect = [&](size_t idx, bool shown) { writes.emplace_back(idx, shown); };
+    PartVisibilityMask::diff(desired, committed, collect);
+    KBF_CHECK((writes == std::vector<std::pair<size_t, bool>>{ { 0, true }, { 1, false } }));
+
+    writes.clear();
+    PartVisibilityMask::diff(desired, committed, collect);
+    KBF_CHECK(writes.empty());
+
+    desired.shown = { 0b010 };
+    PartVisibilityMask::diff(desired, committed, collect);
+    KBF_CHECK((writes == std::vector<std::pair<size_t, bool>>{ { 0, false }, { 1, true } }));
+}
+
+KBF_TEST(cache_recompiles_only_after_an_edit) {
+    std::mt19937 rng{ 3 };
+    const std::vector<MeshPart> parts = makeParts(20, rng);
+    Overrides overrides{};
+    overrides.parts.insert({ parts[4], true });
+    markEdited(overrides);
+
+    CompiledPartMaskCache cache;
+    KBF_CHECK(cache.find(&overrides, 1, overrides.generation, 0) == nullptr);
+    cache.compile(&overrides, 1, overrides.generation, 0, overrides.parts, parts);
+    for (uint64_t plan = 1; plan < 100; plan++) KBF_CHECK(cache.find(&overrides, 1, overrides.generation, plan) != nullptr);
+    KBF_CHECK(cache.find(&overrides, 2, overrides.generation, 100) == nullptr); // Other pieces are their own entries
+    KBF_CHECK_EQ(cache.getCompiles(), uint64_t{ 1 });
+
+    overrides.parts.insert({ parts[5], false });
+    markEdited(overrides);
+    KBF_CHECK(cache.find(&overrides, 1, overrides.generation, 101) == nullptr);
+    const PartVisibilityMask& recompiled = cache.compile(&overrides, 1, overrides.generation, 101, overrides.parts, parts);
+    KBF_CHECK_EQ(cache.size(), size_t{ 1 }); // In place
+    KBF_CHECK_EQ(std::popcount(recompiled.overridden[0]), 2);
+}
+
+KBF_TEST(cache_reuses_entries_gone_stale) {
+    std::mt19937 rng{ 5 };
+    const std::vector<MeshPart> parts = makeParts(8, rng);
+    std::array<Overrides, 4> presets{};
+    for (Overrides& preset : presets) markEdited(preset);
+
+    CompiledPartMaskCache cache;
+    cache.compile(&presets[0], 0, presets[0].generation, 0, presets[0].parts, parts);
+    cache.compile(&presets[1], 0, presets[1].generation, 0, presets[1].parts, parts);
+
+    // Both still in use - a third preset gets a new entry.
+    cache.compile(&presets[2], 0, presets[2].generation, 10, presets[2].parts, parts);
+    KBF_CHECK_EQ(cache.size(), size_t{ 3 });
+
+    // Long after the first two were last used, a fourth replaces one of them.
+    const uint64_t later = CompiledPartMaskCache::STALE_PLANS + 20;
+    cache.find(&presets[2], 0, presets[2].generation, later);
+    cache.compile(&presets[3], 0, presets[3].generation, later, presets[3].parts, parts);
+    KBF_CHECK_EQ(cache.size(), size_t{ 3 });
+    KBF_CHECK(cache.find(&presets[2], 0, presets[2].generation, later) != nullptr);
+}
+
+// Presets edited in place the way the editor does (toggle via erase & insert, add, delete, replace wholesale) while
+//  characters switch between them, planned through the compiled cache - the engine must end up exactly where writing
+//  every overridden part every frame, as PartManager used to, leaves it.
+KBF_TEST(planned_parts_match_writing_every_override) {
+    std::mt19937 rng{ 1234 };
+    uint64_t baselineWrites = 0, plannedWrites = 0;
+    size_t mismatches = 0;
+
+    for (int trial = 0; trial < 200 && mismatches == 0; trial++) {
+        std::array<std::vector<MeshPart>, PIECES> parts;
+        for (std::vector<MeshPart>& pieceParts : parts) pieceParts = makeParts(rng() % 140, rng); // Up to 3 words
+
+        std::vector<Overrides> presets(6);
+        auto randomize = [&](Overrides& preset) {
+            preset.parts.clear();
+            for (const std::vector<MeshPart>& pieceParts : parts) {
+                for (const MeshPart& part : pieceParts) {
+                    if (rng() % 4 == 0) preset.parts.insert(OverrideMeshPart{ part, rng() % 2 == 0 });
+                }
+            }
+            preset.parts.insert(OverrideMeshPart{ MeshPart{ "Not On Mesh", 3 }, false });
+            markEdited(preset);
+        };
+        for (Overrides& preset : presets) randomize(preset);
+
+        PlannedParts planner{};
+        for (int i = 0; i < PIECES; i++) planner.parts[i] = &parts[i];
+        planner.resyncInterval = 1 + rng() % 40;
+        planner.init();
+
+        std::map<std::pair<int, uint64_t>, bool> baselineEngine, plannedEngine;
+        std::array<std::array<int, 2>, PIECES> choice{};
+
+        for (int frame = 0; frame < 200; frame++) {
+            Overrides& target = presets[rng() % presets.size()];
+            switch (rng() % 10) {
+            case 0:
+                if (!target.parts.empty()) {
+                    const auto it = std::next(target.parts.begin(), rng() % target.parts.size());
+                    OverrideMeshPart toggled = *it;
+                    toggled.shown = !toggled.shown;
+                    target.parts.erase(it);
+                    target.parts.insert(toggled);
+                    markEdited(target);
+                }
+                break;
+            case 1:
+                if (!target.parts.empty()) {
+                    target.parts.erase(std::next(target.parts.begin(), rng() % target.parts.size()));
+                    markEdited(target);
+                }
+                break;
+            case 2: {
+                const std::vector<MeshPart>& pieceParts = parts[rng() % PIECES];
+                if (!pieceParts.empty()) {
+                    target.parts.insert(OverrideMeshPart{ pieceParts[rng() % pieceParts.size()], rng() % 2 == 0 });
+                    markEdited(target);
+                }
+                break;
+            }
+            case 3:
+                if (rng() % 4 == 0) randomize(target);
+                break;
+            default:
+                break;
+            }
+
+            // Set-wide & active preset per piece (6 = none), switched now & then.
+            if (frame == 0 || rng() % 15 == 0) {
+                for (std::array<int, 2>& pick : choice) pick = { static_cast<int>(rng() % 7), static_cast<int>(rng() % 7) };
+            }
+
+            for (int i = 1; i < PIECES; i++) {
+                for (int layer = 0; layer < 2; layer++) {
+                    const Overrides* preset = choice[i][layer] == 6 ? nullptr : &presets[choice[i][layer]];
+                    if (preset == nullptr) continue;
+
+                    // Baseline: every overridden part written, every frame, set-wide then active.
+                    for (const MeshPart& part : parts[i]) {
+                        const auto it = preset->parts.find(part);
+                        if (it == preset->parts.end()) continue;
+                        baselineEngine[{ i, part.index }] = it->shown;
+                        baselineWrites++;
+                    }
+                    planner.plan(preset, i);
+                }
+            }
+            planner.finish([&](int piece, uint64_t index, bool shown) {
+                plannedEngine[{ piece, index }] = shown;
+                plannedWrites++;
+            });
+
+            if (baselineEngine != plannedEngine) mismatches++;
+        }
+    }
+
+    KBF_CHECK_EQ(mismatches, size_t{ 0 });
+    KBF_CHECK(plannedWrites < baselineWrites);
+}
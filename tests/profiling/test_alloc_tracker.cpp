@@ -0,0 +1,241 @@
+#include <kbf_test.hpp>
+
+#include <kbf/profiling/alloc_tracker.hpp>
+
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace kbf;
+
+// Links alloc_tracker.cpp, so every allocation in this binary goes through the tracker's replacement operator new -
+//  the same setup as the plugin.
+
+namespace {
+
+    // Each test starts from a clean, enabled tracker with assert mode on.
+    struct TrackerFixture {
+        TrackerFixture() {
+            AllocTracker::setEnabled(true);
+            AllocTracker::setAssertZero(true);
+            AllocTracker::reset();
+        }
+        ~TrackerFixture() {
+            AllocTracker::setAssertZero(false);
+            AllocTracker::setEnabled(false);
+            AllocTracker::reset();
+        }
+    };
+
+    // Through a volatile pointer, so the compiler can't elide the allocation pair.
+    void allocateBytes(size_t bytes) {
+        void* volatile ptr = ::operator new(bytes);
+        ::operator delete(ptr);
+    }
+
+    AllocCounters since(const AllocCounters& before) {
+        const AllocCounters after = AllocTracker::threadCounters();
+        return AllocCounters{ after.allocations - before.allocations, after.bytes - before.bytes };
+    }
+
+}
+
+KBF_TEST(counts_allocations_and_bytes_on_this_thread) {
+    TrackerFixture fixture;
+
+    const AllocCounters before = AllocTracker::threadCounters();
+    allocateBytes(100);
+    allocateBytes(28);
+    const AllocCounters made = since(before);
+
+    KBF_CHECK_EQ(made.allocations, 2u);
+    KBF_CHECK_EQ(made.bytes, 128u);
+}
+
+KBF_TEST(counts_every_allocation_form) {
+    TrackerFixture fixture;
+
+    const AllocCounters before = AllocTracker::threadCounters();
+    {
+        auto single  = std::make_unique<int>(1);
+        auto array   = std::make_unique<int[]>(4);
+        auto aligned = std::make_unique<std::max_align_t[]>(2);
+        void* volatile overAligned = ::operator new(64, std::align_val_t{ 64 });
+        ::operator delete(overAligned, std::align_val_t{ 64 });
+        void* volatile noThrow = ::operator new(8, std::nothrow);
+        ::operator delete(noThrow);
+    }
+    KBF_CHECK_EQ(since(before).allocations, 5u);
+}
+
+KBF_TEST(disabled_tracker_counts_nothing) {
+    TrackerFixture fixture;
+    AllocTracker::setEnabled(false);
+
+    const AllocCounters before = AllocTracker::threadCounters();
+    {
+        ALLOC_TRACKER_EXPECT_NONE(scope);
+        allocateBytes(64);
+    }
+    KBF_CHECK_EQ(since(before).allocations, 0u);
+    KBF_CHECK_EQ(AllocTracker::getViolations(), 0u);
+}
+
+KBF_TEST(frame_counters_roll_over_on_begin_frame) {
+    TrackerFixture fixture;
+
+    AllocTracker::beginFrame();
+    allocateBytes(10);
+    allocateBytes(20);
+    allocateBytes(30);
+    AllocTracker::beginFrame();
+    KBF_CHECK_EQ(AllocTracker::getLastFrameAllocations(), 3u);
+    KBF_CHECK_EQ(AllocTracker::getLastFrameBytes(), 60u);
+
+    allocateBytes(5);
+    AllocTracker::beginFrame();
+    KBF_CHECK_EQ(AllocTracker::getLastFrameAllocations(), 1u);
+    KBF_CHECK_EQ(AllocTracker::getLastFrameBytes(), 5u);
+    KBF_CHECK_EQ(AllocTracker::getMaxFrameAllocations(), 3u);
+    KBF_CHECK_EQ(AllocTracker::getMaxFrameBytes(), 60u);
+
+    AllocTracker::reset();
+    KBF_CHECK_EQ(AllocTracker::getLastFrameAllocations(), 0u);
+    KBF_CHECK_EQ(AllocTracker::getMaxFrameAllocations(), 0u);
+}
+
+KBF_TEST(only_allocations_inside_a_scope_are_violations) {
+    TrackerFixture fixture;
+
+    allocateBytes(16);
+    KBF_CHECK_EQ(AllocTracker::getViolations(), 0u);
+
+    {
+        ALLOC_TRACKER_EXPECT_NONE(scope);
+        allocateBytes(16);
+        allocateBytes(16);
+    }
+    KBF_CHECK_EQ(AllocTracker::getViolations(), 2u);
+
+    allocateBytes(16);
+    KBF_CHECK_EQ(AllocTracker::getViolations(), 2u);
+}
+
+KBF_TEST(violations_need_assert_mode) {
+    TrackerFixture fixture;
+    AllocTracker::setAssertZero(false);
+
+    const AllocCounters before = AllocTracker::threadCounters();
+    {
+        ALLOC_TRACKER_EXPECT_NONE(scope);
+        allocateBytes(16);
+    }
+    KBF_CHECK_EQ(since(before).allocations, 1u); // Still counted...
+    KBF_CHECK_EQ(AllocTracker::getViolations(), 0u); // ...just not a violation
+}
+
+KBF_TEST(violating_frames_are_counted_once_per_frame) {
+    TrackerFixture fixture;
+
+    AllocTracker::beginFrame();
+    {
+        ALLOC_TRACKER_EXPECT_NONE(scope);
+        allocateBytes(1);
+        allocateBytes(1);
+    }
+    AllocTracker::beginFrame();
+    allocateBytes(1);               // Clean frame
+    AllocTracker::beginFrame();
+    {
+        ALLOC_TRACKER_EXPECT_NONE(scope);
+        allocateBytes(1);
+    }
+    AllocTracker::beginFrame();
+
+    KBF_CHECK_EQ(AllocTracker::getViolations(), 3u);
+    KBF_CHECK_EQ(AllocTracker::getViolatingFrames(), 2u);
+}
+
+KBF_TEST(scopes_nest) {
+    TrackerFixture fixture;
+
+    {
+        ALLOC_TRACKER_EXPECT_NONE(outer);
+        {
+            ALLOC_TRACKER_EXPECT_NONE(inner);
+        }
+        // Closing the inner scope must not end the outer one
+        allocateBytes(8);
+    }
+    KBF_CHECK_EQ(AllocTracker::getViolations(), 1u);
+}
+
+KBF_TEST(allow_scope_suspends_and_restores) {
+    TrackerFixture fixture;
+
+    {
+        ALLOC_TRACKER_EXPECT_NONE(outer);
+        {
+            ALLOC_TRACKER_EXPECT_NONE(inner);
+            {
+                ALLOC_TRACKER_ALLOW(allowed);
+                allocateBytes(32);
+                std::vector<int> grown(100);
+            }
+            KBF_CHECK_EQ(AllocTracker::getViolations(), 0u);
+
+            allocateBytes(8); // Both levels back in force
+        }
+        allocateBytes(8);
+    }
+    KBF_CHECK_EQ(AllocTracker::getViolations(), 2u);
+
+    // Outside any scope it's a no-op, and leaves nothing behind
+    {
+        ALLOC_TRACKER_ALLOW(allowed);
+    }
+    allocateBytes(8);
+    KBF_CHECK_EQ(AllocTracker::getViolations(), 2u);
+}
+
+KBF_TEST(scopes_are_per_thread) {
+    TrackerFixture fixture;
+
+    // Another thread allocating while this one is in a scope isn't a violation
+    {
+        ALLOC_TRACKER_EXPECT_NONE(scope);
+        std::thread worker;
+        {
+            ALLOC_TRACKER_ALLOW(spawn); // Starting the thread allocates on this one
+            worker = std::thread([] { allocateBytes(64); });
+        }
+        worker.join();
+    }
+    KBF_CHECK_EQ(AllocTracker::getViolations(), 0u);
+
+    // Work handed to another thread needs its own scope there
+    std::thread([] {
+        ALLOC_TRACKER_EXPECT_NONE(workerScope);
+        allocateBytes(64);
+    }).join();
+    KBF_CHECK_EQ(AllocTracker::getViolations(), 1u);
+}
+
+KBF_TEST(first_violation_is_reported) {
+    TrackerFixture fixture;
+
+    KBF_CHECK_EQ(AllocTracker::formatFirstViolation(), std::string("No violations recorded."));
+    {
+        ALLOC_TRACKER_EXPECT_NONE(scope);
+        allocateBytes(48);
+        allocateBytes(96); // Only the first is kept
+    }
+
+    const std::string report = AllocTracker::formatFirstViolation();
+    KBF_CHECK(report.rfind("First violation: 48 byte allocation", 0) == 0);
+
+    AllocTracker::reset();
+    KBF_CHECK_EQ(AllocTracker::formatFirstViolation(), std::string("No violations recorded."));
+}
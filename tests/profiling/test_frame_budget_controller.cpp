@@ -0,0 +1,197 @@
+#include <kbf_test.hpp>
+
+#include <kbf/profiling/frame_budget_controller.hpp>
+
+#include <cmath>
+#include <random>
+
+using namespace kbf;
+
+namespace {
+
+    KBFSettings adaptiveSettings() {
+        KBFSettings settings{};
+        settings.enableAdaptiveBudget              = true;
+        settings.adaptiveBudgetUs                  = 1000.0f;
+        settings.maxConcurrentApplications         = 40;
+        settings.maxBoneFetchesPerFrame            = 8;
+        settings.applicationRange                  = 60.0f;
+        settings.adaptiveMinConcurrentApplications = 4;
+        settings.adaptiveMinBoneFetchesPerFrame    = 1;
+        settings.adaptiveMinApplicationRange       = 15.0f;
+        return settings;
+    }
+
+    // Feeds frames until the smoothed cost crosses the budget & the first decrease lands.
+    int driveUntilDecrease(FrameBudgetController& controller, const KBFSettings& settings, double costUs) {
+        for (int frame = 1; frame <= 1000; frame++) {
+            controller.update(settings, costUs);
+            if (controller.getScale() < 1.0) return frame;
+        }
+        return -1;
+    }
+
+}
+
+KBF_TEST(disabled_passes_settings_through) {
+    KBFSettings settings = adaptiveSettings();
+    settings.enableAdaptiveBudget = false;
+
+    FrameBudgetController controller;
+    for (int i = 0; i < 100; i++) controller.update(settings, 50000.0);
+
+    KBF_CHECK_EQ(controller.getScale(), 1.0);
+    const FrameBudgetLimits limits = controller.getLimits(settings);
+    KBF_CHECK_EQ(limits.maxConcurrentApplications, settings.maxConcurrentApplications);
+    KBF_CHECK_EQ(limits.maxBoneFetchesPerFrame, settings.maxBoneFetchesPerFrame);
+    KBF_CHECK_EQ(limits.applicationRange, settings.applicationRange);
+}
+
+KBF_TEST(over_budget_backs_off_multiplicatively) {
+    const KBFSettings settings = adaptiveSettings();
+    FrameBudgetController controller;
+
+    KBF_REQUIRE(driveUntilDecrease(controller, settings, 5000.0) > 0);
+    KBF_CHECK_EQ(controller.getScale(), FrameBudgetController::DECREASE_FACTOR);
+
+    // Still over budget once the cooldown is up - backs off again, by the same factor
+    for (int i = 0; i <= FrameBudgetController::DECREASE_COOLDOWN; i++) controller.update(settings, 5000.0);
+    KBF_CHECK_EQ(controller.getScale(), FrameBudgetController::DECREASE_FACTOR * FrameBudgetController::DECREASE_FACTOR);
+
+    const FrameBudgetLimits limits = controller.getLimits(settings);
+    KBF_CHECK(limits.maxConcurrentApplications < settings.maxConcurrentApplications);
+    KBF_CHECK(limits.applicationRange < settings.applicationRange);
+}
+
+KBF_TEST(cooldown_holds_scale_after_a_decrease) {
+    const KBFSettings settings = adaptiveSettings();
+    FrameBudgetController controller;
+
+    KBF_REQUIRE(driveUntilDecrease(controller, settings, 5000.0) > 0);
+    const double afterDecrease = controller.getScale();
+
+    // Neither a further decrease (still over budget)...
+    for (int i = 0; i < FrameBudgetController::DECREASE_COOLDOWN; i++) {
+        controller.update(settings, 5000.0);
+        KBF_CHECK_EQ(controller.getScale(), afterDecrease);
+    }
+    // ...until the cooldown runs out
+    controller.update(settings, 5000.0);
+    KBF_CHECK(controller.getScale() < afterDecrease);
+
+    // Nor an increase, even when the very next frames are free
+    FrameBudgetController recovering;
+    KBF_REQUIRE(driveUntilDecrease(recovering, settings, 5000.0) > 0);
+    const double held = recovering.getScale();
+    for (int i = 0; i < FrameBudgetController::DECREASE_COOLDOWN; i++) {
+        recovering.update(settings, 0.0);
+        KBF_CHECK_EQ(recovering.getScale(), held);
+    }
+}
+
+KBF_TEST(recovers_additively_once_under_threshold) {
+    const KBFSettings settings = adaptiveSettings();
+    FrameBudgetController controller;
+
+    KBF_REQUIRE(driveUntilDecrease(controller, settings, 5000.0) > 0);
+    for (int i = 0; i < FrameBudgetController::DECREASE_COOLDOWN; i++) controller.update(settings, 0.0);
+
+    // Wait out the EMA, then each frame under the threshold adds INCREASE_STEP
+    while (controller.getSmoothedCostUs() >= settings.adaptiveBudgetUs * FrameBudgetController::INCREASE_THRESHOLD) {
+        controller.update(settings, 0.0);
+    }
+    const double before = controller.getScale();
+    controller.update(settings, 0.0);
+    KBF_CHECK(std::abs(controller.getScale() - (before + FrameBudgetController::INCREASE_STEP)) < 1e-9);
+
+    // ...back up to, and never past, the configured limits
+    for (int i = 0; i < 200; i++) controller.update(settings, 0.0);
+    KBF_CHECK_EQ(controller.getScale(), 1.0);
+
+    const FrameBudgetLimits limits = controller.getLimits(settings);
+    KBF_CHECK_EQ(limits.maxConcurrentApplications, settings.maxConcurrentApplications);
+    KBF_CHECK_EQ(limits.maxBoneFetchesPerFrame, settings.maxBoneFetchesPerFrame);
+    KBF_CHECK_EQ(limits.applicationRange, settings.applicationRange);
+}
+
+KBF_TEST(holds_steady_between_threshold_and_budget) {
+    const KBFSettings settings = adaptiveSettings();
+    FrameBudgetController controller;
+
+    // 90% of the budget - under it, but not comfortably enough to creep back up
+    for (int i = 0; i < 500; i++) controller.update(settings, settings.adaptiveBudgetUs * 0.9);
+    KBF_CHECK_EQ(controller.getScale(), 1.0);
+
+    KBF_REQUIRE(driveUntilDecrease(controller, settings, 5000.0) > 0);
+    const double afterDecrease = controller.getScale();
+    for (int i = 0; i < 500; i++) controller.update(settings, settings.adaptiveBudgetUs * 0.9);
+    KBF_CHECK_EQ(controller.getScale(), afterDecrease);
+}
+
+KBF_TEST(limits_stay_within_min_max_bounds) {
+    const KBFSettings settings = adaptiveSettings();
+    FrameBudgetController controller;
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> cost(0.0, 4.0 * settings.adaptiveBudgetUs);
+    for (int frame = 0; frame < 20000; frame++) {
+        // Cost loosely tracking how much we let through, plus noise - like the real feedback loop
+        const FrameBudgetLimits limits = controller.getLimits(settings);
+        controller.update(settings, 25.0 * limits.maxConcurrentApplications + cost(rng) * 0.5);
+
+        KBF_REQUIRE(controller.getScale() >= 0.0 && controller.getScale() <= 1.0);
+
+        const FrameBudgetLimits next = controller.getLimits(settings);
+        KBF_REQUIRE(next.maxConcurrentApplications >= settings.adaptiveMinConcurrentApplications);
+        KBF_REQUIRE(next.maxConcurrentApplications <= settings.maxConcurrentApplications);
+        KBF_REQUIRE(next.maxBoneFetchesPerFrame >= settings.adaptiveMinBoneFetchesPerFrame);
+        KBF_REQUIRE(next.maxBoneFetchesPerFrame <= settings.maxBoneFetchesPerFrame);
+        KBF_REQUIRE(next.applicationRange >= settings.adaptiveMinApplicationRange);
+        KBF_REQUIRE(next.applicationRange <= settings.applicationRange);
+    }
+
+    // Sustained overload bottoms out at the minimums, never at 0 (which the trackers read as unlimited)
+    for (int i = 0; i < 2000; i++) controller.update(settings, 100.0 * settings.adaptiveBudgetUs);
+    const FrameBudgetLimits floor = controller.getLimits(settings);
+    KBF_CHECK_EQ(floor.maxConcurrentApplications, settings.adaptiveMinConcurrentApplications);
+    KBF_CHECK_EQ(floor.maxBoneFetchesPerFrame, settings.adaptiveMinBoneFetchesPerFrame);
+    KBF_CHECK(std::abs(floor.applicationRange - settings.adaptiveMinApplicationRange) < 0.01f);
+}
+
+KBF_TEST(unlimited_settings_scale_against_ceilings) {
+    KBFSettings settings = adaptiveSettings();
+    settings.maxConcurrentApplications         = 0;
+    settings.maxBoneFetchesPerFrame            = 0;
+    settings.applicationRange                  = 0.0f;
+    settings.adaptiveMinConcurrentApplications = 0; // Floored to 1
+
+    FrameBudgetController controller;
+    const FrameBudgetLimits unthrottled = controller.getLimits(settings);
+    KBF_CHECK_EQ(unthrottled.maxConcurrentApplications, FrameBudgetController::UNLIMITED_CONCURRENT_APPLICATIONS);
+    KBF_CHECK_EQ(unthrottled.maxBoneFetchesPerFrame, FrameBudgetController::UNLIMITED_BONE_FETCHES_PER_FRAME);
+    KBF_CHECK_EQ(unthrottled.applicationRange, FrameBudgetController::UNLIMITED_APPLICATION_RANGE);
+
+    for (int i = 0; i < 2000; i++) controller.update(settings, 100.0 * settings.adaptiveBudgetUs);
+    const FrameBudgetLimits throttled = controller.getLimits(settings);
+    KBF_CHECK_EQ(throttled.maxConcurrentApplications, 1);
+    KBF_CHECK(throttled.maxBoneFetchesPerFrame >= 1);
+}
+
+KBF_TEST(is_deterministic) {
+    const KBFSettings settings = adaptiveSettings();
+    FrameBudgetController a;
+    FrameBudgetController b;
+
+    std::mt19937 rng(3);
+    for (int frame = 0; frame < 5000; frame++) {
+        const double cost = static_cast<double>(rng() % 3000);
+        a.update(settings, cost);
+        b.update(settings, cost);
+        KBF_REQUIRE(a.getScale() == b.getScale());
+    }
+
+    // reset() returns to the unthrottled starting state
+    a.reset();
+    KBF_CHECK_EQ(a.getScale(), 1.0);
+    KBF_CHECK_EQ(a.getSmoothedCostUs(), 0.0);
+}
@@ -0,0 +1,172 @@
+// Writes fixtures/scripted_session.kbfr, the recording test_tracker_replay replays. Recordings made in game use
+//  wall-clock frame times, so this one is written by hand instead: every frame is exactly 20ms apart, which lets the
+//  test's expected stats be worked out frame by frame (see the comments below & in test_tracker_replay.cpp).
+//
+//  Usage: make_tracker_fixture <out.kbfr>
+
+#include <kbf/replay/tracker_recording.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string_view>
+#include <vector>
+
+using namespace kbf;
+
+namespace {
+
+    constexpr uint32_t FRAME_US = 20000;
+
+    class FixtureWriter {
+    public:
+        FixtureWriter() {
+            bytes.insert(bytes.end(), std::begin(TRACKER_RECORDING_MAGIC), std::end(TRACKER_RECORDING_MAGIC));
+            write(TRACKER_RECORDING_VERSION);
+        }
+
+        void frame(uint16_t maxConcurrentApplications) {
+            write(TrackerEventType::FRAME);
+            write(FRAME_US);
+            write(maxConcurrentApplications);
+        }
+
+        void reset(TrackedCharacterKind kind) {
+            write(TrackerEventType::RESET);
+            write(kind);
+        }
+
+        void join(TrackedCharacterKind kind, uint16_t slot, bool female, std::string_view id, std::string_view name) {
+            slotEvent(TrackerEventType::JOIN, kind, slot);
+            write(static_cast<uint8_t>(female));
+            writeString(id);
+            writeString(name);
+        }
+
+        void leave(TrackedCharacterKind kind, uint16_t slot)   { slotEvent(TrackerEventType::LEAVE, kind, slot); }
+        void refetch(TrackedCharacterKind kind, uint16_t slot) { slotEvent(TrackerEventType::REFETCH, kind, slot); }
+
+        void fetched(TrackedCharacterKind kind, uint16_t slot, bool applyDelay) {
+            slotEvent(TrackerEventType::FETCHED, kind, slot);
+            write(static_cast<uint8_t>(applyDelay));
+        }
+
+        void sample(TrackedCharacterKind kind, uint16_t slot, bool visible, float distanceSq) {
+            slotEvent(TrackerEventType::SAMPLE, kind, slot);
+            write(static_cast<uint8_t>(visible));
+            write(distanceSq);
+        }
+
+        // Join, fetch & first sample in one go, as the trackers record a character that's fully fetched on arrival.
+        void arrive(TrackedCharacterKind kind, uint16_t slot, std::string_view id, bool applyDelay, float distanceSq) {
+            join(kind, slot, false, id, id);
+            fetched(kind, slot, applyDelay);
+            sample(kind, slot, true, distanceSq);
+        }
+
+        bool save(const char* path) const {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+            return file.good();
+        }
+
+    private:
+        template <typename T>
+        void write(const T& value) {
+            const size_t at = bytes.size();
+            bytes.resize(at + sizeof(T));
+            std::memcpy(bytes.data() + at, &value, sizeof(T));
+        }
+
+        void writeString(std::string_view str) {
+            write(static_cast<uint16_t>(str.size()));
+            bytes.insert(bytes.end(), str.begin(), str.end());
+        }
+
+        void slotEvent(TrackerEventType type, TrackedCharacterKind kind, uint16_t slot) {
+            write(type);
+            write(kind);
+            write(slot);
+        }
+
+        std::vector<char> bytes;
+    };
+
+}
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        std::fprintf(stderr, "usage: %s <out.kbfr>\n", argv[0]);
+        return 2;
+    }
+
+    constexpr auto PLAYER = TrackedCharacterKind::PLAYER;
+    constexpr auto NPC    = TrackedCharacterKind::NPC;
+
+    // Times are at the end of each frame; the test replays with a 50ms apply delay & the recorded limit.
+    FixtureWriter w;
+
+    // 0 (20ms): scene load
+    w.frame(2);
+    w.reset(PLAYER);
+    w.reset(NPC);
+
+    // 1 (40ms): one player arrives with an apply delay (runs out at 90ms), three NPCs without
+    w.frame(2);
+    w.join(PLAYER, 0, true, "HUNTER0", "Alpha");
+    w.fetched(PLAYER, 0, true);
+    w.sample(PLAYER, 0, true, 4.0f);
+    w.arrive(NPC, 0, "NPC_A", false, 1.0f);
+    w.arrive(NPC, 1, "NPC_B", false, 9.0f);
+    w.arrive(NPC, 2, "NPC_C", false, 25.0f);
+
+    // 2, 3 (60, 80ms): player still delayed
+    w.frame(2);
+    w.frame(2);
+
+    // 4 (100ms): player's delay has run out
+    w.frame(2);
+
+    // 5 (120ms): NPC 1 changes state & is swapped out for a new one, delayed until 170ms
+    w.frame(2);
+    w.refetch(NPC, 1);
+    w.leave(NPC, 1);
+    w.arrive(NPC, 1, "NPC_D", true, 9.0f);
+
+    // 6 (140ms): player goes out of view
+    w.frame(2);
+    w.sample(PLAYER, 0, false, 4.0f);
+
+    // 7 (160ms)
+    w.frame(2);
+
+    // 8 (180ms): NPC 1's delay has run out
+    w.frame(2);
+
+    // 9 (200ms): limit drops to 1 - equip hook burst on player 0, who's back in view, & a second, nearer player
+    w.frame(1);
+    w.refetch(PLAYER, 0);
+    w.refetch(PLAYER, 0);
+    w.join(PLAYER, 1, false, "HUNTER1", "Beta");
+    w.fetched(PLAYER, 1, false);
+    w.sample(PLAYER, 1, true, 1.0f);
+    w.sample(PLAYER, 0, true, 2.0f);
+
+    // 10 (220ms): player 0 leaves, NPCs are cleared by an area change
+    w.frame(2);
+    w.leave(PLAYER, 0);
+    w.reset(NPC);
+
+    // 11 (240ms): no limit, four NPCs arrive at once
+    w.frame(0);
+    w.arrive(NPC, 0, "NPC_E", false, 1.0f);
+    w.arrive(NPC, 1, "NPC_F", false, 2.0f);
+    w.arrive(NPC, 2, "NPC_G", false, 3.0f);
+    w.arrive(NPC, 3, "NPC_H", false, 4.0f);
+
+    if (!w.save(argv[1])) {
+        std::fprintf(stderr, "failed to write %s\n", argv[1]);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,166 @@
+#include <kbf_test.hpp>
+
+#include <kbf/replay/tracker_replay.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+using namespace kbf;
+
+namespace {
+
+    constexpr size_t PLAYER = static_cast<size_t>(TrackedCharacterKind::PLAYER);
+    constexpr size_t NPC    = static_cast<size_t>(TrackedCharacterKind::NPC);
+
+    // Written by make_tracker_fixture - the frame by frame script is in there.
+    const std::filesystem::path FIXTURE = std::filesystem::path(KBF_TEST_FIXTURE_DIR) / "scripted_session.kbfr";
+
+    TrackerRecording loadFixture() {
+        TrackerRecording recording{};
+        KBF_REQUIRE(readTrackerRecording(FIXTURE, recording));
+        return recording;
+    }
+
+    TrackerReplayOptions fixtureOptions() {
+        TrackerReplayOptions options{};
+        options.delayOnEquip = 0.05f;
+        return options;
+    }
+
+}
+
+KBF_TEST(fixture_reads_completely) {
+    const TrackerRecording recording = loadFixture();
+    KBF_CHECK_EQ(recording.frames.size(), size_t{ 12 });
+    KBF_CHECK_EQ(recording.eventCount, size_t{ 40 });
+    KBF_CHECK_EQ(recording.frames[9].maxConcurrentApplications, uint16_t{ 1 });
+    KBF_CHECK_EQ(recording.frames[1].events[0].name, std::string("Alpha"));
+}
+
+KBF_TEST(fixture_stats) {
+    const TrackerRecording recording = loadFixture();
+    TrackerReplay replay{ fixtureOptions() };
+    const TrackerReplayStats stats = replay.run(recording);
+
+    KBF_CHECK_EQ(stats.frames, size_t{ 12 });
+    KBF_CHECK_EQ(stats.events, size_t{ 40 });
+    KBF_CHECK(stats.durationSec > 0.2399 && stats.durationSec < 0.2401);
+    KBF_CHECK_EQ(stats.resets, size_t{ 3 });
+
+    KBF_CHECK_EQ(stats.joins[PLAYER],        size_t{ 2 });
+    KBF_CHECK_EQ(stats.leaves[PLAYER],       size_t{ 1 });
+    KBF_CHECK_EQ(stats.refetches[PLAYER],    size_t{ 2 });
+    KBF_CHECK_EQ(stats.peakOccupied[PLAYER], size_t{ 2 });
+    KBF_CHECK_EQ(stats.applications[PLAYER], size_t{ 5 });  // Frames 4, 5, 9, 10, 11
+    KBF_CHECK_EQ(stats.overLimit[PLAYER],    size_t{ 1 });  // Frame 9, player 0 behind the nearer player 1
+
+    KBF_CHECK_EQ(stats.joins[NPC],        size_t{ 8 });
+    KBF_CHECK_EQ(stats.leaves[NPC],       size_t{ 1 });
+    KBF_CHECK_EQ(stats.refetches[NPC],    size_t{ 1 });
+    KBF_CHECK_EQ(stats.peakOccupied[NPC], size_t{ 4 });
+    KBF_CHECK_EQ(stats.applications[NPC], size_t{ 18 });
+    KBF_CHECK_EQ(stats.overLimit[NPC],    size_t{ 10 });
+
+    KBF_CHECK_EQ(stats.maxJoinsPerFrame,        size_t{ 4 });
+    KBF_CHECK_EQ(stats.maxRefetchesPerFrame,    size_t{ 2 });
+    KBF_CHECK_EQ(stats.maxApplicationsPerFrame, size_t{ 5 });
+}
+
+KBF_TEST(apply_delays_expire_on_the_expected_frame) {
+    const TrackerRecording recording = loadFixture();
+    TrackerReplay replay{ fixtureOptions() };
+
+    std::vector<TrackerReplayFrameResult> frames;
+    replay.run(recording, [&](const TrackerReplayFrameResult& result) { frames.push_back(result); });
+    KBF_REQUIRE(frames.size() == 12);
+
+    // Player 0's delay starts at 40ms & ends at 90ms - held back through frame 3, applied from frame 4.
+    for (size_t f = 1; f <= 3; f++) KBF_CHECK_EQ(frames[f].applications[PLAYER], size_t{ 0 });
+    KBF_CHECK_EQ(frames[4].applications[PLAYER], size_t{ 1 });
+
+    // A delayed NPC still takes its place in the nearest-N selection, so NPC 2 stays over the limit meanwhile.
+    for (size_t f = 5; f <= 7; f++) {
+        KBF_CHECK_EQ(frames[f].applications[NPC], size_t{ 1 });
+        KBF_CHECK_EQ(frames[f].overLimit[NPC],    size_t{ 1 });
+    }
+    KBF_CHECK_EQ(frames[8].applications[NPC], size_t{ 2 });
+
+    // Out of view, not applied - & not counted as over the limit either.
+    KBF_CHECK_EQ(frames[6].applications[PLAYER], size_t{ 0 });
+    KBF_CHECK_EQ(frames[6].overLimit[PLAYER],    size_t{ 0 });
+
+    KBF_CHECK_EQ(frames[10].occupied[NPC], size_t{ 0 });
+    KBF_CHECK_EQ(frames[11].applications[NPC], size_t{ 4 });
+}
+
+KBF_TEST(zero_delay_applies_on_arrival) {
+    const TrackerRecording recording = loadFixture();
+    TrackerReplay replay{ TrackerReplayOptions{} };
+
+    std::vector<TrackerReplayFrameResult> frames;
+    replay.run(recording, [&](const TrackerReplayFrameResult& result) { frames.push_back(result); });
+    KBF_REQUIRE(frames.size() == 12);
+
+    // A 0s delay runs out in the same frame's advance, between fetching & selecting.
+    KBF_CHECK_EQ(frames[1].applications[PLAYER], size_t{ 1 });
+    KBF_CHECK_EQ(frames[5].applications[NPC],    size_t{ 2 });
+}
+
+KBF_TEST(limit_override_replaces_recorded_limit) {
+    const TrackerRecording recording = loadFixture();
+    TrackerReplayOptions options = fixtureOptions();
+    options.maxConcurrentApplicationsOverride = 0; // No limit
+    TrackerReplay replay{ options };
+    const TrackerReplayStats stats = replay.run(recording);
+
+    KBF_CHECK_EQ(stats.overLimit[PLAYER], size_t{ 0 });
+    KBF_CHECK_EQ(stats.overLimit[NPC],    size_t{ 0 });
+    KBF_CHECK_EQ(stats.applications[PLAYER], size_t{ 6 });
+    KBF_CHECK_EQ(stats.applications[NPC],    size_t{ 28 });
+}
+
+KBF_TEST(replays_are_repeatable) {
+    const TrackerRecording recording = loadFixture();
+    TrackerReplay replay{ fixtureOptions() };
+    const TrackerReplayStats first  = replay.run(recording);
+    const TrackerReplayStats second = replay.run(recording);
+
+    KBF_CHECK(first.applications == second.applications);
+    KBF_CHECK(first.overLimit == second.overLimit);
+    KBF_CHECK(first.peakOccupied == second.peakOccupied);
+}
+
+KBF_TEST(truncated_recording_keeps_complete_frames) {
+    std::ifstream in(FIXTURE, std::ios::binary);
+    std::vector<char> bytes{ std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>() };
+    KBF_REQUIRE(bytes.size() > 8);
+    bytes.resize(bytes.size() - 3); // Cuts into frame 11's last sample
+
+    const std::filesystem::path truncated = std::filesystem::temp_directory_path() / "kbf_test_truncated.kbfr";
+    {
+        std::ofstream out(truncated, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    TrackerRecording recording{};
+    KBF_CHECK(!readTrackerRecording(truncated, recording));
+    KBF_CHECK_EQ(recording.frames.size(), size_t{ 12 });
+    KBF_CHECK_EQ(recording.eventCount, size_t{ 39 });
+    std::filesystem::remove(truncated);
+}
+
+KBF_TEST(bad_header_is_rejected) {
+    const std::filesystem::path bad = std::filesystem::temp_directory_path() / "kbf_test_bad_header.kbfr";
+    {
+        std::ofstream out(bad, std::ios::binary | std::ios::trunc);
+        out << "KBFX\x01";
+    }
+
+    TrackerRecording recording{};
+    KBF_CHECK(!readTrackerRecording(bad, recording));
+    KBF_CHECK(recording.frames.empty());
+    KBF_CHECK(!readTrackerRecording(FIXTURE.parent_path() / "missing.kbfr", recording));
+    std::filesystem::remove(bad);
+}
@@ -0,0 +1,119 @@
+#include <kbf_test.hpp>
+
+#include <kbf/util/algorithm/distance_culler.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace kbf;
+
+namespace {
+
+    constexpr float INF = std::numeric_limits<float>::infinity();
+
+    std::vector<uint32_t> selectedIds(const DistanceCuller& culler, size_t kept) {
+        std::vector<uint32_t> out;
+        for (size_t i = 0; i < kept; i++) out.push_back(culler.selectedId(i));
+        std::sort(out.begin(), out.end());
+        return out;
+    }
+
+    // Everything in range, sorted by distance then cut to the limit. Distances are distinct, so the cut is unambiguous.
+    std::vector<uint32_t> reference(const std::vector<uint32_t>& ids, const std::vector<float>& distancesSq, float range, int limit) {
+        const float maxDistanceSq = range > 0.0f ? range * range : std::numeric_limits<float>::max();
+        std::vector<std::pair<float, uint32_t>> inRange;
+        for (size_t i = 0; i < ids.size(); i++) {
+            if (distancesSq[i] <= maxDistanceSq) inRange.emplace_back(distancesSq[i], ids[i]);
+        }
+        std::sort(inRange.begin(), inRange.end());
+        if (limit > 0 && inRange.size() > static_cast<size_t>(limit)) inRange.resize(static_cast<size_t>(limit));
+
+        std::vector<uint32_t> out;
+        for (const auto& [distanceSq, id] : inRange) out.push_back(id);
+        std::sort(out.begin(), out.end());
+        return out;
+    }
+
+}
+
+KBF_TEST(empty_selects_nothing) {
+    DistanceCuller culler;
+    KBF_CHECK_EQ(culler.select(10.0f, 4), size_t{ 0 });
+    culler.clear();
+    KBF_CHECK_EQ(culler.select(0.0f, 0), size_t{ 0 });
+}
+
+KBF_TEST(unrankable_candidates_are_culled) {
+    DistanceCuller culler;
+    culler.add(1, INF);
+    culler.add(2, std::numeric_limits<float>::quiet_NaN());
+    culler.add(3, 4.0f);
+    KBF_CHECK_EQ(culler.select(0.0f, 0), size_t{ 1 });
+    KBF_CHECK_EQ(culler.selectedId(0), uint32_t{ 3 });
+}
+
+KBF_TEST(range_is_inclusive) {
+    DistanceCuller culler;
+    culler.add(7, 25.0f);
+    culler.add(8, 25.01f);
+    KBF_CHECK_EQ(culler.select(5.0f, 0), size_t{ 1 });
+    KBF_CHECK_EQ(culler.selectedId(0), uint32_t{ 7 });
+}
+
+KBF_TEST(keeps_the_nearest_small_and_large) {
+    for (size_t count : { size_t{ 5 }, DistanceCuller::SMALL_COUNT, DistanceCuller::SMALL_COUNT + 1, size_t{ 200 } }) {
+        DistanceCuller culler;
+        for (uint32_t i = 0; i < count; i++) culler.add(1000 + i, static_cast<float>(count - i)); // Nearest added last
+
+        const size_t kept = culler.select(0.0f, 3);
+        KBF_REQUIRE(kept == 3);
+        const std::vector<uint32_t> expected = { uint32_t(1000 + count - 3), uint32_t(1000 + count - 2), uint32_t(1000 + count - 1) };
+        KBF_CHECK(selectedIds(culler, kept) == expected);
+    }
+}
+
+KBF_TEST(clear_reuses_storage) {
+    DistanceCuller culler;
+    for (uint32_t i = 0; i < 100; i++) culler.add(i, static_cast<float>(i));
+    KBF_CHECK_EQ(culler.select(0.0f, 0), size_t{ 100 });
+    const size_t bytes = culler.getBytes();
+
+    culler.clear();
+    KBF_CHECK_EQ(culler.size(), size_t{ 0 });
+    culler.add(42, 1.0f);
+    KBF_CHECK_EQ(culler.select(0.0f, 0), size_t{ 1 });
+    KBF_CHECK_EQ(culler.selectedId(0), uint32_t{ 42 });
+    KBF_CHECK_EQ(culler.getBytes(), bytes);
+}
+
+KBF_TEST(matches_reference_selection) {
+    std::mt19937 rng{ 1234 };
+    std::uniform_real_distribution<float> coordinate(0.0f, 60.0f);
+    DistanceCuller culler; // Reused across rounds, as the trackers do
+
+    for (int round = 0; round < 2000; round++) {
+        const size_t count = rng() % 64;
+        const float  range = (rng() % 4 == 0) ? 0.0f : 10.0f + static_cast<float>(rng() % 40);
+        const int    limit = static_cast<int>(rng() % 12) - 1;
+
+        std::vector<uint32_t> ids;
+        std::vector<float> distancesSq;
+        culler.clear();
+        for (size_t i = 0; i < count; i++) {
+            const float x = coordinate(rng);
+            const float z = coordinate(rng);
+            // Nudged by index so no two candidates tie.
+            const float distanceSq = rng() % 6 == 0 ? INF : x * x + z * z + static_cast<float>(i) * 1e-3f;
+            ids.push_back(static_cast<uint32_t>(rng()));
+            distancesSq.push_back(distanceSq);
+            culler.add(ids.back(), distanceSq);
+        }
+
+        const size_t kept = culler.select(range, limit);
+        const std::vector<uint32_t> expected = reference(ids, distancesSq, range, limit);
+        KBF_REQUIRE(kept == expected.size());
+        KBF_CHECK(selectedIds(culler, kept) == expected);
+    }
+}
@@ -0,0 +1,224 @@
+#include <kbf_test.hpp>
+
+#include <kbf/util/memory/frame_arena.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace kbf;
+
+// The arena is per thread & the frame counter global, so these run one after another on the main thread's arena &
+//  each starts its own frame.
+
+namespace {
+
+    size_t registeredArenas() {
+        size_t count = 0;
+        FrameArena::forEach([&](const FrameArena&) { count++; });
+        return count;
+    }
+
+}
+
+KBF_TEST(rewinds_on_first_use_in_a_new_frame) {
+    FrameArena::beginFrame();
+    FrameArena& arena = FrameArena::local();
+    void* first = arena.allocate(128, 16);
+    void* second = arena.allocate(64, 8);
+    arena.deallocate(first, 128, 16); // Out of order - nothing to reuse until the rewind
+    arena.deallocate(second, 64, 8);
+    arena.deallocate(arena.allocate(0, 1), 0, 1);
+
+    FrameArena::beginFrame();
+    KBF_CHECK_EQ(arena.getStats().lastFrameAllocations, uint64_t{ 0 }); // Not rewound until used
+
+    void* again = FrameArena::local().allocate(128, 16);
+    KBF_CHECK(again == first);
+    const FrameArena::Stats stats = arena.getStats();
+    KBF_CHECK_EQ(stats.lastFrameAllocations, uint64_t{ 3 });
+    KBF_CHECK_EQ(stats.lastFrameBytes, uint64_t{ 128 + 64 + 1 });
+    KBF_CHECK(stats.highWaterBytes >= 193);
+    arena.deallocate(again, 128, 16);
+}
+
+KBF_TEST(steady_frames_make_no_chunk_allocations) {
+    FrameArena::beginFrame();
+    const uint64_t chunksBefore = FrameArena::local().getStats().chunkAllocations;
+    for (int frame = 0; frame < 100; frame++) {
+        FrameArena::beginFrame();
+        std::pmr::unordered_map<std::string_view, int> lookup{ &FrameArena::local() };
+        for (int i = 0; i < 40; i++) lookup[std::string_view("material_name").substr(0, 1 + i % 12)] = i;
+        std::pmr::vector<size_t> candidates{ &FrameArena::local() };
+        for (size_t i = 0; i < 200; i++) candidates.push_back(i);
+    }
+    // The first of these frames may grow the arena; after that it's all pointer bumps.
+    KBF_CHECK(FrameArena::local().getStats().chunkAllocations <= chunksBefore + 1);
+}
+
+KBF_TEST(newest_allocation_is_reused_when_handed_back) {
+    FrameArena::beginFrame();
+    FrameArena& arena = FrameArena::local();
+    void* a = arena.allocate(256, 8);
+    arena.deallocate(a, 256, 8);
+    void* b = arena.allocate(256, 8);
+    KBF_CHECK(b == a);
+    arena.deallocate(b, 256, 8);
+}
+
+KBF_TEST(allocations_are_aligned) {
+    FrameArena::beginFrame();
+    FrameArena& arena = FrameArena::local();
+    for (size_t alignment : { 1, 2, 8, 16, 64, 256, 4096 }) {
+        void* odd = arena.allocate(3, 1); // Knocks the cursor off any alignment
+        void* p   = arena.allocate(3, alignment);
+        KBF_CHECK_EQ(reinterpret_cast<uintptr_t>(p) % alignment, uintptr_t{ 0 });
+        arena.deallocate(p, 3, alignment);
+        arena.deallocate(odd, 3, 1);
+    }
+    void* big = arena.allocate(FrameArena::DEFAULT_CHUNK_BYTES * 2, 64); // Bigger than a chunk gets its own
+    KBF_CHECK_EQ(reinterpret_cast<uintptr_t>(big) % 64, uintptr_t{ 0 });
+    arena.deallocate(big, FrameArena::DEFAULT_CHUNK_BYTES * 2, 64);
+}
+
+KBF_TEST(spilled_chunks_merge_into_one) {
+    constexpr size_t A = 100000, B = 200000;
+    auto spill = [] {
+        std::pmr::vector<std::byte> a(A, &FrameArena::local());
+        std::pmr::vector<std::byte> b(B, &FrameArena::local());
+    };
+
+    FrameArena::beginFrame();
+    spill();
+    FrameArena::beginFrame();
+    spill(); // Fits the merged chunk
+    const FrameArena::Stats merged = FrameArena::local().getStats();
+    KBF_CHECK(merged.capacityBytes >= A + B);
+
+    for (int frame = 0; frame < 5; frame++) {
+        FrameArena::beginFrame();
+        spill();
+    }
+    const FrameArena::Stats steady = FrameArena::local().getStats();
+    KBF_CHECK_EQ(steady.chunkAllocations, merged.chunkAllocations);
+    KBF_CHECK_EQ(steady.capacityBytes, merged.capacityBytes);
+}
+
+KBF_TEST(rewound_memory_is_poisoned) {
+    FrameArena::setPoisoning(true);
+    FrameArena::beginFrame();
+    FrameArena& arena = FrameArena::local();
+    auto* bytes = static_cast<uint8_t*>(arena.allocate(64, 1));
+    for (size_t i = 0; i < 64; i++) bytes[i] = 0x11;
+    arena.deallocate(bytes, 64, 1);
+
+    // A stale raw pointer into last frame's memory - the arena keeps the chunk, so it's readable, but poisoned.
+    FrameArena::beginFrame();
+    FrameArena::local();
+    size_t poisoned = 0;
+    for (size_t i = 0; i < 64; i++) poisoned += bytes[i] == FrameArena::POISON_BYTE ? 1 : 0;
+    KBF_CHECK_EQ(poisoned, size_t{ 64 });
+
+    FrameArena::setPoisoning(false);
+    FrameArena::beginFrame();
+    FrameArena::local();
+}
+
+KBF_TEST(escaped_memory_is_counted_and_kept) {
+    FrameArena::setPoisoning(true);
+    FrameArena::beginFrame();
+    const uint64_t escapesBefore = FrameArena::local().getStats().escapes;
+
+    auto* escaped = new std::pmr::vector<int>(1000, 7, &FrameArena::local());
+    FrameArena::beginFrame();
+    std::pmr::vector<int> fresh(1000, 9, &FrameArena::local());
+    KBF_CHECK_EQ(FrameArena::local().getStats().escapes, escapesBefore + 1);
+
+    // Still alive, so neither handed out again nor poisoned.
+    size_t intact = 0;
+    for (int v : *escaped) intact += v == 7 ? 1 : 0;
+    KBF_CHECK_EQ(intact, size_t{ 1000 });
+    KBF_CHECK(reinterpret_cast<uintptr_t>(fresh.data()) != reinterpret_cast<uintptr_t>(escaped->data()));
+
+    delete escaped;
+    fresh = std::pmr::vector<int>(&FrameArena::local());
+    const uint64_t capacityHeld = FrameArena::local().getStats().capacityBytes;
+
+    // Once everything's back, the next rewind lets the set aside chunks go - & there's no new escape.
+    FrameArena::beginFrame();
+    FrameArena::local();
+    KBF_CHECK(FrameArena::local().getStats().capacityBytes < capacityHeld);
+    KBF_CHECK_EQ(FrameArena::local().getStats().escapes, escapesBefore + 1);
+
+    FrameArena::setPoisoning(false);
+}
+
+KBF_TEST(every_thread_gets_its_own_registered_arena) {
+    FrameArena::local();
+    const size_t before = registeredArenas();
+
+    constexpr int THREADS = 3;
+    std::atomic<int> ready{ 0 };
+    std::atomic<bool> release{ false };
+    std::vector<const FrameArena*> arenas(THREADS);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; t++) {
+        threads.emplace_back([&, t] {
+            arenas[t] = &FrameArena::local();
+            ready.fetch_add(1, std::memory_order_release);
+            while (!release.load(std::memory_order_acquire)) std::this_thread::yield();
+        });
+    }
+    while (ready.load(std::memory_order_acquire) < THREADS) std::this_thread::yield();
+
+    KBF_CHECK_EQ(registeredArenas(), before + THREADS);
+    for (int t = 0; t < THREADS; t++) {
+        KBF_CHECK(arenas[t] != &FrameArena::local());
+        for (int u = t + 1; u < THREADS; u++) KBF_CHECK(arenas[t] != arenas[u]);
+    }
+
+    release.store(true, std::memory_order_release);
+    for (std::thread& thread : threads) thread.join();
+    KBF_CHECK_EQ(registeredArenas(), before); // Thread exit unregisters
+}
+
+// Planner threads allocating through their own arenas while frames tick over & a GUI thread reads everyone's stats.
+KBF_TEST(threads_allocate_while_stats_are_read) {
+    const std::vector<std::string> names = { "alpha", "beta", "gamma", "delta", "epsilon", "zeta", "eta", "theta" };
+    std::atomic<bool> stop{ false };
+    std::atomic<uint64_t> mismatches{ 0 };
+
+    std::vector<std::thread> planners;
+    for (int t = 0; t < 3; t++) {
+        planners.emplace_back([&] {
+            for (int i = 0; i < 5000; i++) {
+                std::pmr::unordered_map<std::string_view, int> lookup{ &FrameArena::local() };
+                for (const std::string& name : names) lookup[name] = i;
+                if (lookup.size() != names.size()) mismatches.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+    std::thread reader([&] {
+        uint64_t sum = 0;
+        while (!stop.load(std::memory_order_relaxed)) {
+            FrameArena::forEach([&](const FrameArena& arena) { sum += arena.getStats().lastFrameBytes; });
+            std::this_thread::yield();
+        }
+        (void)sum;
+    });
+    for (int frame = 0; frame < 5000; frame++) {
+        FrameArena::beginFrame();
+        if (frame % 64 == 0) std::this_thread::yield();
+    }
+
+    for (std::thread& planner : planners) planner.join();
+    stop.store(true, std::memory_order_relaxed);
+    reader.join();
+    KBF_CHECK_EQ(mismatches.load(), uint64_t{ 0 });
+}
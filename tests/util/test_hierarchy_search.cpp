@@ -0,0 +1,141 @@
+#include <kbf_test.hpp>
+
+#include <kbf/util/algorithm/hierarchy_search.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace kbf;
+
+namespace {
+
+    // First-child / next-sibling tree, as via.Transform exposes it.
+    struct Node {
+        std::string name;
+        Node* child = nullptr;
+        Node* next  = nullptr;
+        bool  prune = false; // Stands in for a transform without a GameObject
+    };
+
+    struct Tree {
+        std::vector<std::unique_ptr<Node>> nodes;
+
+        Node* make(std::string name) {
+            nodes.push_back(std::make_unique<Node>());
+            nodes.back()->name = std::move(name);
+            return nodes.back().get();
+        }
+
+        // Appends `count` children named prefix0, prefix1, ... under parent, returning the first.
+        Node* addChildren(Node* parent, const std::string& prefix, size_t count) {
+            Node* previous = nullptr;
+            for (size_t i = 0; i < count; i++) {
+                Node* node = make(prefix + std::to_string(i));
+                if (previous) previous->next = node;
+                else          parent->child  = node;
+                previous = node;
+            }
+            return parent->child;
+        }
+    };
+
+    Node* search(Node* root, const std::string& target, size_t maxDepth, size_t maxBreadth, std::vector<std::string>* visited = nullptr) {
+        return searchHierarchy(
+            root,
+            [&](Node* node) {
+                if (visited) visited->push_back(node->name);
+                if (node->prune) return HierarchyVisit::PRUNE;
+                return node->name == target ? HierarchyVisit::MATCH : HierarchyVisit::CONTINUE;
+            },
+            [](Node* node) { return node->child; },
+            [](Node* node) { return node->next; },
+            maxDepth, maxBreadth
+        );
+    }
+
+}
+
+KBF_TEST(finds_the_root_and_misses_cleanly) {
+    Tree tree;
+    Node* root = tree.make("root");
+    tree.addChildren(root, "c", 3);
+
+    KBF_CHECK(search(root, "root", 20, 100) == root);
+    KBF_CHECK(search(root, "c2", 20, 100) == root->child->next->next);
+    KBF_CHECK(search(root, "absent", 20, 100) == nullptr);
+    KBF_CHECK(search(nullptr, "root", 20, 100) == nullptr);
+}
+
+KBF_TEST(walks_each_sibling_chain_before_descending) {
+    Tree tree;
+    Node* root = tree.make("root");
+    Node* a = tree.addChildren(root, "a", 2);
+    tree.addChildren(a, "aa", 2);
+    tree.addChildren(a->next, "ba", 1);
+
+    std::vector<std::string> visited;
+    search(root, "absent", 20, 100, &visited);
+
+    const std::vector<std::string> expected{ "root", "a0", "a1", "ba0", "aa0", "aa1" };
+    KBF_CHECK(visited == expected);
+}
+
+KBF_TEST(wider_than_the_old_fixed_stack) {
+    // Every child of every node in a 600 wide level is pending at once - past the 512 entries the stack used to hold.
+    constexpr size_t WIDTH = 600;
+
+    Tree tree;
+    Node* root = tree.make("root");
+    Node* level = tree.addChildren(root, "n", WIDTH);
+    for (Node* node = level; node != nullptr; node = node->next) tree.addChildren(node, node->name + "_child", 2);
+
+    Node* target = search(root, "n0_child1", 20, WIDTH);
+    KBF_REQUIRE(target != nullptr);
+    KBF_CHECK_EQ(target->name, std::string("n0_child1"));
+
+    // And a single sibling chain far longer than that, found at the end.
+    Tree wide;
+    Node* wideRoot = wide.make("root");
+    wide.addChildren(wideRoot, "s", 5000);
+    Node* last = search(wideRoot, "s4999", 20, 5000);
+    KBF_REQUIRE(last != nullptr);
+    KBF_CHECK_EQ(last->name, std::string("s4999"));
+}
+
+KBF_TEST(depth_and_breadth_limits) {
+    Tree tree;
+    Node* root = tree.make("root");
+    tree.addChildren(root, "s", 10);
+    Node* deep = root->child;
+    for (int depth = 0; depth < 5; depth++) deep = tree.addChildren(deep, "d" + std::to_string(depth) + "_", 1);
+
+    KBF_CHECK(search(root, "s9", 20, 9) != nullptr);
+    KBF_CHECK(search(root, "s9", 20, 8) == nullptr);   // s9 is the 9th hop along the chain
+    KBF_CHECK(search(root, "d4_0", 6, 100) != nullptr);
+    KBF_CHECK(search(root, "d4_0", 5, 100) == nullptr); // root is depth 0, d4_0 depth 6
+}
+
+KBF_TEST(prune_skips_children_and_later_siblings) {
+    Tree tree;
+    Node* root = tree.make("root");
+    Node* first = tree.addChildren(root, "c", 3);
+    first->next->prune = true;
+    tree.addChildren(first->next, "under_pruned", 1);
+
+    KBF_CHECK(search(root, "c0", 20, 100) == first);
+    KBF_CHECK(search(root, "c2", 20, 100) == nullptr);
+    KBF_CHECK(search(root, "under_pruned0", 20, 100) == nullptr);
+}
+
+KBF_TEST(searches_back_to_back_reuse_the_stack) {
+    // A search that returns early must not leave entries behind for the next one.
+    Tree tree;
+    Node* root = tree.make("root");
+    tree.addChildren(root, "c", 50);
+
+    for (int i = 0; i < 3; i++) {
+        KBF_CHECK(search(root, "c0", 20, 100) == root->child);
+        KBF_CHECK(search(root, "absent", 20, 100) == nullptr);
+    }
+}
@@ -0,0 +1,79 @@
+#include <kbf_test.hpp>
+
+#include <kbf/util/hash/minimal_perfect_hash.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace kbf;
+
+namespace {
+
+    std::vector<std::string> prefabPaths(size_t count) {
+        std::vector<std::string> keys;
+        for (size_t i = 0; i < count; i++) keys.push_back("GameDesign/NPC/Prefab/ch" + std::to_string(i * 7919) + "/npc_body_00.pfb");
+        return keys;
+    }
+
+}
+
+KBF_TEST(empty_set_finds_nothing) {
+    MinimalPerfectHash index;
+    KBF_CHECK(index.build({}));
+    KBF_CHECK_EQ(index.size(), size_t{ 0 });
+    KBF_CHECK_EQ(index.find("anything"), MinimalPerfectHash::npos);
+}
+
+KBF_TEST(every_key_gets_its_own_slot) {
+    for (size_t count : { 1, 2, 3, 7, 50, 600, 5000 }) {
+        const std::vector<std::string> keys = prefabPaths(count);
+        const std::vector<std::string_view> views(keys.begin(), keys.end());
+
+        MinimalPerfectHash index;
+        KBF_REQUIRE(index.build(views));
+        KBF_CHECK_EQ(index.size(), count);
+
+        std::vector<int> hits(count, 0);
+        for (std::string_view key : views) {
+            const size_t slot = index.find(key);
+            KBF_REQUIRE(slot < count);
+            hits[slot]++;
+        }
+        for (int h : hits) KBF_CHECK_EQ(h, 1);
+    }
+}
+
+KBF_TEST(unknown_keys_are_rejected) {
+    const std::vector<std::string> keys = prefabPaths(600);
+    MinimalPerfectHash index;
+    KBF_REQUIRE(index.build(std::vector<std::string_view>(keys.begin(), keys.end())));
+
+    size_t falseMatches = 0;
+    for (int i = 0; i < 100000; i++) {
+        if (index.find("GameDesign/NPC/Prefab/other" + std::to_string(i) + ".pfb") != MinimalPerfectHash::npos) falseMatches++;
+    }
+    KBF_CHECK_EQ(falseMatches, size_t{ 0 });
+    KBF_CHECK_EQ(index.find(""), MinimalPerfectHash::npos);
+    KBF_CHECK_EQ(index.find(std::string_view(keys[0]).substr(0, keys[0].size() - 1)), MinimalPerfectHash::npos);
+}
+
+// What ArmourDataManager falls back to a map lookup for.
+KBF_TEST(duplicate_keys_fail_and_leave_it_empty) {
+    MinimalPerfectHash index;
+    KBF_CHECK(!index.build({ "a/b.pfb", "c/d.pfb", "a/b.pfb" }));
+    KBF_CHECK_EQ(index.size(), size_t{ 0 });
+    KBF_CHECK_EQ(index.find("c/d.pfb"), MinimalPerfectHash::npos);
+}
+
+KBF_TEST(rebuild_replaces_the_key_set) {
+    MinimalPerfectHash index;
+    KBF_REQUIRE(index.build({ "one", "two", "three" }));
+    KBF_REQUIRE(index.build({ "four", "five" }));
+    KBF_CHECK_EQ(index.size(), size_t{ 2 });
+    KBF_CHECK_EQ(index.find("one"), MinimalPerfectHash::npos);
+    KBF_CHECK(index.find("five") != MinimalPerfectHash::npos);
+
+    index.clear();
+    KBF_CHECK_EQ(index.find("five"), MinimalPerfectHash::npos);
+}
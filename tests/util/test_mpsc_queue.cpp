@@ -0,0 +1,191 @@
+#include <kbf_test.hpp>
+
+#include <kbf/util/concurrency/mpsc_queue.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace kbf;
+
+namespace {
+
+    struct Event {
+        uint32_t producer;
+        uint32_t sequence;
+    };
+
+}
+
+KBF_TEST(unallocated_queue_rejects) {
+    MpscQueue<uint32_t> queue;
+    KBF_CHECK(!queue.tryPush(1));
+    KBF_CHECK_EQ(queue.drain([](uint32_t) {}), size_t{ 0 });
+}
+
+KBF_TEST(capacity_rounds_up_to_a_power_of_two) {
+    KBF_CHECK_EQ(MpscQueue<uint32_t>{ 0 }.getCapacity(),   size_t{ 2 });
+    KBF_CHECK_EQ(MpscQueue<uint32_t>{ 5 }.getCapacity(),   size_t{ 8 });
+    KBF_CHECK_EQ(MpscQueue<uint32_t>{ 300 }.getCapacity(), size_t{ 512 });
+}
+
+KBF_TEST(drains_in_push_order) {
+    MpscQueue<uint32_t> queue{ 8 };
+    for (uint32_t i = 0; i < 5; i++) KBF_CHECK(queue.tryPush(i));
+
+    std::vector<uint32_t> drained;
+    KBF_CHECK_EQ(queue.drain([&](uint32_t value) { drained.push_back(value); }), size_t{ 5 });
+    KBF_CHECK((drained == std::vector<uint32_t>{ 0, 1, 2, 3, 4 }));
+    KBF_CHECK_EQ(queue.drain([](uint32_t) {}), size_t{ 0 });
+}
+
+KBF_TEST(full_queue_rejects_until_drained) {
+    MpscQueue<uint32_t> queue{ 4 };
+    for (uint32_t i = 0; i < 4; i++) KBF_CHECK(queue.tryPush(i));
+    KBF_CHECK(!queue.tryPush(99));
+    KBF_CHECK_EQ(queue.getRejected(), uint64_t{ 1 });
+
+    KBF_CHECK_EQ(queue.drain([](uint32_t) {}), size_t{ 4 });
+    KBF_CHECK(queue.tryPush(4));
+    KBF_CHECK_EQ(queue.getPushed(), uint64_t{ 5 });
+}
+
+KBF_TEST(wraps_around_many_laps) {
+    MpscQueue<uint32_t> queue{ 4 };
+    uint32_t next = 0;
+    for (uint32_t i = 0; i < 1000; i++) {
+        KBF_REQUIRE(queue.tryPush(i));
+        if (i % 3 == 2) {
+            queue.drain([&](uint32_t value) {
+                KBF_CHECK_EQ(value, next);
+                next++;
+            });
+        }
+    }
+    queue.drain([&](uint32_t value) { KBF_CHECK_EQ(value, next); next++; });
+    KBF_CHECK_EQ(next, uint32_t{ 1000 });
+}
+
+KBF_TEST(reset_drops_queued_entries) {
+    MpscQueue<uint32_t> queue{ 4 };
+    queue.tryPush(1);
+    queue.tryPush(2);
+    queue.reset(16);
+    KBF_CHECK_EQ(queue.getCapacity(), size_t{ 16 });
+    KBF_CHECK_EQ(queue.drain([](uint32_t) {}), size_t{ 0 });
+    KBF_CHECK(queue.tryPush(3));
+    KBF_CHECK_EQ(queue.drain([](uint32_t) {}), size_t{ 1 });
+}
+
+// Several producers pushing into a small queue while the consumer drains - every event arrives exactly once, and each
+//  producer's events arrive in the order it pushed them.
+KBF_TEST(multi_producer_stress) {
+    constexpr uint32_t PRODUCERS = 6;
+    constexpr uint32_t EVENTS    = 20000;
+
+    MpscQueue<Event> queue{ 64 };
+    std::atomic<uint32_t> finished{ 0 };
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0; p < PRODUCERS; p++) {
+        producers.emplace_back([&, p] {
+            for (uint32_t i = 0; i < EVENTS;) {
+                if (queue.tryPush(Event{ p, i })) i++;
+                else                              std::this_thread::yield();
+            }
+            finished.fetch_add(1, std::memory_order_release);
+        });
+    }
+
+    std::vector<uint32_t> nextSequence(PRODUCERS, 0);
+    uint64_t received   = 0;
+    uint64_t outOfOrder = 0;
+    for (;;) {
+        const bool allFinished = finished.load(std::memory_order_acquire) == PRODUCERS;
+        const size_t drained = queue.drain([&](const Event& event) {
+            if (event.producer >= PRODUCERS || event.sequence != nextSequence[event.producer]) outOfOrder++;
+            else                                                                              nextSequence[event.producer]++;
+        });
+        received += drained;
+        // Every push was published before its producer finished, so the drain after seeing them all gets the rest.
+        if (allFinished) break;
+        if (drained == 0) std::this_thread::yield();
+    }
+    for (std::thread& producer : producers) producer.join();
+
+    KBF_CHECK_EQ(outOfOrder, uint64_t{ 0 });
+    KBF_CHECK_EQ(received, uint64_t{ PRODUCERS } * EVENTS);
+    for (uint32_t p = 0; p < PRODUCERS; p++) KBF_CHECK_EQ(nextSequence[p], EVENTS);
+    KBF_CHECK_EQ(queue.getPushed(), uint64_t{ PRODUCERS } * EVENTS);
+}
+
+// The NPC tracker's pattern: a per-index "already queued" flag in front of a queue sized for every index, so pushes
+//  can never fail however hard the hooks fire.
+KBF_TEST(deduplicated_pushes_never_fail) {
+    constexpr uint32_t PRODUCERS = 6;
+    constexpr size_t   INDICES   = 300;
+
+    MpscQueue<uint32_t> queue{ INDICES };
+    const auto queued = std::make_unique<std::atomic<bool>[]>(INDICES);
+    std::atomic<bool>     stop{ false };
+    std::atomic<uint64_t> failures{ 0 };
+    std::atomic<uint64_t> pushes{ 0 };
+
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0; p < PRODUCERS; p++) {
+        producers.emplace_back([&, p] {
+            uint32_t state = p * 7919u + 1;
+            while (!stop.load(std::memory_order_relaxed)) {
+                state = state * 1103515245u + 12345u;
+                const uint32_t idx = (state >> 8) % INDICES;
+                if (queued[idx].exchange(true, std::memory_order_acq_rel)) continue;
+                if (queue.tryPush(idx)) pushes.fetch_add(1, std::memory_order_relaxed);
+                else                    failures.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    uint64_t drained = 0;
+    const auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(200);
+    while (std::chrono::steady_clock::now() < end) {
+        const size_t count = queue.drain([&](uint32_t idx) { queued[idx].store(false, std::memory_order_release); });
+        drained += count;
+        if (count == 0) std::this_thread::yield();
+    }
+    stop.store(true, std::memory_order_relaxed);
+    for (std::thread& producer : producers) producer.join();
+    drained += queue.drain([&](uint32_t idx) { queued[idx].store(false, std::memory_order_release); });
+
+    KBF_CHECK_EQ(failures.load(), uint64_t{ 0 });
+    KBF_CHECK_EQ(queue.getRejected(), uint64_t{ 0 });
+    KBF_CHECK_EQ(drained, pushes.load());
+    KBF_CHECK(drained > 0);
+}
+
+// A hook thread only touches the queue once it sees a non-zero size, as onNpcChangeState does with npcListSize.
+KBF_TEST(size_publishes_the_queue) {
+    for (int round = 0; round < 50; round++) {
+        MpscQueue<uint32_t> queue;
+        std::unique_ptr<std::atomic<bool>[]> queued;
+        std::atomic<size_t> listSize{ 0 };
+        std::atomic<bool> pushed{ false };
+
+        std::thread hook([&] {
+            size_t size = 0;
+            while ((size = listSize.load(std::memory_order_acquire)) == 0) std::this_thread::yield();
+            const uint32_t idx = static_cast<uint32_t>(size - 1);
+            if (!queued[idx].exchange(true, std::memory_order_acq_rel)) pushed.store(queue.tryPush(idx), std::memory_order_release);
+        });
+
+        queue.reset(8);
+        queued = std::make_unique<std::atomic<bool>[]>(8);
+        listSize.store(8, std::memory_order_release);
+        hook.join();
+
+        KBF_CHECK(pushed.load(std::memory_order_acquire));
+        size_t drained = 0;
+        queue.drain([&](uint32_t idx) { drained++; KBF_CHECK_EQ(idx, uint32_t{ 7 }); });
+        KBF_CHECK_EQ(drained, size_t{ 1 });
+    }
+}
@@ -0,0 +1,141 @@
+#include <kbf_test.hpp>
+
+#include <kbf/util/concurrency/snapshot_buffer.hpp>
+#include <kbf/profiling/tracker_health_snapshot.hpp>
+
+#include <atomic>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace kbf;
+
+namespace {
+
+    struct Snapshot {
+        uint64_t frame = 0;
+        std::vector<std::string> names;
+        TrackerHealthSnapshot health;
+    };
+
+    std::string nameFor(uint64_t frame) { return "player_" + std::to_string(frame) + "_long_enough_to_skip_sso"; }
+
+}
+
+KBF_TEST(read_before_publish_is_default) {
+    SnapshotBuffer<Snapshot> buffer;
+    KBF_CHECK_EQ(buffer.read().frame, uint64_t{ 0 });
+    KBF_CHECK(buffer.read().names.empty());
+    KBF_CHECK_EQ(buffer.getPublished(), uint64_t{ 0 });
+}
+
+KBF_TEST(read_takes_the_newest_publish) {
+    SnapshotBuffer<Snapshot> buffer;
+    for (uint64_t frame = 1; frame <= 3; frame++) {
+        buffer.back().frame = frame;
+        buffer.publish();
+    }
+    KBF_CHECK_EQ(buffer.read().frame, uint64_t{ 3 });
+    KBF_CHECK_EQ(buffer.getPublished(), uint64_t{ 3 });
+}
+
+KBF_TEST(snapshot_holds_until_the_next_read) {
+    SnapshotBuffer<Snapshot> buffer;
+    buffer.back().frame = 1;
+    buffer.publish();
+    const Snapshot& held = buffer.read();
+
+    // However much the writer publishes meanwhile, it never writes into the buffer the reader holds.
+    for (uint64_t frame = 2; frame < 10; frame++) {
+        KBF_CHECK(&buffer.back() != &held);
+        buffer.back().frame = frame;
+        buffer.publish();
+    }
+    KBF_CHECK_EQ(held.frame, uint64_t{ 1 });
+    KBF_CHECK(&buffer.read() == &buffer.read()); // Nothing new since
+    KBF_CHECK_EQ(buffer.read().frame, uint64_t{ 9 });
+}
+
+KBF_TEST(buffers_rotate_through_all_three) {
+    SnapshotBuffer<Snapshot> buffer;
+    std::set<const Snapshot*> seen;
+    for (int i = 0; i < 12; i++) {
+        seen.insert(&buffer.back());
+        buffer.publish();
+        seen.insert(&buffer.read());
+    }
+    KBF_CHECK_EQ(seen.size(), size_t{ 3 });
+}
+
+KBF_TEST(buffers_keep_their_capacity) {
+    SnapshotBuffer<Snapshot> buffer;
+    for (int i = 0; i < 3; i++) {
+        buffer.back().names.reserve(64);
+        buffer.publish();
+        buffer.read();
+    }
+    // Every buffer has been through the writer once, so refilling is assignment into existing storage.
+    for (int i = 0; i < 6; i++) {
+        KBF_CHECK(buffer.back().names.capacity() >= 64);
+        buffer.back().names.assign(10, "x");
+        buffer.publish();
+        buffer.read();
+    }
+}
+
+// The GUI reading tracker snapshots while the update thread publishes every frame. Each snapshot read must be whole -
+//  every field from the same frame - & frames never go backwards. Run it under -DKBF_TEST_SANITIZER=thread as well.
+KBF_TEST(concurrent_reader_sees_whole_snapshots) {
+    constexpr uint64_t FRAMES = 20000;
+
+    SnapshotBuffer<Snapshot> buffer;
+    FetchRetryScheduler retries;
+    retries.resize(64);
+    PointerValidityCache validity{ 11 };
+    validity.resize(64);
+    std::atomic<bool> done{ false };
+
+    std::thread writer([&] {
+        const FetchRetryScheduler::Clock::time_point now = FetchRetryScheduler::Clock::now();
+        for (uint64_t frame = 1; frame <= FRAMES; frame++) {
+            Snapshot& snapshot = buffer.back();
+            snapshot.frame = frame;
+            snapshot.names.assign(frame % 37, nameFor(frame));
+
+            if (frame % 5 == 0) retries.recordFailure(frame % 64, FetchFailure::BONES, now);
+            else                retries.reset(frame % 64);
+            snapshot.health.capture(retries, validity);
+
+            buffer.publish();
+        }
+        done.store(true, std::memory_order_release);
+    });
+
+    uint64_t last = 0, distinct = 0, backwards = 0, torn = 0;
+    for (;;) {
+        const bool finished = done.load(std::memory_order_acquire);
+        const Snapshot& snapshot = buffer.read();
+        if (snapshot.frame < last) backwards++;
+        if (snapshot.frame != last) distinct++;
+        last = snapshot.frame;
+
+        if (snapshot.names.size() != snapshot.frame % 37) torn++;
+        for (const std::string& name : snapshot.names) {
+            if (name != nameFor(snapshot.frame)) { torn++; break; }
+        }
+        for (const auto& [slot, state] : snapshot.health.failingFetches) {
+            if (state.failures == 0 || slot >= 64) torn++;
+        }
+
+        if (finished) break;
+        std::this_thread::yield();
+    }
+    writer.join();
+
+    KBF_CHECK_EQ(backwards, uint64_t{ 0 });
+    KBF_CHECK_EQ(torn, uint64_t{ 0 });
+    KBF_CHECK(distinct > 0);
+    KBF_CHECK_EQ(last, FRAMES); // The read after the last publish gets the last frame
+    KBF_CHECK_EQ(buffer.getPublished(), FRAMES);
+}
@@ -0,0 +1,213 @@
+#include <kbf_test.hpp>
+
+#include <kbf/util/time/timer_wheel.hpp>
+
+#include <random>
+#include <vector>
+
+using namespace kbf;
+using namespace std::chrono_literals;
+
+namespace {
+
+    using Clock = TimerWheel::Clock;
+
+    const Clock::time_point T0 = Clock::time_point{} + 1000s;
+
+    std::vector<uint32_t> advanceCollect(TimerWheel& wheel, Clock::time_point now) {
+        std::vector<uint32_t> fired;
+        wheel.advance(now, [&](uint32_t id) { fired.push_back(id); });
+        return fired;
+    }
+
+}
+
+KBF_TEST(fires_at_deadline_not_before) {
+    TimerWheel wheel;
+    wheel.resize(4);
+    wheel.schedule(1, T0, 50ms);
+    KBF_CHECK(wheel.isPending(1));
+    KBF_CHECK_EQ(wheel.pendingCount(), size_t{ 1 });
+
+    KBF_CHECK(advanceCollect(wheel, T0 + 49ms).empty());
+    KBF_CHECK((advanceCollect(wheel, T0 + 50ms) == std::vector<uint32_t>{ 1 }));
+    KBF_CHECK(!wheel.isPending(1));
+    KBF_CHECK_EQ(wheel.pendingCount(), size_t{ 0 });
+}
+
+KBF_TEST(sub_tick_delays_round_up) {
+    TimerWheel wheel;
+    wheel.resize(2);
+    wheel.schedule(0, T0 + 300us, 500us); // Deadline 0.8ms into the tick - rounds up to the next one
+    KBF_CHECK(advanceCollect(wheel, T0 + 800us).empty());
+    KBF_CHECK_EQ(advanceCollect(wheel, T0 + 1ms).size(), size_t{ 1 });
+}
+
+KBF_TEST(zero_delay_fires_on_next_advance) {
+    TimerWheel wheel;
+    wheel.resize(2);
+    wheel.advance(T0, [](uint32_t) {});
+    wheel.schedule(0, T0, 0ms);
+    KBF_CHECK(advanceCollect(wheel, T0).empty()); // The current tick has already been processed
+    KBF_CHECK_EQ(advanceCollect(wheel, T0 + 1ms).size(), size_t{ 1 });
+}
+
+KBF_TEST(reschedule_replaces_and_cancel_removes) {
+    TimerWheel wheel;
+    wheel.resize(4);
+    wheel.schedule(2, T0, 10ms);
+    wheel.schedule(2, T0, 100ms);
+    KBF_CHECK_EQ(wheel.pendingCount(), size_t{ 1 });
+    KBF_CHECK(advanceCollect(wheel, T0 + 50ms).empty());
+
+    KBF_CHECK(wheel.cancel(2));
+    KBF_CHECK(!wheel.cancel(2));
+    KBF_CHECK(!wheel.cancel(99)); // Out of range ids are ignored
+    KBF_CHECK(advanceCollect(wheel, T0 + 200ms).empty());
+}
+
+KBF_TEST(deadline_is_reported_in_ticks) {
+    TimerWheel wheel;
+    wheel.resize(1);
+    KBF_CHECK(!wheel.getDeadline(0).has_value());
+    wheel.schedule(0, T0, 25ms);
+    KBF_REQUIRE(wheel.getDeadline(0).has_value());
+    KBF_CHECK(*wheel.getDeadline(0) == T0 + 25ms);
+}
+
+KBF_TEST(callbacks_may_reschedule) {
+    TimerWheel wheel;
+    wheel.resize(1);
+    wheel.schedule(0, T0, 10ms);
+
+    int fires = 0;
+    Clock::time_point now = T0;
+    for (int frame = 0; frame < 10; frame++) {
+        now += 10ms;
+        wheel.advance(now, [&](uint32_t id) {
+            fires++;
+            wheel.schedule(id, now, 10ms);
+        });
+    }
+    KBF_CHECK_EQ(fires, 10);
+    KBF_CHECK(wheel.isPending(0));
+}
+
+KBF_TEST(far_timers_cascade_down) {
+    TimerWheel wheel;
+    wheel.resize(3);
+    wheel.schedule(0, T0, 70ms);   // Level 1
+    wheel.schedule(1, T0, 5000ms); // Level 2
+    wheel.schedule(2, T0, 3h);     // Level 3
+
+    Clock::time_point now = T0;
+    std::vector<std::pair<uint32_t, Clock::time_point>> fired;
+    while (fired.size() < 3 && now < T0 + 4h) {
+        now += 1ms * (1 + (now - T0).count() % 997); // Irregular frames, some long
+        wheel.advance(now, [&](uint32_t id) { fired.emplace_back(id, now); });
+    }
+
+    KBF_REQUIRE(fired.size() == 3);
+    const Clock::duration delays[] = { 70ms, 5000ms, 3h };
+    for (const auto& [id, at] : fired) KBF_CHECK(at >= T0 + delays[id]);
+}
+
+KBF_TEST(long_gap_fires_everything_due) {
+    TimerWheel wheel;
+    wheel.resize(100);
+    for (uint32_t i = 0; i < 100; i++) wheel.schedule(i, T0, 1ms * (i * 37 + 1));
+    KBF_CHECK_EQ(advanceCollect(wheel, T0 + 1h).size(), size_t{ 100 });
+    KBF_CHECK_EQ(wheel.pendingCount(), size_t{ 0 });
+}
+
+KBF_TEST(delays_past_the_top_wheel_are_clamped) {
+    TimerWheel wheel;
+    wheel.resize(1);
+    wheel.schedule(0, T0, 24h);
+    const Clock::duration span = TimerWheel::TICK * ((uint64_t{ 1 } << (TimerWheel::SLOT_BITS * TimerWheel::LEVELS)) - 1);
+    KBF_CHECK(advanceCollect(wheel, T0 + span - 1s).empty());
+    KBF_CHECK_EQ(advanceCollect(wheel, T0 + span).size(), size_t{ 1 });
+}
+
+KBF_TEST(cancel_all_restarts_the_clock) {
+    TimerWheel wheel;
+    wheel.resize(2);
+    wheel.schedule(0, T0 + 1h, 10ms);
+    wheel.advance(T0 + 1h, [](uint32_t) {});
+    wheel.cancelAll();
+    KBF_CHECK_EQ(wheel.pendingCount(), size_t{ 0 });
+
+    // Time starting over from earlier (a replay run again) behaves as on a fresh wheel.
+    wheel.schedule(1, T0, 10ms);
+    KBF_CHECK(advanceCollect(wheel, T0 + 9ms).empty());
+    KBF_CHECK((advanceCollect(wheel, T0 + 10ms) == std::vector<uint32_t>{ 1 }));
+}
+
+// Random schedules, cancels & advances (tiny steps to multi-minute jumps) against a plain deadline per id. Every timer
+//  must fire exactly once, never before its deadline & at most a tick after the advance that passes it.
+KBF_TEST(matches_reference_under_random_operations) {
+    std::mt19937_64 rng{ 7 };
+    constexpr uint32_t IDS = 64;
+    using Ns = std::chrono::nanoseconds;
+
+    size_t early = 0, late = 0, spurious = 0, cancelMismatch = 0, pendingMismatch = 0, fired = 0;
+    for (int trial = 0; trial < 100; trial++) {
+        TimerWheel wheel;
+        wheel.resize(IDS);
+        std::vector<int64_t> deadlines(IDS, -1); // ns since epoch, -1 when idle
+
+        Clock::time_point now = T0 + std::chrono::milliseconds(rng() % 100000) + Ns(rng() % 1000000);
+        for (int step = 0; step < 2000; step++) {
+            const int op = static_cast<int>(rng() % 10);
+            const uint32_t id = static_cast<uint32_t>(rng() % IDS);
+
+            if (op < 4) {
+                Clock::duration delay{};
+                switch (rng() % 4) {
+                case 0:  delay = Ns(rng() % 3000000);                     break;
+                case 1:  delay = std::chrono::milliseconds(rng() % 5000);   break;
+                case 2:  delay = std::chrono::milliseconds(rng() % 300000); break;
+                default: delay = Ns(0);                                     break;
+                }
+                wheel.schedule(id, now, delay);
+                deadlines[id] = (now + delay).time_since_epoch().count();
+            }
+            else if (op < 5) {
+                if (wheel.cancel(id) != (deadlines[id] >= 0)) cancelMismatch++;
+                deadlines[id] = -1;
+            }
+            else {
+                switch (rng() % 3) {
+                case 0:  now += Ns(rng() % 20000000);                      break;
+                case 1:  now += std::chrono::milliseconds(rng() % 2000);   break;
+                default: now += std::chrono::milliseconds(rng() % 400000); break;
+                }
+                const int64_t nowNs = now.time_since_epoch().count();
+
+                wheel.advance(now, [&](uint32_t firedId) {
+                    fired++;
+                    if (deadlines[firedId] < 0)      spurious++;
+                    else if (deadlines[firedId] > nowNs) early++;
+                    deadlines[firedId] = -1;
+                });
+
+                const int64_t tickNs = std::chrono::duration_cast<Ns>(TimerWheel::TICK).count();
+                for (uint32_t i = 0; i < IDS; i++) {
+                    if (deadlines[i] >= 0 && nowNs - deadlines[i] >= tickNs) late++;
+                    if ((deadlines[i] >= 0) != wheel.isPending(i)) pendingMismatch++;
+                }
+            }
+
+            size_t expectedPending = 0;
+            for (int64_t deadline : deadlines) expectedPending += deadline >= 0 ? 1 : 0;
+            if (expectedPending != wheel.pendingCount()) pendingMismatch++;
+        }
+    }
+
+    KBF_CHECK_EQ(early, size_t{ 0 });
+    KBF_CHECK_EQ(late, size_t{ 0 });
+    KBF_CHECK_EQ(spurious, size_t{ 0 });
+    KBF_CHECK_EQ(cancelMismatch, size_t{ 0 });
+    KBF_CHECK_EQ(pendingMismatch, size_t{ 0 });
+    KBF_CHECK(fired > 10000);
+}
@@ -0,0 +1,190 @@
+#include <kbf_test.hpp>
+
+#include <kbf/util/string/utf16_to_utf8.hpp>
+
+#include <cstdio>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace kbf;
+
+namespace {
+
+    // Straightforward one-code-unit-at-a-time transcoder to check the vectorized one against.
+    std::string referenceUtf16ToUtf8(const std::u16string& src) {
+        std::string out;
+        for (size_t i = 0; i < src.size(); i++) {
+            uint32_t cp = src[i];
+            if (cp >= 0xD800 && cp <= 0xDBFF && i + 1 < src.size() && src[i + 1] >= 0xDC00 && src[i + 1] <= 0xDFFF) {
+                cp = 0x10000 + ((cp - 0xD800) << 10) + (static_cast<uint32_t>(src[i + 1]) - 0xDC00);
+                i++;
+            }
+            else if (cp >= 0xD800 && cp <= 0xDFFF) {
+                cp = 0xFFFD;
+            }
+
+            if (cp < 0x80) {
+                out += static_cast<char>(cp);
+            }
+            else if (cp < 0x800) {
+                out += static_cast<char>(0xC0 | (cp >> 6));
+                out += static_cast<char>(0x80 | (cp & 0x3F));
+            }
+            else if (cp < 0x10000) {
+                out += static_cast<char>(0xE0 | (cp >> 12));
+                out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                out += static_cast<char>(0x80 | (cp & 0x3F));
+            }
+            else {
+                out += static_cast<char>(0xF0 | (cp >> 18));
+                out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+                out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                out += static_cast<char>(0x80 | (cp & 0x3F));
+            }
+        }
+        return out;
+    }
+
+    std::string transcode(const std::u16string& src) {
+        return utf16ToUtf8(src.data(), src.size());
+    }
+
+    std::string transcodeScalar(const std::u16string& src) {
+        std::string out(utf16ToUtf8MaxBytes(src.size()), '\0');
+        out.resize(detail::utf16ToUtf8ScalarOnly(src.data(), src.size(), out.data()));
+        return out;
+    }
+
+    // This file is built once per path (see tests/CMakeLists.txt) - each build says which one it means to test.
+#if defined(KBF_UTF16_TO_UTF8_AVX2)
+    constexpr const char* COMPILED_PATH = "avx2";
+#elif defined(KBF_UTF16_TO_UTF8_SSE2)
+    constexpr const char* COMPILED_PATH = "sse2";
+#else
+    constexpr const char* COMPILED_PATH = "scalar";
+#endif
+
+}
+
+KBF_TEST(empty) {
+    KBF_CHECK_EQ(transcode(u""), std::string{});
+}
+
+KBF_TEST(ascii) {
+    KBF_CHECK_EQ(transcode(u"a"), std::string("a"));
+    KBF_CHECK_EQ(transcode(u"Bip001 Pelvis"), std::string("Bip001 Pelvis"));
+
+    // Long enough to go through both the 16- & 8-wide paths, then finish on scalar
+    const std::u16string longName = u"ch02_001_0002_Body/ch02_001_0002_Body_Helm_L_Shoulder_Pad_00";
+    KBF_CHECK_EQ(transcode(longName), std::string(longName.begin(), longName.end()));
+
+    // 0x7F is the last ASCII code unit, 0x80 the first that isn't
+    KBF_CHECK_EQ(transcode(u"\u007F"), std::string("\x7F"));
+    KBF_CHECK_EQ(transcode(u"\u0080"), std::string("\xC2\x80"));
+}
+
+KBF_TEST(bmp) {
+    KBF_CHECK_EQ(transcode(u"é"), std::string("\xC3\xA9"));             // 2 bytes
+    KBF_CHECK_EQ(transcode(u"߿"), std::string("\xDF\xBF"));             // Last 2 byte code point
+    KBF_CHECK_EQ(transcode(u"ࠀ"), std::string("\xE0\xA0\x80"));         // First 3 byte code point
+    KBF_CHECK_EQ(transcode(u"ハンター"), std::string("\xE3\x83\x8F\xE3\x83\xB3\xE3\x82\xBF\xE3\x83\xBC"));
+    KBF_CHECK_EQ(transcode(u"￿"), std::string("\xEF\xBF\xBF"));
+}
+
+KBF_TEST(surrogate_pairs) {
+    KBF_CHECK_EQ(transcode(u"\U00010000"), std::string("\xF0\x90\x80\x80")); // First supplementary code point
+    KBF_CHECK_EQ(transcode(u"\U0001F600"), std::string("\xF0\x9F\x98\x80"));
+    KBF_CHECK_EQ(transcode(u"\U0010FFFF"), std::string("\xF4\x8F\xBF\xBF")); // Last code point
+    KBF_CHECK_EQ(transcode(u"a\U0001F600b"), std::string("a\xF0\x9F\x98\x80" "b"));
+}
+
+KBF_TEST(unpaired_surrogates) {
+    const std::string replacement = "\xEF\xBF\xBD";
+
+    KBF_CHECK_EQ(transcode(std::u16string{ char16_t(0xD83D) }), replacement);                    // High, at the end
+    KBF_CHECK_EQ(transcode(std::u16string{ char16_t(0xDE00) }), replacement);                    // Low, on its own
+    KBF_CHECK_EQ(transcode(std::u16string{ char16_t(0xD83D), u'a' }), replacement + "a");        // High, then not a low
+    KBF_CHECK_EQ(transcode(std::u16string{ char16_t(0xDE00), char16_t(0xD83D) }), replacement + replacement); // Reversed pair
+    KBF_CHECK_EQ(transcode(std::u16string{ char16_t(0xD83D), char16_t(0xD83D), char16_t(0xDE00) }), replacement + "\xF0\x9F\x98\x80");
+}
+
+KBF_TEST(non_ascii_at_every_position) {
+    // Puts each kind of non-ASCII unit at every offset across the SIMD block boundaries, to catch a vector loop that
+    //  swallows (or drops) the unit it bails out on.
+    const char16_t specials[] = { 0x80, 0x7FF, 0x800, 0xD83D, 0xDE00, 0xFFFF };
+    for (size_t len = 1; len <= 40; len++) {
+        for (size_t at = 0; at < len; at++) {
+            for (const char16_t special : specials) {
+                std::u16string src(len, u'x');
+                src[at] = special;
+                KBF_CHECK_EQ(transcode(src), referenceUtf16ToUtf8(src));
+            }
+        }
+    }
+}
+
+KBF_TEST(matches_reference_on_random_input) {
+    std::mt19937 rng(1);
+    for (int iter = 0; iter < 50000; iter++) {
+        const size_t len     = rng() % 70;
+        const bool   mostlyAscii = rng() % 4 != 0;
+
+        std::u16string src(len, u'\0');
+        for (char16_t& unit : src) {
+            const uint32_t kind = rng() % 100;
+            if (kind < (mostlyAscii ? 90u : 40u)) unit = static_cast<char16_t>(rng() % 0x80);
+            else if (kind < 93)                   unit = static_cast<char16_t>(rng() % 0x800);
+            else if (kind < 97)                   unit = static_cast<char16_t>(0xD800 + rng() % 0x800);
+            else                                  unit = static_cast<char16_t>(rng() % 0x10000);
+        }
+
+        const std::string expected = referenceUtf16ToUtf8(src);
+        KBF_REQUIRE(transcode(src) == expected);
+        KBF_REQUIRE(expected.size() <= utf16ToUtf8MaxBytes(len));
+    }
+}
+
+KBF_TEST(string_overloads_reuse_capacity) {
+    std::string out;
+    out.reserve(256);
+    const char* const buffer = out.data();
+
+    const std::u16string src = u"Bip001 L Thigh";
+    utf16ToUtf8(src.data(), src.size(), out);
+    KBF_CHECK_EQ(out, std::string("Bip001 L Thigh"));
+    KBF_CHECK(out.data() == buffer);
+
+    const std::string_view scratch = utf16ToUtf8Scratch(src.data(), src.size());
+    KBF_CHECK(scratch == "Bip001 L Thigh");
+}
+
+KBF_TEST(expected_path_is_compiled) {
+#if defined(KBF_TEST_UTF16_EXPECT_PATH)
+    KBF_CHECK_EQ(std::string(COMPILED_PATH), std::string(KBF_TEST_UTF16_EXPECT_PATH));
+#endif
+    std::printf("     utf16ToUtf8 path: %s\n", COMPILED_PATH);
+}
+
+// Whichever vector path this build compiled in against the plain scalar loop, on long mixed text - ASCII runs long
+//  enough for the 16 & 8 wide loops, broken up by 2 & 3 byte units, pairs & unpaired surrogates.
+KBF_TEST(vector_path_matches_scalar_on_mixed_input) {
+    std::mt19937 rng(2);
+    const char16_t breaks[] = { 0xE9, 0x30CF, 0xD83D, 0xDE00, 0xFFFD, 0x7FF, 0x800 };
+    for (int iter = 0; iter < 20000; iter++) {
+        std::u16string src;
+        const size_t runs = 1 + rng() % 6;
+        for (size_t r = 0; r < runs; r++) {
+            const size_t asciiRun = rng() % 48;
+            for (size_t k = 0; k < asciiRun; k++) src += static_cast<char16_t>(0x20 + rng() % 0x5F);
+            switch (rng() % 4) {
+            case 0:  src += u"\U0001F600"; break;                          // Pair
+            case 1:  src += breaks[rng() % std::size(breaks)]; break;       // Anything, including a lone surrogate
+            case 2:  src += char16_t(0xD83D); src += char16_t(0xD83D); break; // High, high
+            default: break;
+            }
+        }
+        KBF_REQUIRE(transcode(src) == transcodeScalar(src));
+    }
+}
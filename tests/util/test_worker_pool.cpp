@@ -0,0 +1,101 @@
+#include <kbf_test.hpp>
+
+#include <kbf/util/concurrency/worker_pool.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace kbf;
+
+namespace {
+
+    // Runs a job over `count` indices, returning how many times each index was visited.
+    std::vector<int> visitCounts(WorkerPool& pool, size_t count, size_t minParallel) {
+        const auto visits = std::make_unique<std::atomic<int>[]>(count == 0 ? 1 : count);
+        pool.parallelFor(count, minParallel, [&](size_t i) { visits[i].fetch_add(1, std::memory_order_relaxed); });
+
+        std::vector<int> out(count);
+        for (size_t i = 0; i < count; i++) out[i] = visits[i].load();
+        return out;
+    }
+
+    bool allOnce(const std::vector<int>& visits) {
+        for (int v : visits) if (v != 1) return false;
+        return true;
+    }
+
+}
+
+KBF_TEST(small_jobs_run_inline_without_starting) {
+    WorkerPool pool{ 3 };
+    KBF_CHECK(allOnce(visitCounts(pool, 3, 4)));
+    KBF_CHECK(allOnce(visitCounts(pool, 1, 0))); // A single index is never worth spreading
+    visitCounts(pool, 0, 0);
+
+    KBF_CHECK(!pool.isStarted());
+    KBF_CHECK_EQ(pool.getInlineJobs(), uint64_t{ 2 });
+    KBF_CHECK_EQ(pool.getParallelJobs(), uint64_t{ 0 });
+}
+
+KBF_TEST(no_workers_runs_everything_inline) {
+    WorkerPool pool{ 0 };
+    KBF_CHECK(allOnce(visitCounts(pool, 100, 2)));
+    KBF_CHECK(!pool.isStarted());
+}
+
+KBF_TEST(every_index_runs_exactly_once) {
+    WorkerPool pool{ 3 };
+    for (int round = 0; round < 2000; round++) {
+        const size_t count = static_cast<size_t>(round % 50);
+        KBF_REQUIRE(allOnce(visitCounts(pool, count, 4)));
+    }
+    KBF_CHECK(pool.isStarted());
+    KBF_CHECK(pool.getParallelJobs() > 0);
+}
+
+KBF_TEST(workers_share_the_job) {
+    WorkerPool pool{ 3 };
+    std::mutex mux;
+    std::set<std::thread::id> threads;
+    // Slow enough indices that the workers wake before the caller can finish alone.
+    for (int round = 0; round < 20 && threads.size() < 2; round++) {
+        pool.parallelFor(64, 2, [&](size_t) {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            std::lock_guard<std::mutex> lock(mux);
+            threads.insert(std::this_thread::get_id());
+        });
+    }
+    KBF_CHECK(threads.size() >= 2);
+}
+
+KBF_TEST(stop_is_safe_before_start_and_twice) {
+    WorkerPool pool{ 2 };
+    pool.stop();
+    KBF_CHECK_EQ(pool.getStops(), uint64_t{ 0 });
+
+    visitCounts(pool, 16, 2);
+    pool.stop();
+    pool.stop();
+    KBF_CHECK(!pool.isStarted());
+    KBF_CHECK_EQ(pool.getStops(), uint64_t{ 1 });
+}
+
+// The tracker stops its planners on unload; anything after that (a hot reload that keeps the instance) starts afresh.
+KBF_TEST(restarts_lazily_after_stop) {
+    WorkerPool pool{ 3 };
+    for (int cycle = 0; cycle < 20; cycle++) {
+        for (int round = 0; round < 10; round++) KBF_REQUIRE(allOnce(visitCounts(pool, 40, 4)));
+        KBF_CHECK(pool.isStarted());
+        pool.stop();
+        KBF_CHECK(!pool.isStarted());
+
+        KBF_REQUIRE(allOnce(visitCounts(pool, 2, 4))); // Inline - doesn't restart
+        KBF_CHECK(!pool.isStarted());
+    }
+    KBF_CHECK_EQ(pool.getStops(), uint64_t{ 20 });
+}